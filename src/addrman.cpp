@@ -4,10 +4,14 @@
 
 #include "addrman.h"
 
+#include "crypto/siphash.h"
 #include "hash.h"
 #include "random.h"
 #include "streams.h"
 
+#include <map>
+#include <set>
+
 using namespace std;
 
 int CAddrInfo::GetTriedBucket(const uint256& nKey) const
@@ -72,29 +76,121 @@ double CAddrInfo::GetChance(int64_t nNow) const
     return fChance;
 }
 
+CAddrIdIndex::CAddrIdIndex()
+    : k0(GetRand<uint64_t>())
+    , k1(GetRand<uint64_t>())
+{
+    Clear();
+}
+
+size_t CAddrIdIndex::GetSlot(const CNetAddr& addr) const
+{
+    unsigned char vch[16];
+    for (int n = 0; n < 16; n++)
+        vch[n] = addr.GetByte(15 - n);
+
+    return CSipHasher(k0, k1).Write(vch, sizeof(vch)).Finalize() & (vSlots.size() - 1);
+}
+
+int CAddrIdIndex::Find(const CNetAddr& addr, const std::vector<CAddrInfo>& vInfo) const
+{
+    const size_t nMask = vSlots.size() - 1;
+
+    for (size_t i = GetSlot(addr); vSlots[i] != -1; i = (i + 1) & nMask) {
+        if ((const CNetAddr&)vInfo[vSlots[i]] == addr)
+            return vSlots[i];
+    }
+
+    return -1;
+}
+
+void CAddrIdIndex::Insert(int nId, const std::vector<CAddrInfo>& vInfo)
+{
+    // keep the load factor at or below one half
+    if ((nCount + 1) * 2 > vSlots.size()) {
+        std::vector<int> vOld(vSlots.size() * 2, -1);
+        vOld.swap(vSlots);
+        nCount = 0;
+        for (const int nOldId : vOld) {
+            if (nOldId != -1)
+                Insert(nOldId, vInfo);
+        }
+    }
+
+    const CNetAddr& addr = vInfo[nId];
+    const size_t nMask = vSlots.size() - 1;
+    size_t i = GetSlot(addr);
+
+    for (; vSlots[i] != -1; i = (i + 1) & nMask) {
+        // like map assignment, a second entry for an address replaces the first
+        if ((const CNetAddr&)vInfo[vSlots[i]] == addr) {
+            vSlots[i] = nId;
+            return;
+        }
+    }
+
+    vSlots[i] = nId;
+    nCount++;
+}
+
+void CAddrIdIndex::Erase(int nId, const std::vector<CAddrInfo>& vInfo)
+{
+    const size_t nMask = vSlots.size() - 1;
+    size_t i = GetSlot(vInfo[nId]);
+
+    while (vSlots[i] != nId) {
+        if (vSlots[i] == -1)
+            return;
+        i = (i + 1) & nMask;
+    }
+
+    // Shift back the entries after the hole that can no longer reach their
+    // home slot through it:
+    for (size_t j = (i + 1) & nMask; vSlots[j] != -1; j = (j + 1) & nMask) {
+        const size_t nHome = GetSlot(vInfo[vSlots[j]]);
+        if (((j - nHome) & nMask) >= ((j - i) & nMask)) {
+            vSlots[i] = vSlots[j];
+            i = j;
+        }
+    }
+
+    vSlots[i] = -1;
+    nCount--;
+}
+
+void CAddrIdIndex::Clear()
+{
+    std::vector<int>(16, -1).swap(vSlots);
+    nCount = 0;
+}
+
 CAddrInfo* CAddrMan::Find(const CNetAddr& addr, int *pnId)
 {
-    std::map<CNetAddr, int>::iterator it = mapAddr.find(addr);
-    if (it == mapAddr.end())
+    int nId = addrIndex.Find(addr, vInfo);
+    if (nId == -1)
         return nullptr;
     if (pnId)
-        *pnId = it->second;
-    std::map<int, CAddrInfo>::iterator it2 = mapInfo.find(it->second);
-    if (it2 != mapInfo.end())
-        return &it2->second;
-    return nullptr;
+        *pnId = nId;
+    return &vInfo[nId];
 }
 
 CAddrInfo* CAddrMan::Create(const CAddress &addr, const CNetAddr &addrSource, int *pnId)
 {
-    int nId = nIdCount++;
-    mapInfo[nId] = CAddrInfo(addr, addrSource);
-    mapAddr[addr] = nId;
-    mapInfo[nId].nRandomPos = vRandom.size();
+    int nId;
+    if (vFreeIds.empty()) {
+        nId = vInfo.size();
+        vInfo.emplace_back(addr, addrSource);
+    } else {
+        nId = vFreeIds.back();
+        vFreeIds.pop_back();
+        vInfo[nId] = CAddrInfo(addr, addrSource);
+    }
+    addrIndex.Insert(nId, vInfo);
+    vInfo[nId].nRandomPos = vRandom.size();
     vRandom.push_back(nId);
     if (pnId)
         *pnId = nId;
-    return &mapInfo[nId];
+    return &vInfo[nId];
 }
 
 void CAddrMan::SwapRandom(unsigned int nRndPos1, unsigned int nRndPos2)
@@ -107,11 +203,8 @@ void CAddrMan::SwapRandom(unsigned int nRndPos1, unsigned int nRndPos2)
     int nId1 = vRandom[nRndPos1];
     int nId2 = vRandom[nRndPos2];
 
-    assert(mapInfo.count(nId1) == 1);
-    assert(mapInfo.count(nId2) == 1);
-
-    mapInfo[nId1].nRandomPos = nRndPos2;
-    mapInfo[nId2].nRandomPos = nRndPos1;
+    vInfo[nId1].nRandomPos = nRndPos2;
+    vInfo[nId2].nRandomPos = nRndPos1;
 
     vRandom[nRndPos1] = nId2;
     vRandom[nRndPos2] = nId1;
@@ -119,15 +212,16 @@ void CAddrMan::SwapRandom(unsigned int nRndPos1, unsigned int nRndPos2)
 
 void CAddrMan::Delete(int nId)
 {
-    assert(mapInfo.count(nId) != 0);
-    CAddrInfo& info = mapInfo[nId];
+    assert(nId >= 0 && (size_t)nId < vInfo.size() && vInfo[nId].nRandomPos != -1);
+    CAddrInfo& info = vInfo[nId];
     assert(!info.fInTried);
     assert(info.nRefCount == 0);
 
     SwapRandom(info.nRandomPos, vRandom.size() - 1);
     vRandom.pop_back();
-    mapAddr.erase(info);
-    mapInfo.erase(nId);
+    addrIndex.Erase(nId, vInfo);
+    info = CAddrInfo();
+    vFreeIds.push_back(nId);
     nNew--;
 }
 
@@ -136,7 +230,7 @@ void CAddrMan::ClearNew(int nUBucket, int nUBucketPos)
     // if there is an entry in the specified bucket, delete it.
     if (vvNew[nUBucket][nUBucketPos] != -1) {
         int nIdDelete = vvNew[nUBucket][nUBucketPos];
-        CAddrInfo& infoDelete = mapInfo[nIdDelete];
+        CAddrInfo& infoDelete = vInfo[nIdDelete];
         assert(infoDelete.nRefCount > 0);
         infoDelete.nRefCount--;
         vvNew[nUBucket][nUBucketPos] = -1;
@@ -168,8 +262,7 @@ void CAddrMan::MakeTried(CAddrInfo& info, int nId)
     if (vvTried[nKBucket][nKBucketPos] != -1) {
         // find an item to evict
         int nIdEvict = vvTried[nKBucket][nKBucketPos];
-        assert(mapInfo.count(nIdEvict) == 1);
-        CAddrInfo& infoOld = mapInfo[nIdEvict];
+        CAddrInfo& infoOld = vInfo[nIdEvict];
 
         // Remove the to-be-evicted item from the tried set.
         infoOld.fInTried = false;
@@ -292,7 +385,7 @@ bool CAddrMan::Add_(const CAddress& addr, const CNetAddr& source, int64_t nTimeP
     if (vvNew[nUBucket][nUBucketPos] != nId) {
         bool fInsert = vvNew[nUBucket][nUBucketPos] == -1;
         if (!fInsert) {
-            CAddrInfo& infoExisting = mapInfo[vvNew[nUBucket][nUBucketPos]];
+            CAddrInfo& infoExisting = vInfo[vvNew[nUBucket][nUBucketPos]];
             if (infoExisting.IsTerrible() || (infoExisting.nRefCount > 1 && pinfo->nRefCount == 0)) {
                 // Overwrite the existing new table entry.
                 fInsert = true;
@@ -351,8 +444,7 @@ CAddrInfo CAddrMan::Select_(bool newOnly)
                 nKBucketPos = (nKBucketPos + insecure_rand()) % ADDRMAN_BUCKET_SIZE;
             }
             int nId = vvTried[nKBucket][nKBucketPos];
-            assert(mapInfo.count(nId) == 1);
-            CAddrInfo& info = mapInfo[nId];
+            CAddrInfo& info = vInfo[nId];
             if (RandomInt(1 << 30) < fChanceFactor * info.GetChance() * (1 << 30))
                 return info;
             fChanceFactor *= 1.2;
@@ -368,8 +460,7 @@ CAddrInfo CAddrMan::Select_(bool newOnly)
                 nUBucketPos = (nUBucketPos + insecure_rand()) % ADDRMAN_BUCKET_SIZE;
             }
             int nId = vvNew[nUBucket][nUBucketPos];
-            assert(mapInfo.count(nId) == 1);
-            CAddrInfo& info = mapInfo[nId];
+            CAddrInfo& info = vInfo[nId];
             if (RandomInt(1 << 30) < fChanceFactor * info.GetChance() * (1 << 30))
                 return info;
             fChanceFactor *= 1.2;
@@ -386,9 +477,13 @@ int CAddrMan::Check_()
     if (vRandom.size() != nTried + nNew)
         return -7;
 
-    for (std::map<int, CAddrInfo>::iterator it = mapInfo.begin(); it != mapInfo.end(); it++) {
-        int n = (*it).first;
-        CAddrInfo& info = (*it).second;
+    size_t nFree = 0;
+    for (int n = 0; n < (int)vInfo.size(); n++) {
+        CAddrInfo& info = vInfo[n];
+        if (info.nRandomPos == -1) {
+            nFree++;
+            continue;
+        }
         if (info.fInTried) {
             if (!info.nLastSuccess)
                 return -1;
@@ -402,7 +497,7 @@ int CAddrMan::Check_()
                 return -4;
             mapNew[n] = info.nRefCount;
         }
-        if (mapAddr[info] != n)
+        if (addrIndex.Find(info, vInfo) != n)
             return -5;
         if (info.nRandomPos < 0 || info.nRandomPos >= vRandom.size() || vRandom[info.nRandomPos] != n)
             return -14;
@@ -412,6 +507,8 @@ int CAddrMan::Check_()
             return -8;
     }
 
+    if (nFree != vFreeIds.size())
+        return -20;
     if (setTried.size() != nTried)
         return -9;
     if (mapNew.size() != nNew)
@@ -422,9 +519,9 @@ int CAddrMan::Check_()
              if (vvTried[n][i] != -1) {
                  if (!setTried.count(vvTried[n][i]))
                      return -11;
-                 if (mapInfo[vvTried[n][i]].GetTriedBucket(nKey) != n)
+                 if (vInfo[vvTried[n][i]].GetTriedBucket(nKey) != n)
                      return -17;
-                 if (mapInfo[vvTried[n][i]].GetBucketPosition(nKey, false, n) != i)
+                 if (vInfo[vvTried[n][i]].GetBucketPosition(nKey, false, n) != i)
                      return -18;
                  setTried.erase(vvTried[n][i]);
              }
@@ -436,7 +533,7 @@ int CAddrMan::Check_()
             if (vvNew[n][i] != -1) {
                 if (!mapNew.count(vvNew[n][i]))
                     return -12;
-                if (mapInfo[vvNew[n][i]].GetBucketPosition(nKey, true, n) != i)
+                if (vInfo[vvNew[n][i]].GetBucketPosition(nKey, true, n) != i)
                     return -19;
                 if (--mapNew[vvNew[n][i]] == 0)
                     mapNew.erase(vvNew[n][i]);
@@ -469,9 +566,8 @@ void CAddrMan::GetAddr_(std::vector<CAddress> &vAddr)
 
         int nRndPos = GetRand<int>(vRandom.size() - n) + n;
         SwapRandom(n, nRndPos);
-        assert(mapInfo.count(vRandom[n]) == 1);
-        
-        const CAddrInfo& ai = mapInfo[vRandom[n]];
+
+        const CAddrInfo& ai = vInfo[vRandom[n]];
         if(!ai.IsTerrible())
             vAddr.push_back(ai);
     }
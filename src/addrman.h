@@ -12,7 +12,6 @@
 #include "sync.h"
 
 
-#include <map>
 #include <vector>
 
 
@@ -164,6 +163,44 @@ public:
 // the maximum number of nodes to return in a getaddr call
 #define ADDRMAN_GETADDR_MAX 2500
 
+/**
+ * Open-addressing hash table that finds the nId of an entry by its network
+ * address.
+ *
+ * Slots store only nIds: the table reads the address of a slot from the entry
+ * that the nId refers to. It probes linearly and deletes by shifting later
+ * entries back, so lookups never skip over tombstones. The hash is salted per
+ * instance so that peers cannot send addresses that collide on purpose.
+ */
+class CAddrIdIndex
+{
+public:
+    CAddrIdIndex();
+
+    //! Find the nId of the entry with the given address, or -1.
+    int Find(const CNetAddr& addr, const std::vector<CAddrInfo>& vInfo) const;
+
+    //! Add an entry whose address is not in the index yet.
+    void Insert(int nId, const std::vector<CAddrInfo>& vInfo);
+
+    //! Remove an entry. Must be called before the entry's address changes.
+    void Erase(int nId, const std::vector<CAddrInfo>& vInfo);
+
+    void Clear();
+
+private:
+    uint64_t k0;
+    uint64_t k1;
+
+    //! nIds of the entries, or -1 for an empty slot. Size is a power of two.
+    std::vector<int> vSlots;
+
+    //! number of occupied slots
+    size_t nCount;
+
+    size_t GetSlot(const CNetAddr& addr) const;
+};
+
 /** Stochastical (IP) address manager */
 class CAddrMan
 {
@@ -171,14 +208,15 @@ private:
     // critical section to protect the inner data structures
     mutable CCriticalSection cs;
 
-    //! last used nId
-    int nIdCount;
+    // table with information about all nIds, indexed by nId. Deleted entries
+    // leave a slot with nRandomPos == -1 that Create() reuses.
+    std::vector<CAddrInfo> vInfo;
 
-    // table with information about all nIds
-    std::map<int, CAddrInfo> mapInfo;
+    // nIds of the deleted entries in vInfo
+    std::vector<int> vFreeIds;
 
     // find an nId based on its network address
-    std::map<CNetAddr, int> mapAddr;
+    CAddrIdIndex addrIndex;
 
     // randomly-ordered vector of all nIds
     std::vector<int> vRandom;
@@ -269,7 +307,7 @@ public:
      * as incompatible. This is necessary because it did not check the version number on
      * deserialization.
      *
-     * Notice that vvTried, mapAddr and vVector are never encoded explicitly;
+     * Notice that vvTried, addrIndex and vRandom are never encoded explicitly;
      * they are instead reconstructed from the other information.
      *
      * vvNew is serialized, but only used if ADDRMAN_UNKOWN_BUCKET_COUNT didn't change,
@@ -295,25 +333,27 @@ public:
 
         int nUBuckets = ADDRMAN_NEW_BUCKET_COUNT ^ (1 << 30);
         s << nUBuckets;
-        std::map<int, int> mapUnkIds;
+
+        // Write the "new" entries and remember their positions for the bucket
+        // lists in the same pass that collects the "tried" entries:
+        std::vector<int> vUnkIds(vInfo.size(), -1);
+        std::vector<int> vTriedIds;
+        vTriedIds.reserve(nTried);
         int nIds = 0;
-        for (std::map<int, CAddrInfo>::const_iterator it = mapInfo.begin(); it != mapInfo.end(); it++) {
-            mapUnkIds[it->first] = nIds;
-            const CAddrInfo& info = it->second;
+        for (size_t nId = 0; nId < vInfo.size(); nId++) {
+            const CAddrInfo& info = vInfo[nId];
             if (info.nRefCount) {
                 assert(nIds != nNew); // this means nNew was wrong, oh ow
+                vUnkIds[nId] = nIds;
                 s << info;
                 nIds++;
+            } else if (info.fInTried) {
+                vTriedIds.push_back(nId);
             }
         }
-        nIds = 0;
-        for (std::map<int, CAddrInfo>::const_iterator it = mapInfo.begin(); it != mapInfo.end(); it++) {
-            const CAddrInfo& info = it->second;
-            if (info.fInTried) {
-                assert(nIds != nTried); // this means nTried was wrong, oh ow
-                s << info;
-                nIds++;
-            }
+        assert(vTriedIds.size() == (size_t)nTried); // this means nTried was wrong, oh ow
+        for (const int nId : vTriedIds) {
+            s << vInfo[nId];
         }
         for (int bucket = 0; bucket < ADDRMAN_NEW_BUCKET_COUNT; bucket++) {
             int nSize = 0;
@@ -324,7 +364,7 @@ public:
             s << nSize;
             for (int i = 0; i < ADDRMAN_BUCKET_SIZE; i++) {
                 if (vvNew[bucket][i] != -1) {
-                    int nIndex = mapUnkIds[vvNew[bucket][i]];
+                    int nIndex = vUnkIds[vvNew[bucket][i]];
                     s << nIndex;
                 }
             }
@@ -355,9 +395,10 @@ public:
 
         // Deserialize entries from the new table.
         for (int n = 0; n < nNew; n++) {
-            CAddrInfo &info = mapInfo[n];
+            vInfo.emplace_back();
+            CAddrInfo &info = vInfo.back();
             s >> info;
-            mapAddr[info] = n;
+            addrIndex.Insert(n, vInfo);
             info.nRandomPos = vRandom.size();
             vRandom.push_back(n);
             if (nVersion != 1 || nUBuckets != ADDRMAN_NEW_BUCKET_COUNT) {
@@ -371,8 +412,7 @@ public:
                 }
             }
         }
-        nIdCount = nNew;
-        
+
         // Deserialize entries from the tried table.
         int nLost = 0;
         for (int n = 0; n < nTried; n++) {
@@ -381,13 +421,13 @@ public:
             int nKBucket = info.GetTriedBucket(nKey);
             int nKBucketPos = info.GetBucketPosition(nKey, false, nKBucket);
             if (vvTried[nKBucket][nKBucketPos] == -1) {
+                const int nId = vInfo.size();
                 info.nRandomPos = vRandom.size();
                 info.fInTried = true;
-                vRandom.push_back(nIdCount);
-                mapInfo[nIdCount] = info;
-                mapAddr[info] = nIdCount;
-                vvTried[nKBucket][nKBucketPos] = nIdCount;
-                nIdCount++;
+                vRandom.push_back(nId);
+                vInfo.push_back(info);
+                addrIndex.Insert(nId, vInfo);
+                vvTried[nKBucket][nKBucketPos] = nId;
             } else {
                 nLost++;
             }
@@ -402,7 +442,7 @@ public:
                 int nIndex = 0;
                 s >> nIndex;
                 if (nIndex >= 0 && nIndex < nNew) {
-                    CAddrInfo &info = mapInfo[nIndex];
+                    CAddrInfo &info = vInfo[nIndex];
                     int nUBucketPos = info.GetBucketPosition(nKey, true, bucket);
                     if (nVersion == 1 && nUBuckets == ADDRMAN_NEW_BUCKET_COUNT && vvNew[bucket][nUBucketPos] == -1 && info.nRefCount < ADDRMAN_NEW_BUCKETS_PER_ADDRESS) {
                         info.nRefCount++;
@@ -414,13 +454,11 @@ public:
 
          // Prune new entries with refcount 0 (as a result of collisions).
         int nLostUnk = 0;
-        for (std::map<int, CAddrInfo>::const_iterator it = mapInfo.begin(); it != mapInfo.end(); ) {
-            if (it->second.fInTried == false && it->second.nRefCount == 0) {
-                std::map<int, CAddrInfo>::const_iterator itCopy = it++;
-                Delete(itCopy->first);
+        for (size_t nId = 0; nId < vInfo.size(); nId++) {
+            const CAddrInfo& info = vInfo[nId];
+            if (info.nRandomPos != -1 && info.fInTried == false && info.nRefCount == 0) {
+                Delete(nId);
                 nLostUnk++;
-            } else {
-                it++;
             }
         }
         if (nLost + nLostUnk > 0) {
@@ -437,7 +475,10 @@ public:
 
     void Clear()
     {
+        std::vector<CAddrInfo>().swap(vInfo);
+        std::vector<int>().swap(vFreeIds);
         std::vector<int>().swap(vRandom);
+        addrIndex.Clear();
         nKey = GetRandHash();
         for (size_t bucket = 0; bucket < ADDRMAN_NEW_BUCKET_COUNT; bucket++) {
             for (size_t entry = 0; entry < ADDRMAN_BUCKET_SIZE; entry++) {
@@ -450,7 +491,6 @@ public:
             }
         }
 
-        nIdCount = 0;
         nTried = 0;
         nNew = 0;
     }
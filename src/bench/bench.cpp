@@ -0,0 +1,249 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "fs.h"
+#include "tinyformat.h"
+
+#include <univalue.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <regex>
+
+using namespace benchmark;
+
+namespace {
+double Median(std::vector<double> values)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+
+    std::sort(values.begin(), values.end());
+
+    const size_t mid = values.size() / 2;
+
+    if (values.size() % 2 == 0) {
+        return (values[mid - 1] + values[mid]) / 2.0;
+    }
+
+    return values[mid];
+}
+
+void PrintTableHeader()
+{
+    std::cout << strprintf("| %15s | %13s | %7s | %10s | %s\n", "ns/op", "op/s", "err%", "iterations", "benchmark");
+    std::cout << strprintf("|-%15s-|-%13s-|-%7s-|-%10s-|-%s\n",
+                           std::string(15, '-'),
+                           std::string(13, '-'),
+                           std::string(7, '-'),
+                           std::string(10, '-'),
+                           std::string(40, '-'));
+}
+
+void PrintTableRow(const Result& result)
+{
+    const double median = result.Median();
+
+    std::cout << strprintf("| %15.2f | %13.2f | %6.1f%% | %10d | %s\n",
+                           median,
+                           median > 0 ? 1e9 / median : 0.0,
+                           result.ErrorPercent(),
+                           result.m_iterations,
+                           result.m_name);
+}
+} // Anonymous namespace
+
+// -----------------------------------------------------------------------------
+// Class: Result
+// -----------------------------------------------------------------------------
+
+double Result::Median() const
+{
+    return ::Median(m_epoch_ns);
+}
+
+double Result::Min() const
+{
+    if (m_epoch_ns.empty()) {
+        return 0.0;
+    }
+
+    return *std::min_element(m_epoch_ns.begin(), m_epoch_ns.end());
+}
+
+double Result::Max() const
+{
+    if (m_epoch_ns.empty()) {
+        return 0.0;
+    }
+
+    return *std::max_element(m_epoch_ns.begin(), m_epoch_ns.end());
+}
+
+double Result::ErrorPercent() const
+{
+    const double median = Median();
+
+    if (median <= 0) {
+        return 0.0;
+    }
+
+    std::vector<double> errors;
+    errors.reserve(m_epoch_ns.size());
+
+    for (const auto& ns : m_epoch_ns) {
+        errors.push_back(std::fabs(ns - median) / median);
+    }
+
+    return ::Median(std::move(errors)) * 100.0;
+}
+
+UniValue Result::ToJson() const
+{
+    UniValue json(UniValue::VOBJ);
+    UniValue epochs(UniValue::VARR);
+
+    for (const auto& ns : m_epoch_ns) {
+        epochs.push_back(ns);
+    }
+
+    json.pushKV("name", m_name);
+    json.pushKV("unit", m_unit);
+    json.pushKV("batch", m_batch);
+    json.pushKV("iterations", m_iterations);
+    json.pushKV("median_ns", Median());
+    json.pushKV("min_ns", Min());
+    json.pushKV("max_ns", Max());
+    json.pushKV("error_percent", ErrorPercent());
+    json.pushKV("epochs_ns", epochs);
+
+    return json;
+}
+
+// -----------------------------------------------------------------------------
+// Class: Bench
+// -----------------------------------------------------------------------------
+
+Bench::Bench(std::string name)
+{
+    m_result.m_name = std::move(name);
+    m_result.m_unit = "op";
+}
+
+Bench& Bench::Batch(uint64_t batch)
+{
+    m_result.m_batch = std::max<uint64_t>(batch, 1);
+    return *this;
+}
+
+Bench& Bench::Unit(std::string unit)
+{
+    m_result.m_unit = std::move(unit);
+    return *this;
+}
+
+Bench& Bench::Epochs(size_t epochs)
+{
+    m_epochs = std::max<size_t>(epochs, 1);
+    return *this;
+}
+
+Bench& Bench::MinEpochTime(std::chrono::nanoseconds min_epoch_time)
+{
+    m_min_epoch_time = min_epoch_time;
+    return *this;
+}
+
+const Result& Bench::GetResult() const
+{
+    return m_result;
+}
+
+uint64_t Bench::NextIterations(const uint64_t iterations, const std::chrono::nanoseconds elapsed) const
+{
+    // Jump close to the target once the measurement is meaningful:
+    if (elapsed.count() > 1000) {
+        const double scale = static_cast<double>(m_min_epoch_time.count()) / elapsed.count();
+        return std::max<uint64_t>(iterations * 2, static_cast<uint64_t>(iterations * scale * 1.1));
+    }
+
+    return iterations * 2;
+}
+
+void Bench::RecordEpoch(const std::chrono::nanoseconds elapsed)
+{
+    m_result.m_epoch_ns.push_back(
+        static_cast<double>(elapsed.count()) / (m_result.m_iterations * m_result.m_batch));
+}
+
+// -----------------------------------------------------------------------------
+// Class: BenchRunner
+// -----------------------------------------------------------------------------
+
+BenchRunner::BenchmarkMap& BenchRunner::Benchmarks()
+{
+    static BenchmarkMap benchmarks_map;
+    return benchmarks_map;
+}
+
+BenchRunner::BenchRunner(std::string name, BenchFunction func)
+{
+    Benchmarks().emplace(std::move(name), std::move(func));
+}
+
+bool BenchRunner::RunAll(const Args& args)
+{
+    const std::regex filter(args.m_filter.empty() ? ".*" : args.m_filter);
+
+    UniValue results(UniValue::VARR);
+
+    if (!args.m_list_only) {
+        PrintTableHeader();
+    }
+
+    for (const auto& [name, func] : Benchmarks()) {
+        if (!std::regex_match(name, filter)) {
+            continue;
+        }
+
+        if (args.m_list_only) {
+            std::cout << name << std::endl;
+            continue;
+        }
+
+        Bench bench(name);
+        bench.Epochs(args.m_epochs).MinEpochTime(args.m_min_time);
+
+        func(bench);
+
+        PrintTableRow(bench.GetResult());
+        results.push_back(bench.GetResult().ToJson());
+    }
+
+    if (args.m_output_json.empty()) {
+        return true;
+    }
+
+    UniValue report(UniValue::VOBJ);
+    report.pushKV("epochs", (uint64_t)args.m_epochs);
+    report.pushKV("min_epoch_time_ms", (int64_t)args.m_min_time.count());
+    report.pushKV("results", results);
+
+    fsbridge::ofstream file(fs::path(args.m_output_json));
+
+    if (!file) {
+        std::cerr << "Could not write benchmark results to " << args.m_output_json << std::endl;
+        return false;
+    }
+
+    file << report.write(4) << std::endl;
+
+    std::cout << "Wrote benchmark results to " << args.m_output_json << std::endl;
+
+    return true;
+}
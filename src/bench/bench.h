@@ -0,0 +1,204 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_BENCH_BENCH_H
+#define GRIDCOIN_BENCH_BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+class UniValue;
+
+namespace benchmark {
+//!
+//! \brief Prevent the compiler from optimizing away a computed value.
+//!
+template <typename T>
+inline void DoNotOptimizeAway(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+//!
+//! \brief Timing results of one benchmark.
+//!
+struct Result
+{
+    std::string m_name;             //!< Registered benchmark name.
+    std::string m_unit;             //!< What a single operation processes.
+    uint64_t m_batch = 1;           //!< Operations performed per iteration.
+    uint64_t m_iterations = 0;      //!< Iterations per epoch after calibration.
+    std::vector<double> m_epoch_ns; //!< Nanoseconds per operation of each epoch.
+
+    double Median() const;
+    double Min() const;
+    double Max() const;
+
+    //!
+    //! \brief Get the median absolute percentage error of the epochs.
+    //!
+    //! \return Spread of the epoch timings around the median in percent. A
+    //! large value means that the result is noisy.
+    //!
+    double ErrorPercent() const;
+
+    UniValue ToJson() const;
+};
+
+//!
+//! \brief Runs a piece of code repeatedly and records its timings.
+//!
+//! Modelled after nanobench: the runner first calibrates how many iterations
+//! fill one epoch of at least the minimum epoch time, then runs several epochs
+//! and reports the median time per operation and the spread between epochs.
+//!
+class Bench
+{
+public:
+    explicit Bench(std::string name);
+
+    //!
+    //! \brief Set the number of operations that one call of the benchmarked
+    //! code performs so that results are reported per operation.
+    //!
+    Bench& Batch(uint64_t batch);
+
+    //!
+    //! \brief Set the name of a single operation for reporting.
+    //!
+    Bench& Unit(std::string unit);
+
+    //!
+    //! \brief Set the number of measured epochs.
+    //!
+    Bench& Epochs(size_t epochs);
+
+    //!
+    //! \brief Set the minimum time that one epoch runs.
+    //!
+    Bench& MinEpochTime(std::chrono::nanoseconds min_epoch_time);
+
+    //!
+    //! \brief Calibrate and time the supplied code.
+    //!
+    //! \param op Code to benchmark. Called many times.
+    //!
+    template <typename Op>
+    Bench& Run(Op&& op)
+    {
+        // Warm up caches and lazily-initialized state:
+        op();
+
+        // Calibrate: raise the iteration count until one epoch runs for at
+        // least the minimum epoch time.
+        uint64_t iterations = 1;
+
+        while (iterations < MAX_EPOCH_ITERATIONS) {
+            const std::chrono::nanoseconds elapsed = TimeIterations(op, iterations);
+
+            if (elapsed >= m_min_epoch_time) {
+                break;
+            }
+
+            iterations = NextIterations(iterations, elapsed);
+        }
+
+        m_result.m_iterations = iterations;
+        m_result.m_epoch_ns.clear();
+        m_result.m_epoch_ns.reserve(m_epochs);
+
+        for (size_t epoch = 0; epoch < m_epochs; ++epoch) {
+            RecordEpoch(TimeIterations(op, iterations));
+        }
+
+        return *this;
+    }
+
+    const Result& GetResult() const;
+
+private:
+    //! Upper bound for the calibrated iteration count of one epoch.
+    static constexpr uint64_t MAX_EPOCH_ITERATIONS = uint64_t{1} << 32;
+
+    Result m_result;
+    size_t m_epochs = 11;
+    std::chrono::nanoseconds m_min_epoch_time = std::chrono::milliseconds(10);
+
+    //!
+    //! \brief Call the benchmarked code the specified number of times.
+    //!
+    //! A template so that the compiler can inline the code into the timing
+    //! loop instead of calling it through a type-erased function.
+    //!
+    template <typename Op>
+    static std::chrono::nanoseconds TimeIterations(Op& op, const uint64_t iterations)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < iterations; ++i) {
+            op();
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    //!
+    //! \brief Get the iteration count for the next calibration round.
+    //!
+    uint64_t NextIterations(uint64_t iterations, std::chrono::nanoseconds elapsed) const;
+
+    void RecordEpoch(std::chrono::nanoseconds elapsed);
+};
+
+using BenchFunction = std::function<void(Bench&)>;
+
+//!
+//! \brief Options parsed from the bench_gridcoin command line.
+//!
+struct Args
+{
+    std::string m_filter;                     //!< Regular expression to select benchmarks.
+    std::string m_output_json;                //!< Path of the JSON report or empty.
+    bool m_list_only = false;                 //!< Print benchmark names without running them.
+    size_t m_epochs = 11;                     //!< Epochs per benchmark.
+    std::chrono::milliseconds m_min_time{10}; //!< Minimum time of one epoch.
+};
+
+//!
+//! \brief Registers a benchmark function at static initialization time.
+//!
+class BenchRunner
+{
+    using BenchmarkMap = std::map<std::string, BenchFunction>;
+
+    static BenchmarkMap& Benchmarks();
+
+public:
+    BenchRunner(std::string name, BenchFunction func);
+
+    //!
+    //! \brief Run every registered benchmark that matches the filter.
+    //!
+    //! \return \c false if the JSON report could not be written.
+    //!
+    static bool RunAll(const Args& args);
+};
+} // namespace benchmark
+
+//!
+//! \brief Register a benchmark function with the name of the function.
+//!
+#define BENCHMARK(n) \
+    benchmark::BenchRunner bench_runner_##n(#n, n)
+
+#endif // GRIDCOIN_BENCH_BENCH_H
@@ -0,0 +1,68 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "chainparams.h"
+#include "crypto/sha256.h"
+#include "key.h"
+#include "random.h"
+#include "util.h"
+
+#include <iostream>
+
+namespace {
+void SetupBenchArgs(ArgsManager& argsman)
+{
+    SetupHelpOptions(argsman);
+
+    argsman.AddArg("-filter=<regex>", "Regular expression filter to select benchmark by name (default: .*)",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-list", "List benchmarks without executing them",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-output-json=<output.json>", "Write the results of all benchmarks to the specified JSON file",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-epochs=<n>", "Number of measured epochs for each benchmark (default: 11)",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-min-time=<milliseconds>", "Minimum runtime of one epoch for each benchmark (default: 10)",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+}
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    ArgsManager argsman;
+    SetupBenchArgs(argsman);
+
+    std::string error;
+
+    if (!argsman.ParseParameters(argc, argv, error)) {
+        std::cerr << "Error parsing command line arguments: " << error << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (HelpRequested(argsman)) {
+        std::cout << "Usage: bench_gridcoin [options]\n\n" << argsman.GetHelpMessage();
+        return EXIT_SUCCESS;
+    }
+
+    benchmark::Args args;
+    args.m_filter = argsman.GetArg("-filter", "");
+    args.m_list_only = argsman.GetBoolArg("-list", false);
+    args.m_output_json = argsman.GetArg("-output-json", "");
+    args.m_epochs = std::max<int64_t>(argsman.GetArg("-epochs", 11), 1);
+    args.m_min_time = std::chrono::milliseconds(std::max<int64_t>(argsman.GetArg("-min-time", 10), 0));
+
+    SetupEnvironment();
+    SHA256AutoDetect();
+    RandomInit();
+    ECC_Start();
+    SelectParams(CBaseChainParams::MAIN);
+
+    const bool success = benchmark::BenchRunner::RunAll(args);
+
+    ECC_Stop();
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "dbwrapper.h"
+#include "main.h"
+#include "random.h"
+#include "util.h"
+
+#include <cassert>
+
+namespace {
+//! Number of entries in the synthetic block index.
+constexpr size_t BLOCK_INDEX_COUNT = 20000;
+
+//!
+//! \brief A chain of block index entries written to a LevelDB transaction
+//! index in a temporary data directory.
+//!
+//! Block verification is disabled with -checkblocks=0 so that the benchmark
+//! measures only the scan of the index into \c mapBlockIndex. The entries of
+//! each load come from the block index pool, which never frees them, so the
+//! memory use of the process grows with the number of iterations.
+//!
+class BlockIndexFixture
+{
+public:
+    BlockIndexFixture()
+    {
+        FastRandomContext rng(true);
+
+        m_path = fs::temp_directory_path() / "bench_block_index" / rng.rand256().ToString();
+        gArgs.ForceSetArg("-datadir", m_path.string());
+        gArgs.ForceSetArg("-checkblocks", "0");
+        gArgs.ClearPathCache();
+        fs::create_directories(m_path);
+
+        std::vector<uint256> hashes(BLOCK_INDEX_COUNT);
+        std::vector<CBlockIndex> indexes(BLOCK_INDEX_COUNT);
+
+        for (uint32_t i = 0; i < BLOCK_INDEX_COUNT; ++i) {
+            CBlockIndex& index = indexes[i];
+            index.nVersion = 11;
+            index.nHeight = i;
+            index.nTime = 1700000000 + i * 90;
+            index.nBits = 0x1e0fffff;
+            index.nMoneySupply = i * 10 * COIN;
+            index.nStakeModifier = rng.rand64();
+            index.hashMerkleRoot = rng.rand256();
+            index.hashProof = rng.rand256();
+            index.SetProofOfStake();
+
+            if (i > 0) {
+                index.pprev = &indexes[i - 1];
+                indexes[i - 1].pnext = &index;
+            }
+
+            hashes[i] = CDiskBlockIndex(&index).GetBlockHash();
+            index.phashBlock = &hashes[i];
+        }
+
+        CTxDB txdb("cr+");
+
+        txdb.TxnBegin();
+
+        for (auto& index : indexes) {
+            txdb.WriteBlockIndex(CDiskBlockIndex(&index));
+        }
+
+        txdb.WriteHashBestChain(hashes.back());
+
+        const bool committed = txdb.TxnCommit();
+        assert(committed);
+
+        LOCK(cs_main);
+
+        m_saved_best = pindexBest;
+        m_saved_genesis = pindexGenesisBlock;
+        m_saved_best_hash = hashBestChain;
+        m_saved_best_height = nBestHeight;
+        m_saved_index.swap(mapBlockIndex);
+    }
+
+    ~BlockIndexFixture()
+    {
+        {
+            LOCK(cs_main);
+
+            mapBlockIndex.swap(m_saved_index);
+            pindexBest = m_saved_best;
+            pindexGenesisBlock = m_saved_genesis;
+            hashBestChain = m_saved_best_hash;
+            nBestHeight = m_saved_best_height;
+        }
+
+        CTxDB().Close();
+        fs::remove_all(m_path);
+    }
+
+    //!
+    //! \brief Load the block index from the transaction index and discard it.
+    //!
+    void Load()
+    {
+        LOCK(cs_main);
+
+        CTxDB txdb("r");
+
+        const bool loaded = txdb.LoadBlockIndex();
+        assert(loaded);
+
+        benchmark::DoNotOptimizeAway(mapBlockIndex.size());
+
+        mapBlockIndex.clear();
+        pindexGenesisBlock = nullptr;
+    }
+
+private:
+    fs::path m_path;
+    BlockMap m_saved_index;
+    CBlockIndex* m_saved_best = nullptr;
+    CBlockIndex* m_saved_genesis = nullptr;
+    uint256 m_saved_best_hash;
+    int m_saved_best_height = 0;
+};
+} // Anonymous namespace
+
+static void TxDBLoadBlockIndex(benchmark::Bench& bench)
+{
+    BlockIndexFixture fixture;
+
+    bench.Batch(BLOCK_INDEX_COUNT).Unit("block").Run([&] {
+        fixture.Load();
+    });
+}
+
+BENCHMARK(TxDBLoadBlockIndex);
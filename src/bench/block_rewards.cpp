@@ -0,0 +1,125 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "gridcoin/claim.h"
+#include "gridcoin/consensus/block_rewards.h"
+#include "gridcoin/cpid.h"
+#include "gridcoin/mrc.h"
+#include "key.h"
+#include "main.h"
+#include "random.h"
+#include "validation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace {
+//!
+//! \brief The beacon signatures in a researcher block with the maximum number
+//! of MRC outputs.
+//!
+struct BlockSignaturesFixture
+{
+    uint256 m_last_block_hash;
+    CTransaction m_coinstake;
+    GRC::Claim m_claim;
+    CPubKey m_claim_key;
+    std::vector<GRC::MRC> m_mrcs;
+    std::vector<CPubKey> m_mrc_keys;
+
+    BlockSignaturesFixture()
+    {
+        FastRandomContext rng(true);
+
+        m_last_block_hash = rng.rand256();
+        m_coinstake.vout.resize(2);
+
+        const int block_version = CBlockHeader::CURRENT_VERSION;
+        const size_t mrc_count = GetMRCOutputLimit(block_version, false);
+
+        for (size_t i = 0; i < mrc_count; ++i) {
+            CKey key;
+            key.MakeNewKey(true);
+
+            const GRC::Cpid cpid(rng.randbytes(16));
+
+            GRC::MRC mrc;
+            mrc.m_mining_id = cpid;
+            mrc.m_research_subsidy = 100 * COIN;
+            mrc.m_fee = 10 * COIN;
+            mrc.m_last_block_hash = m_last_block_hash;
+
+            const bool signed_ok = mrc.Sign(key);
+            assert(signed_ok);
+
+            m_mrcs.push_back(std::move(mrc));
+            m_mrc_keys.push_back(key.GetPubKey());
+            m_claim.m_mrc_tx_map.emplace(cpid, rng.rand256());
+        }
+
+        CKey key;
+        key.MakeNewKey(true);
+
+        m_claim.m_mining_id = GRC::Cpid(rng.randbytes(16));
+        m_claim.m_research_subsidy = 100 * COIN;
+
+        const bool signed_ok = m_claim.Sign(key, m_last_block_hash, m_coinstake);
+        assert(signed_ok);
+
+        m_claim_key = key.GetPubKey();
+    }
+
+    std::vector<std::function<bool()>> Checks() const
+    {
+        std::vector<std::function<bool()>> checks;
+
+        for (size_t i = 0; i < m_mrcs.size(); ++i) {
+            checks.emplace_back([this, i]() {
+                return m_mrcs[i].VerifySignature(m_mrc_keys[i], m_last_block_hash);
+            });
+        }
+
+        checks.emplace_back([this]() {
+            return m_claim.VerifySignature(m_claim_key, m_last_block_hash, m_coinstake);
+        });
+
+        return checks;
+    }
+};
+} // Anonymous namespace
+
+// Baseline: verify the signatures one after another as the validator did
+// before it ran them concurrently.
+static void BlockSignaturesSerial(benchmark::Bench& bench)
+{
+    const BlockSignaturesFixture fixture;
+    const std::vector<std::function<bool()>> checks = fixture.Checks();
+
+    bench.Unit("block").Run([&] {
+        bool valid = true;
+
+        for (const auto& check : checks) {
+            valid = check() && valid;
+        }
+
+        assert(valid);
+    });
+}
+
+static void BlockSignaturesConcurrent(benchmark::Bench& bench)
+{
+    const BlockSignaturesFixture fixture;
+    const std::vector<std::function<bool()>> checks = fixture.Checks();
+
+    bench.Unit("block").Run([&] {
+        const std::vector<uint8_t> results = GRC::BlockRewardRules::RunSignatureChecks(checks);
+        assert(std::all_of(results.begin(), results.end(), [](const uint8_t result) { return result; }));
+    });
+}
+
+BENCHMARK(BlockSignaturesSerial);
+BENCHMARK(BlockSignaturesConcurrent);
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "gridcoin/staking/kernel.h"
+#include "main.h"
+#include "random.h"
+
+namespace {
+//! Number of staking candidates evaluated per stake attempt.
+constexpr size_t STAKE_INPUT_COUNT = 1000;
+
+constexpr uint64_t STAKE_MODIFIER = 0x0123456789abcdef;
+constexpr unsigned STAKE_TIME = 1700000000;
+
+std::vector<CTransaction> MakeStakeInputs()
+{
+    FastRandomContext rng(true);
+    std::vector<CTransaction> txs(STAKE_INPUT_COUNT);
+
+    for (auto& tx : txs) {
+        tx.nTime = STAKE_TIME - 86400;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(rng.rand256(), 0);
+        tx.vout.resize(1);
+        tx.vout[0].nValue = rng.randrange(10000 * COIN);
+    }
+
+    return txs;
+}
+} // Anonymous namespace
+
+static void StakeHashV8(benchmark::Bench& bench)
+{
+    const std::vector<CTransaction> txs = MakeStakeInputs();
+
+    bench.Batch(txs.size()).Unit("kernel").Run([&] {
+        for (const auto& tx : txs) {
+            benchmark::DoNotOptimizeAway(
+                GRC::CalculateStakeHashV8(tx.nTime, tx, 0, STAKE_TIME, STAKE_MODIFIER));
+        }
+    });
+}
+
+BENCHMARK(StakeHashV8);
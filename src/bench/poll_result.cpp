@@ -0,0 +1,94 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "gridcoin/voting/result.h"
+#include "random.h"
+#include "tinyformat.h"
+
+#include <vector>
+
+using namespace GRC;
+
+namespace {
+//! Number of votes in a poll with heavy participation.
+constexpr size_t POLL_VOTE_COUNT = 5000;
+
+//! Number of choices in the poll.
+constexpr size_t POLL_CHOICE_COUNT = 8;
+
+//!
+//! \brief A multiple-choice poll and the resolved votes that the vote counter
+//! passes to the poll result after it validates the vote contracts.
+//!
+struct PollResultFixture
+{
+    Poll m_poll;
+    std::vector<PollResult::VoteDetail> m_votes;
+
+    PollResultFixture()
+    {
+        FastRandomContext rng(true);
+
+        Poll::ChoiceList choices;
+
+        for (size_t i = 0; i < POLL_CHOICE_COUNT; ++i) {
+            choices.Add(strprintf("Choice %u", i));
+        }
+
+        m_poll = Poll(
+            PollType::SURVEY,
+            PollWeightType::BALANCE_AND_MAGNITUDE,
+            PollResponseType::MULTIPLE_CHOICE,
+            30,
+            "Benchmark poll",
+            "https://gridcoin.us",
+            "Which choices?",
+            std::move(choices),
+            1700000000,
+            Fraction(1, 567));
+
+        for (size_t i = 0; i < POLL_VOTE_COUNT; ++i) {
+            PollResult::VoteDetail detail;
+            detail.m_amount = rng.randrange(100000 * COIN);
+            detail.m_mining_id = Cpid(rng.randbytes(16));
+            detail.m_magnitude = Magnitude::RoundFrom(rng.randrange(2000));
+            detail.m_ismine = i % 100 == 0 ? ISMINE_SPENDABLE : ISMINE_NO;
+
+            const size_t response_count = 1 + rng.randrange(3);
+
+            for (size_t j = 0; j < response_count; ++j) {
+                detail.m_responses.emplace_back(
+                    rng.randrange(POLL_CHOICE_COUNT),
+                    detail.m_amount / response_count);
+            }
+
+            m_votes.push_back(std::move(detail));
+        }
+    }
+};
+} // Anonymous namespace
+
+//!
+//! \brief Tally resolved votes into a poll result. This is the last step of
+//! VoteCounter::CountVotes(). The earlier steps read and verify signed vote
+//! contracts from the transaction index, so they are not measured here.
+//!
+static void PollResultTallyVotes(benchmark::Bench& bench)
+{
+    const PollResultFixture fixture;
+
+    bench.Batch(POLL_VOTE_COUNT).Unit("vote").Run([&] {
+        PollResult result(fixture.m_poll);
+
+        for (const auto& vote : fixture.m_votes) {
+            result.TallyVote(vote);
+        }
+
+        benchmark::DoNotOptimizeAway(result.m_total_weight);
+    });
+}
+
+BENCHMARK(PollResultTallyVotes);
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "main.h"
+#include "gridcoin/account.h"
+#include "gridcoin/cpid.h"
+#include "random.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace {
+//! Roughly the number of CPIDs with a research account on mainnet.
+constexpr size_t RESEARCH_ACCOUNT_COUNT = 20000;
+
+//!
+//! \brief Research accounts stored in the tally's container and in the hash
+//! map that the tally used before.
+//!
+struct ResearchAccountsFixture
+{
+    std::vector<GRC::Cpid> m_cpids;
+    GRC::ResearchAccountMap m_accounts;
+    std::unordered_map<GRC::Cpid, GRC::ResearchAccount> m_hashed_accounts;
+
+    ResearchAccountsFixture()
+    {
+        FastRandomContext rng(true);
+
+        for (size_t i = 0; i < RESEARCH_ACCOUNT_COUNT; ++i) {
+            const GRC::Cpid cpid(rng.randbytes(16));
+
+            GRC::ResearchAccount account(rng.randrange(1000 * COIN));
+            account.m_total_research_subsidy = rng.randrange(100000 * COIN);
+
+            m_cpids.push_back(cpid);
+            m_accounts[cpid] = account;
+            m_hashed_accounts.emplace(cpid, account);
+        }
+    }
+};
+} // Anonymous namespace
+
+static void ResearchAccountsSum(benchmark::Bench& bench)
+{
+    const ResearchAccountsFixture fixture;
+
+    bench.Unit("scan").Run([&] {
+        benchmark::DoNotOptimizeAway(fixture.m_accounts.TotalAccrual());
+    });
+}
+
+static void ResearchAccountsSumHashMap(benchmark::Bench& bench)
+{
+    const ResearchAccountsFixture fixture;
+
+    bench.Unit("scan").Run([&] {
+        CAmount total = 0;
+
+        for (const auto& account_pair : fixture.m_hashed_accounts) {
+            total += account_pair.second.m_accrual;
+        }
+
+        benchmark::DoNotOptimizeAway(total);
+    });
+}
+
+static void ResearchAccountsFind(benchmark::Bench& bench)
+{
+    const ResearchAccountsFixture fixture;
+
+    bench.Unit("scan").Run([&] {
+        CAmount total = 0;
+
+        for (const auto& cpid : fixture.m_cpids) {
+            total += fixture.m_accounts.find(cpid)->second.m_accrual;
+        }
+
+        benchmark::DoNotOptimizeAway(total);
+    });
+}
+
+BENCHMARK(ResearchAccountsSum);
+BENCHMARK(ResearchAccountsSumHashMap);
+BENCHMARK(ResearchAccountsFind);
@@ -0,0 +1,212 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "fs.h"
+#include "gridcoin/scraper/scraper.h"
+#include "gridcoin/scraper/scraper_net.h"
+#include "random.h"
+
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+
+#include <memory>
+
+// Internal to scraper.cpp:
+extern fs::path pathScraper;
+bool ProcessProjectRacFileByCPID(const std::string& project, const fs::path& file, const std::string& etag,
+                                 BeaconConsensus& Consensus, ScraperVerifiedBeacons& GlobalVerifiedBeaconsCopy,
+                                 ScraperVerifiedBeacons& IncomingVerifiedBeacons, double& all_cpid_total_credit);
+
+namespace {
+//! Roughly the number of whitelisted projects.
+constexpr size_t MANIFEST_PROJECT_COUNT = 20;
+
+//! Roughly the number of CPIDs with credit in a large project's stats part.
+constexpr size_t MANIFEST_CPIDS_PER_PROJECT = 8000;
+
+//! Roughly the number of users in the rac file of a large project.
+constexpr size_t RAC_FILE_USER_COUNT = 50000;
+
+//!
+//! \brief Compress data in the gzip format of the project stats files.
+//!
+std::string GzipCompress(const std::string& data)
+{
+    std::string compressed;
+
+    {
+        boost::iostreams::filtering_ostream out;
+        out.push(boost::iostreams::gzip_compressor());
+        out.push(boost::iostreams::back_inserter(compressed));
+        out << data;
+    }
+
+    return compressed;
+}
+
+//!
+//! \brief A gzipped rac file shaped like the user.gz exports of the BOINC
+//! projects in a temporary scraper directory.
+//!
+//! About a third of the users have an active beacon, so the parser writes
+//! their statistics to the output file.
+//!
+struct RacFileFixture
+{
+    fs::path m_previous_scraper_dir;
+    bool m_previous_explorer;
+    fs::path m_dir;
+    fs::path m_rac_file;
+    BeaconConsensus m_consensus;
+
+    RacFileFixture()
+        : m_previous_scraper_dir(pathScraper)
+        , m_dir(fs::temp_directory_path() / ("bench_gridcoin_" + GetRandHash().GetHex().substr(0, 16)))
+        , m_rac_file(m_dir / "project-user.gz")
+    {
+        fs::create_directories(m_dir);
+        pathScraper = m_dir;
+
+        // Explorer mode keeps the rac file after processing:
+        {
+            LOCK(cs_ScraperGlobals);
+            m_previous_explorer = fExplorer;
+            fExplorer = true;
+        }
+
+        FastRandomContext rng(true);
+        std::string xml = "<users>\n";
+
+        for (size_t i = 0; i < RAC_FILE_USER_COUNT; ++i) {
+            const std::string cpid = HexStr(rng.randbytes(16));
+
+            xml += strprintf(
+                "<user>\n"
+                " <id>%d</id>\n"
+                " <name>user %d</name>\n"
+                " <country>None</country>\n"
+                " <create_time>%d</create_time>\n"
+                " <total_credit>%.6f</total_credit>\n"
+                " <expavg_credit>%.6f</expavg_credit>\n"
+                " <expavg_time>%.6f</expavg_time>\n"
+                " <cpid>%s</cpid>\n"
+                " <teamid>%d</teamid>\n"
+                "</user>\n",
+                i,
+                i,
+                1300000000 + rng.randrange(300000000),
+                rng.randrange(100000000000) / 100.0,
+                rng.randrange(10000000) / 100.0,
+                1600000000 + rng.randrange(10000000) / 100.0,
+                cpid,
+                rng.randrange(1000));
+
+            if (i % 3 == 0) {
+                m_consensus.mBeaconMap[cpid];
+            }
+        }
+
+        xml += "</users>\n";
+
+        fsbridge::ofstream file(m_rac_file, std::ios_base::out | std::ios_base::binary);
+        file << GzipCompress(xml);
+    }
+
+    ~RacFileFixture()
+    {
+        {
+            LOCK(cs_ScraperGlobals);
+            fExplorer = m_previous_explorer;
+        }
+
+        pathScraper = m_previous_scraper_dir;
+
+        boost::system::error_code error;
+        fs::remove_all(m_dir, error);
+    }
+};
+
+//!
+//! \brief A converged manifest with gzipped project stats parts shaped like
+//! the parts published by the scrapers.
+//!
+struct ConvergedManifestFixture
+{
+    std::vector<std::unique_ptr<CSplitBlob::CPart>> m_parts;
+    ConvergedManifest m_manifest;
+
+    ConvergedManifestFixture()
+    {
+        FastRandomContext rng(true);
+
+        for (size_t i = 0; i < MANIFEST_PROJECT_COUNT; ++i) {
+            std::string csv = "#total_credit,expavg_time,expavg_credit,cpid\n";
+
+            for (size_t j = 0; j < MANIFEST_CPIDS_PER_PROJECT; ++j) {
+                csv += strprintf("%d,%d,%.2f,%s\n",
+                    rng.randrange(100000000),
+                    1600000000 + rng.randrange(10000000),
+                    rng.randrange(10000000) / 100.0,
+                    HexStr(rng.randbytes(16)));
+            }
+
+            const std::string compressed = GzipCompress(csv);
+
+            const auto begin = reinterpret_cast<const std::byte*>(compressed.data());
+            SerializeData data(begin, begin + compressed.size());
+
+            auto part = std::make_unique<CSplitBlob::CPart>(Hash(data));
+            part->SetData(std::move(data));
+
+            m_manifest.ConvergedManifestPartPtrsMap.emplace("project_" + std::to_string(i), part.get());
+            m_parts.push_back(std::move(part));
+        }
+
+        m_parts.push_back(std::make_unique<CSplitBlob::CPart>(rng.rand256()));
+        m_manifest.ConvergedManifestPartPtrsMap.emplace("BeaconList", m_parts.back().get());
+    }
+};
+} // Anonymous namespace
+
+static void ScraperStatsFromConvergedManifest(benchmark::Bench& bench)
+{
+    const ConvergedManifestFixture fixture;
+
+    bench.Unit("manifest").Run([&] {
+        const ScraperStatsVerifiedBeaconsTotalCredits stats = GetScraperStatsByConvergedManifest(fixture.m_manifest);
+        benchmark::DoNotOptimizeAway(stats.mScraperStats.size());
+    });
+}
+
+static void ScraperProcessRacFile(benchmark::Bench& bench)
+{
+    RacFileFixture fixture;
+    uint64_t etag = 0;
+
+    bench.Unit("user").Batch(RAC_FILE_USER_COUNT).Run([&] {
+        ScraperVerifiedBeacons global_verified_beacons;
+        ScraperVerifiedBeacons incoming_verified_beacons;
+        double all_cpid_total_credit = 0;
+
+        // Each run writes a stats file with a new ETag in the name. The file
+        // manifest deletes the file of the previous run:
+        const bool processed = ProcessProjectRacFileByCPID(
+            "project",
+            fixture.m_rac_file,
+            ToString(++etag),
+            fixture.m_consensus,
+            global_verified_beacons,
+            incoming_verified_beacons,
+            all_cpid_total_credit);
+
+        benchmark::DoNotOptimizeAway(processed);
+        benchmark::DoNotOptimizeAway(all_cpid_total_credit);
+    });
+}
+
+BENCHMARK(ScraperProcessRacFile);
+BENCHMARK(ScraperStatsFromConvergedManifest);
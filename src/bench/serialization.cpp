@@ -0,0 +1,122 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "main.h"
+#include "random.h"
+#include "streams.h"
+#include "version.h"
+
+namespace {
+//! Number of transactions in the synthetic benchmark block.
+constexpr size_t BLOCK_TX_COUNT = 1000;
+
+CTransaction MakeTransaction(FastRandomContext& rng)
+{
+    CTransaction tx;
+    tx.nTime = 1700000000;
+
+    tx.vin.resize(2);
+    for (auto& txin : tx.vin) {
+        txin.prevout = COutPoint(rng.rand256(), rng.randrange(4));
+        txin.scriptSig = CScript() << std::vector<unsigned char>(72, 0x30) << std::vector<unsigned char>(33, 0x02);
+    }
+
+    tx.vout.resize(2);
+    for (auto& txout : tx.vout) {
+        txout.nValue = rng.randrange(100 * COIN);
+        txout.scriptPubKey = CScript() << OP_DUP << OP_HASH160 << rng.randbytes(20) << OP_EQUALVERIFY << OP_CHECKSIG;
+    }
+
+    return tx;
+}
+
+CBlock MakeBlock()
+{
+    FastRandomContext rng(true);
+
+    CBlock block;
+    block.nVersion = 12;
+    block.nTime = 1700000000;
+    block.nBits = 0x1d00ffff;
+
+    for (size_t i = 0; i < BLOCK_TX_COUNT; ++i) {
+        block.vtx.emplace_back(MakeTransaction(rng));
+    }
+
+    return block;
+}
+} // Anonymous namespace
+
+static void SerializeTransaction(benchmark::Bench& bench)
+{
+    FastRandomContext rng(true);
+    const CTransaction tx = MakeTransaction(rng);
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+
+    bench.Unit("tx").Run([&] {
+        stream.clear();
+        stream << tx;
+        benchmark::DoNotOptimizeAway(stream.size());
+    });
+}
+
+static void DeserializeTransaction(benchmark::Bench& bench)
+{
+    FastRandomContext rng(true);
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << MakeTransaction(rng);
+
+    bench.Unit("tx").Run([&] {
+        CDataStream input(stream);
+        CTransaction tx;
+        input >> tx;
+        benchmark::DoNotOptimizeAway(tx.vin.size());
+    });
+}
+
+static void SerializeBlock(benchmark::Bench& bench)
+{
+    const CBlock block = MakeBlock();
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+
+    bench.Unit("block").Run([&] {
+        stream.clear();
+        stream << block;
+        benchmark::DoNotOptimizeAway(stream.size());
+    });
+}
+
+static void DeserializeBlock(benchmark::Bench& bench)
+{
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << MakeBlock();
+
+    bench.Unit("block").Run([&] {
+        CDataStream input(stream);
+        CBlock block;
+        input >> block;
+        benchmark::DoNotOptimizeAway(block.vtx.size());
+    });
+}
+
+static void TransactionGetHash(benchmark::Bench& bench)
+{
+    FastRandomContext rng(true);
+    const CTransaction tx = MakeTransaction(rng);
+
+    bench.Unit("tx").Run([&] {
+        benchmark::DoNotOptimizeAway(tx.GetHash());
+    });
+}
+
+BENCHMARK(SerializeTransaction);
+BENCHMARK(DeserializeTransaction);
+BENCHMARK(SerializeBlock);
+BENCHMARK(DeserializeBlock);
+BENCHMARK(TransactionGetHash);
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "gridcoin/superblock.h"
+#include "random.h"
+#include "streams.h"
+#include "version.h"
+
+namespace {
+//! Roughly the number of CPIDs with magnitude in a mainnet superblock.
+constexpr size_t SUPERBLOCK_CPID_COUNT = 5000;
+
+//! Roughly the number of whitelisted projects.
+constexpr size_t SUPERBLOCK_PROJECT_COUNT = 20;
+
+GRC::Superblock MakeSuperblock()
+{
+    FastRandomContext rng(true);
+    GRC::Superblock superblock;
+
+    for (size_t i = 0; i < SUPERBLOCK_CPID_COUNT; ++i) {
+        superblock.m_cpids.Add(
+            GRC::Cpid(rng.randbytes(16)),
+            GRC::Magnitude::RoundFrom(rng.randrange(20000) / 10.0));
+    }
+
+    for (size_t i = 0; i < SUPERBLOCK_PROJECT_COUNT; ++i) {
+        superblock.m_projects.Add(
+            "project_" + std::to_string(i),
+            GRC::Superblock::ProjectStats(rng.randrange(1000000000), rng.randrange(1000000), rng.randrange(10000000)));
+    }
+
+    return superblock;
+}
+} // Anonymous namespace
+
+static void SuperblockPack(benchmark::Bench& bench)
+{
+    const GRC::Superblock superblock = MakeSuperblock();
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+
+    bench.Unit("superblock").Run([&] {
+        stream.clear();
+        stream << superblock;
+        benchmark::DoNotOptimizeAway(stream.size());
+    });
+}
+
+static void SuperblockUnpack(benchmark::Bench& bench)
+{
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << MakeSuperblock();
+
+    bench.Unit("superblock").Run([&] {
+        CDataStream input(stream);
+        GRC::Superblock superblock;
+        input >> superblock;
+        benchmark::DoNotOptimizeAway(superblock.m_cpids.size());
+    });
+}
+
+static void SuperblockQuorumHash(benchmark::Bench& bench)
+{
+    const GRC::Superblock superblock = MakeSuperblock();
+
+    bench.Unit("superblock").Run([&] {
+        benchmark::DoNotOptimizeAway(GRC::QuorumHash::Hash(superblock));
+    });
+}
+
+BENCHMARK(SuperblockPack);
+BENCHMARK(SuperblockUnpack);
+BENCHMARK(SuperblockQuorumHash);
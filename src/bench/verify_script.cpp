@@ -0,0 +1,48 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "key.h"
+#include "keystore.h"
+#include "main.h"
+#include "policy/policy.h"
+#include "script.h"
+
+#include <cassert>
+
+// Measure the per-input signature check that ConnectInputs() performs for
+// every input of a block transaction.
+static void VerifyP2PKHSignature(benchmark::Bench& bench)
+{
+    CKey key;
+    key.MakeNewKey(true);
+
+    CBasicKeyStore keystore;
+    keystore.AddKey(key);
+
+    CTransaction tx_from;
+    tx_from.vin.resize(1);
+    tx_from.vout.resize(1);
+    tx_from.vout[0].nValue = 10 * COIN;
+    tx_from.vout[0].scriptPubKey.SetDestination(key.GetPubKey().GetID());
+
+    CTransaction tx_to;
+    tx_to.vin.resize(1);
+    tx_to.vin[0].prevout = COutPoint(tx_from.GetHash(), 0);
+    tx_to.vout.resize(1);
+    tx_to.vout[0].nValue = 9 * COIN;
+    tx_to.vout[0].scriptPubKey.SetDestination(key.GetPubKey().GetID());
+
+    const bool signed_ok = SignSignature(keystore, tx_from, tx_to, 0);
+    assert(signed_ok);
+
+    bench.Unit("input").Run([&] {
+        const bool valid = VerifySignature(tx_from, tx_to, MANDATORY_SCRIPT_VERIFY_FLAGS, 0, 0);
+        assert(valid);
+        benchmark::DoNotOptimizeAway(valid);
+    });
+}
+
+BENCHMARK(VerifyP2PKHSignature);
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "bench/bench.h"
+
+#include "chainparams.h"
+#include "consensus/merkle.h"
+#include "main.h"
+#include "node/blockstorage.h"
+#include "random.h"
+#include "util.h"
+#include "wallet/wallet.h"
+
+#include <cassert>
+
+namespace {
+//! Number of blocks in the rescanned chain.
+constexpr size_t RESCAN_BLOCK_COUNT = 2000;
+
+//! Number of transactions in each block that do not involve the wallet.
+constexpr size_t UNRELATED_TXS_PER_BLOCK = 20;
+
+//!
+//! \brief A chain of proof-of-stake blocks on disk in a temporary data
+//! directory. One of every seven blocks pays the wallet key.
+//!
+class RescanChainFixture
+{
+public:
+    CKey m_key;
+
+    RescanChainFixture()
+    {
+        FastRandomContext rng(true);
+
+        m_path = fs::temp_directory_path() / "bench_rescan" / rng.rand256().ToString();
+        gArgs.ForceSetArg("-datadir", m_path.string());
+        gArgs.ClearPathCache();
+
+        m_key.MakeNewKey(true);
+
+        CScript my_script;
+        my_script.SetDestination(m_key.GetPubKey().GetID());
+        const CScript other_script = CScript() << OP_TRUE;
+
+        m_hashes.resize(RESCAN_BLOCK_COUNT);
+        m_indexes.resize(RESCAN_BLOCK_COUNT);
+
+        LOCK(cs_main);
+
+        m_saved_best = pindexBest;
+
+        for (uint32_t i = 0; i < RESCAN_BLOCK_COUNT; ++i) {
+            CBlock block;
+            block.nTime = 1700000000 + i * 90;
+            block.nBits = 0x1e0fffff;
+            block.hashPrevBlock = i > 0 ? m_hashes[i - 1] : uint256();
+
+            CTransaction coinbase;
+            coinbase.nLockTime = i;
+            coinbase.vin.resize(1);
+            coinbase.vout.resize(1);
+            block.vtx.push_back(coinbase);
+
+            CTransaction coinstake;
+            coinstake.vin.emplace_back(COutPoint(rng.rand256(), 0));
+            coinstake.vout.resize(1);
+            coinstake.vout[0].SetEmpty();
+            coinstake.vout.emplace_back(COIN, other_script);
+            block.vtx.push_back(coinstake);
+
+            if (i % 7 == 0) {
+                CTransaction receive;
+                receive.vin.emplace_back(COutPoint(rng.rand256(), 0));
+                receive.vout.emplace_back(COIN, my_script);
+                block.vtx.push_back(receive);
+            }
+
+            for (size_t j = 0; j < UNRELATED_TXS_PER_BLOCK; ++j) {
+                CTransaction unrelated;
+                unrelated.vin.emplace_back(COutPoint(rng.rand256(), 0));
+                unrelated.vout.emplace_back(COIN, other_script);
+                block.vtx.push_back(unrelated);
+            }
+
+            block.hashMerkleRoot = BlockMerkleRoot(block);
+            m_hashes[i] = block.GetHash();
+
+            CBlockIndex& index = m_indexes[i];
+            index.phashBlock = &m_hashes[i];
+            index.nHeight = i;
+            index.nTime = block.nTime;
+
+            if (i > 0) {
+                index.pprev = &m_indexes[i - 1];
+                m_indexes[i - 1].pnext = &index;
+            }
+
+            const bool written = WriteBlockToDisk(block, index.nFile, index.nBlockPos, Params().MessageStart());
+            assert(written);
+
+            mapBlockIndex[m_hashes[i]] = &index;
+        }
+
+        pindexBest = &m_indexes.back();
+    }
+
+    ~RescanChainFixture()
+    {
+        {
+            LOCK(cs_main);
+
+            for (const auto& hash : m_hashes) {
+                mapBlockIndex.erase(hash);
+            }
+
+            pindexBest = m_saved_best;
+        }
+
+        fs::remove_all(m_path);
+    }
+
+    CBlockIndex* Genesis()
+    {
+        return &m_indexes.front();
+    }
+
+    //!
+    //! \brief Rescan the chain into a new wallet that holds the fixture key.
+    //!
+    void Rescan(unsigned int thread_count)
+    {
+        CWallet wallet;
+
+        {
+            LOCK(wallet.cs_wallet);
+            wallet.AddKey(m_key);
+        }
+
+        wallet.ScanForWalletTransactions(Genesis(), false, thread_count);
+
+        LOCK(wallet.cs_wallet);
+        benchmark::DoNotOptimizeAway(wallet.mapWallet.size());
+    }
+
+private:
+    fs::path m_path;
+    std::vector<uint256> m_hashes;
+    std::vector<CBlockIndex> m_indexes;
+    CBlockIndex* m_saved_best = nullptr;
+};
+} // Anonymous namespace
+
+//!
+//! \brief Rescan with one thread reading blocks. This approximates the serial
+//! rescan that ran before the rescan threads.
+//!
+static void WalletRescanOneThread(benchmark::Bench& bench)
+{
+    RescanChainFixture fixture;
+
+    bench.Batch(RESCAN_BLOCK_COUNT).Unit("block").Run([&] {
+        fixture.Rescan(1);
+    });
+}
+
+static void WalletRescanAllThreads(benchmark::Bench& bench)
+{
+    RescanChainFixture fixture;
+
+    bench.Batch(RESCAN_BLOCK_COUNT).Unit("block").Run([&] {
+        fixture.Rescan(0);
+    });
+}
+
+BENCHMARK(WalletRescanOneThread);
+BENCHMARK(WalletRescanAllThreads);
@@ -10,6 +10,7 @@
 #include "main.h"
 #include "streams.h"
 
+#include <memory>
 #include <string>
 #include <leveldb/db.h>
 #include <leveldb/write_batch.h>
@@ -430,6 +431,44 @@ public:
         return status;
     }
 
+    //!
+    //! \brief Visit the committed entries whose keys begin with the serialized
+    //! form of \p prefix in key order.
+    //!
+    //! Pending writes of an active batch are not visited.
+    //!
+    //! \param prefix  Serializable object that forms the start of the keys.
+    //! \param visitor Called with the key and value streams of each entry. The
+    //! key stream still contains the prefix. Return \c false to stop.
+    //!
+    //! \return \c false if an entry could not be read.
+    //!
+    template <typename P, typename F>
+    bool ScanGenericSerializablesByPrefix(const P& prefix, F&& visitor)
+    {
+        CDataStream ssPrefix(SER_DISK, CLIENT_VERSION);
+        ssPrefix << prefix;
+        const std::string prefix_str = ssPrefix.str();
+
+        std::unique_ptr<leveldb::Iterator> iterator(pdb->NewIterator(leveldb::ReadOptions()));
+
+        for (iterator->Seek(prefix_str); iterator->Valid(); iterator->Next()) {
+            if (!iterator->key().starts_with(prefix_str)) break;
+
+            try {
+                CDataStream ssKey(MakeByteSpan(iterator->key()), SER_DISK, CLIENT_VERSION);
+                CDataStream ssValue(MakeByteSpan(iterator->value()), SER_DISK, CLIENT_VERSION);
+
+                if (!visitor(ssKey, ssValue)) break;
+            } catch (const std::exception& e) {
+                LogPrintf("ERROR: %s: Error %s occurred during prefix scan of LevelDB.", __func__, e.what());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool LoadBlockIndex();
 private:
     bool LoadBlockIndexGuts();
@@ -6,21 +6,17 @@
 #define GRIDCOIN_ACCOUNT_H
 
 #include "amount.h"
+#include "gridcoin/cpid.h"
+
 #include <optional>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 class CBlockIndex;
 
 namespace GRC {
 
-class Cpid;
-class ResearchAccount;
-
-//!
-//! \brief Maps BOINC CPIDs to the accounts that track research reward accrual.
-//!
-typedef std::unordered_map<Cpid, ResearchAccount> ResearchAccountMap;
-
 //!
 //! \brief An optional type that contains a pointer to a block index object or
 //! does not.
@@ -255,6 +251,179 @@ public:
     }
 }; // ResearchAccount
 
+//!
+//! \brief Maps BOINC CPIDs to the accounts that track research reward accrual.
+//!
+//! The tally holds an account for each CPID that earned a reward, about 20000
+//! on mainnet, and several routines visit all of them. This container stores
+//! the accounts contiguously in the order of insertion with a separate index
+//! from each CPID to its position, so these scans walk dense memory instead of
+//! the nodes of a hash table.
+//!
+//! Unlike std::unordered_map, inserting or erasing an account may move others.
+//! Do not hold a reference to an account across either operation.
+//!
+class ResearchAccountMap
+{
+    typedef std::vector<std::pair<Cpid, ResearchAccount>> StorageType;
+
+public:
+    typedef StorageType::value_type value_type;
+    typedef StorageType::iterator iterator;
+    typedef StorageType::const_iterator const_iterator;
+    typedef StorageType::size_type size_type;
+
+    iterator begin() { return m_accounts.begin(); }
+    iterator end() { return m_accounts.end(); }
+    const_iterator begin() const { return m_accounts.begin(); }
+    const_iterator end() const { return m_accounts.end(); }
+
+    size_type size() const { return m_accounts.size(); }
+    bool empty() const { return m_accounts.empty(); }
+
+    //!
+    //! \brief Get the account for the specified CPID.
+    //!
+    //! \return An iterator to the account or end() if it does not exist.
+    //!
+    iterator find(const Cpid& cpid)
+    {
+        const auto iter = m_index.find(cpid);
+
+        if (iter == m_index.end()) {
+            return m_accounts.end();
+        }
+
+        return m_accounts.begin() + iter->second;
+    }
+
+    //!
+    //! \brief Get the account for the specified CPID.
+    //!
+    //! \return An iterator to the account or end() if it does not exist.
+    //!
+    const_iterator find(const Cpid& cpid) const
+    {
+        const auto iter = m_index.find(cpid);
+
+        if (iter == m_index.end()) {
+            return m_accounts.end();
+        }
+
+        return m_accounts.begin() + iter->second;
+    }
+
+    //!
+    //! \brief Get the number of accounts for the specified CPID (0 or 1).
+    //!
+    size_type count(const Cpid& cpid) const
+    {
+        return m_index.count(cpid);
+    }
+
+    //!
+    //! \brief Get the account for the specified CPID and create a new account
+    //! if it does not exist.
+    //!
+    //! Creating an account may reallocate the storage. This invalidates every
+    //! reference, pointer and iterator into the map obtained before.
+    //!
+    ResearchAccount& operator[](const Cpid& cpid)
+    {
+        const auto result = m_index.emplace(cpid, m_accounts.size());
+
+        if (result.second) {
+            m_accounts.emplace_back(cpid, ResearchAccount());
+        }
+
+        return m_accounts[result.first->second].second;
+    }
+
+    //!
+    //! \brief Remove the account for the specified CPID.
+    //!
+    //! The last account moves into the position of the removed account.
+    //!
+    //! \return The number of accounts removed (0 or 1).
+    //!
+    size_type erase(const Cpid& cpid)
+    {
+        const auto iter = m_index.find(cpid);
+
+        if (iter == m_index.end()) {
+            return 0;
+        }
+
+        const size_t position = iter->second;
+
+        m_index.erase(iter);
+
+        if (position + 1 != m_accounts.size()) {
+            m_accounts[position] = std::move(m_accounts.back());
+            m_index[m_accounts[position].first] = position;
+        }
+
+        m_accounts.pop_back();
+
+        return 1;
+    }
+
+    //!
+    //! \brief Remove every account.
+    //!
+    void clear()
+    {
+        m_accounts.clear();
+        m_index.clear();
+    }
+
+    //!
+    //! \brief Allocate space for the specified number of accounts.
+    //!
+    void reserve(const size_type count)
+    {
+        m_accounts.reserve(count);
+        m_index.reserve(count);
+    }
+
+    //!
+    //! \brief Get the sum of the research accrued by every account as of the
+    //! last superblock.
+    //!
+    //! \return Accrual in units of 1/100000000 GRC.
+    //!
+    CAmount TotalAccrual() const
+    {
+        CAmount total = 0;
+
+        for (const auto& account_pair : m_accounts) {
+            total += account_pair.second.m_accrual;
+        }
+
+        return total;
+    }
+
+    //!
+    //! \brief Get the sum of the research rewards paid to every account.
+    //!
+    //! \return Rewards in units of 1/100000000 GRC.
+    //!
+    CAmount TotalResearchSubsidy() const
+    {
+        CAmount total = 0;
+
+        for (const auto& account_pair : m_accounts) {
+            total += account_pair.second.m_total_research_subsidy;
+        }
+
+        return total;
+    }
+
+private:
+    StorageType m_accounts;                   //!< Accounts in insertion order.
+    std::unordered_map<Cpid, size_t> m_index; //!< Positions of the accounts.
+}; // ResearchAccountMap
+
 //!
 //! \brief A traversable range of all the research accounts stored in the tally.
 //!
@@ -302,6 +471,23 @@ public:
         return m_accounts.size();
     }
 
+    //!
+    //! \brief Get the sum of the research accrued by every account as of the
+    //! last superblock.
+    //!
+    CAmount TotalAccrual() const
+    {
+        return m_accounts.TotalAccrual();
+    }
+
+    //!
+    //! \brief Get the sum of the research rewards paid to every account.
+    //!
+    CAmount TotalResearchSubsidy() const
+    {
+        return m_accounts.TotalResearchSubsidy();
+    }
+
 private:
     const StorageType& m_accounts; //!< The accounts stored in the tally.
 };
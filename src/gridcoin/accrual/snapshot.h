@@ -23,6 +23,8 @@
 #include "streams.h"
 #include "tinyformat.h"
 
+#include <algorithm>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 
@@ -63,33 +65,15 @@ public:
     //!
     Allocation GetMagnitudeUnit() const
     {
-        // Fern+ and before V13 magnitude unit is fixed at 1/4.
-        if (!IsV13Enabled(m_superblock.m_height)) {
-            return Allocation(1, 4);
-        }
-
-        Allocation magnitude_unit = Params().GetConsensus().DefaultMagnitudeUnit;
-        Allocation max_magnitude_unit = Params().GetConsensus().MaxMagnitudeUnit;
-
-        // Find the current protocol entry value for Magnitude Weight Factor, if it exists.
-        ProtocolEntryOption protocol_entry = GetProtocolRegistry().TryLastBeforeTimestamp("magnitudeunit", m_superblock.m_timestamp);
-
-        // If their is an entry prior or equal in timestamp to the superblock and it is active then set the magnitude unit
-        // to that value. If the last entry is not active (i.e. deleted), then leave at the default.
-        if (protocol_entry != nullptr && protocol_entry->m_status == ProtocolEntryStatus::ACTIVE) {
-            magnitude_unit = Fraction::FromString(protocol_entry->m_value);
-        }
-
-        // Clamp to MaxMagnitudeUnit if necessary
-        if (magnitude_unit > max_magnitude_unit) {
-            magnitude_unit = max_magnitude_unit;
-            LogPrintf("WARN: %s: Magnitude Unit specified by protocol is greater than %s. Clamping to %s.",
-                      __func__,
-                      max_magnitude_unit.ToString(),
-                      max_magnitude_unit.ToString());
+        // The accrual calculations ask for the magnitude unit several times
+        // for each account, and the tally reuses one calculator for every
+        // account when it applies a superblock. Only look it up once:
+        //
+        if (!m_magnitude_unit) {
+            m_magnitude_unit = LookupMagnitudeUnit();
         }
 
-        return magnitude_unit;
+        return *m_magnitude_unit;
     }
 
     //!
@@ -248,6 +232,43 @@ public:
 protected:
     const int64_t m_payment_time;     //!< Payment time to calculate rewards at.
     const SuperblockPtr m_superblock; //!< Supplies CPID magnitudes.
+    mutable std::optional<Allocation> m_magnitude_unit; //!< Set by the first GetMagnitudeUnit() call.
+
+    //!
+    //! \brief Look up the magnitude unit active at the superblock.
+    //!
+    //! \return Allocation Fraction representing Magnitude Unit.
+    //!
+    Allocation LookupMagnitudeUnit() const
+    {
+        // Fern+ and before V13 magnitude unit is fixed at 1/4.
+        if (!IsV13Enabled(m_superblock.m_height)) {
+            return Allocation(1, 4);
+        }
+
+        Allocation magnitude_unit = Params().GetConsensus().DefaultMagnitudeUnit;
+        Allocation max_magnitude_unit = Params().GetConsensus().MaxMagnitudeUnit;
+
+        // Find the current protocol entry value for Magnitude Weight Factor, if it exists.
+        ProtocolEntryOption protocol_entry = GetProtocolRegistry().TryLastBeforeTimestamp("magnitudeunit", m_superblock.m_timestamp);
+
+        // If their is an entry prior or equal in timestamp to the superblock and it is active then set the magnitude unit
+        // to that value. If the last entry is not active (i.e. deleted), then leave at the default.
+        if (protocol_entry != nullptr && protocol_entry->m_status == ProtocolEntryStatus::ACTIVE) {
+            magnitude_unit = Fraction::FromString(protocol_entry->m_value);
+        }
+
+        // Clamp to MaxMagnitudeUnit if necessary
+        if (magnitude_unit > max_magnitude_unit) {
+            magnitude_unit = max_magnitude_unit;
+            LogPrintf("WARN: %s: Magnitude Unit specified by protocol is greater than %s. Clamping to %s.",
+                      __func__,
+                      max_magnitude_unit.ToString(),
+                      max_magnitude_unit.ToString());
+        }
+
+        return magnitude_unit;
+    }
 
     //!
     //! \brief Get the magnitude of the CPID in the active superblock.
@@ -1554,6 +1575,8 @@ public:
         // Apply snapshot accrual for any CPIDs with no accounting record as
         // of the last superblock:
         //
+        accounts.reserve(accounts.size() + snapshot.m_records.size());
+
         for (const auto& cpid_pair : snapshot.m_records) {
             if (accounts.find(cpid_pair.first) == accounts.end()) {
                 accounts[cpid_pair.first].m_accrual = cpid_pair.second;
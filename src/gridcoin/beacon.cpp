@@ -368,19 +368,18 @@ BeaconOption BeaconRegistry::TryActive(const Cpid& cpid, const int64_t now) cons
 
 std::vector<Beacon_ptr> BeaconRegistry::FindPending(const Cpid& cpid) const
 {
-    // TODO: consider adding a lookup table for pending beacons keyed by CPID.
-    // Since the protocol just needs to look up pending beacons by public key,
-    // we just do a search here. Informational RPCs or local beacon management
-    // only need to call this occasionally.
-
     std::vector<Beacon_ptr> found;
 
-    for (const auto& pending_beacon_pair : m_pending) {
-        const Beacon_ptr& beacon_ptr = pending_beacon_pair.second;
+    const auto cpid_iter = m_pending_by_cpid.find(cpid);
 
-        if (beacon_ptr->m_cpid == cpid) {
-            found.emplace_back(beacon_ptr);
-        }
+    if (cpid_iter == m_pending_by_cpid.end()) {
+        return found;
+    }
+
+    found.reserve(cpid_iter->second.size());
+
+    for (const auto& key_id : cpid_iter->second) {
+        found.emplace_back(m_pending.at(key_id));
     }
 
     return found;
@@ -418,6 +417,8 @@ void BeaconRegistry::Reset()
 {
     m_beacons.clear();
     m_pending.clear();
+    m_pending_by_cpid.clear();
+    m_pending_by_time.clear();
     m_pending_ownership_proofs.clear();
     m_expired_pending.clear();
     m_beacon_db.clear();
@@ -473,6 +474,67 @@ bool BeaconRegistry::TryRenewal(Beacon_ptr& current_beacon_ptr, int& height, con
     return true;
 }
 
+bool BeaconRegistry::InsertPending(Beacon_ptr beacon, const bool replace)
+{
+    const CKeyID key_id = beacon->GetId();
+    const auto iter = m_pending.find(key_id);
+
+    if (iter != m_pending.end()) {
+        if (!replace) {
+            return false;
+        }
+
+        ErasePending(iter);
+    }
+
+    m_pending_by_cpid[beacon->m_cpid].insert(key_id);
+    m_pending_by_time.emplace(beacon->m_timestamp, key_id);
+    m_pending.emplace(key_id, std::move(beacon));
+
+    return true;
+}
+
+BeaconRegistry::PendingBeaconMap::iterator BeaconRegistry::ErasePending(PendingBeaconMap::iterator iter)
+{
+    const CKeyID& key_id = iter->first;
+    const Beacon_ptr& beacon = iter->second;
+
+    const auto cpid_iter = m_pending_by_cpid.find(beacon->m_cpid);
+
+    if (cpid_iter != m_pending_by_cpid.end()) {
+        cpid_iter->second.erase(key_id);
+
+        if (cpid_iter->second.empty()) {
+            m_pending_by_cpid.erase(cpid_iter);
+        }
+    }
+
+    m_pending_by_time.erase(std::make_pair(beacon->m_timestamp, key_id));
+    m_pending_ownership_proofs.erase(key_id);
+
+    return m_pending.erase(iter);
+}
+
+void BeaconRegistry::ErasePending(const CKeyID& key_id)
+{
+    const auto iter = m_pending.find(key_id);
+
+    if (iter != m_pending.end()) {
+        ErasePending(iter);
+    }
+}
+
+void BeaconRegistry::RebuildPendingIndexes()
+{
+    m_pending_by_cpid.clear();
+    m_pending_by_time.clear();
+
+    for (const auto& pending_beacon_pair : m_pending) {
+        m_pending_by_cpid[pending_beacon_pair.second->m_cpid].insert(pending_beacon_pair.first);
+        m_pending_by_time.emplace(pending_beacon_pair.second->m_timestamp, pending_beacon_pair.first);
+    }
+}
+
 void BeaconRegistry::Add(const ContractContext& ctx)
 {
     // Poor man's mock. This is to prevent the tests from polluting the LevelDB database
@@ -564,7 +626,7 @@ void BeaconRegistry::Add(const ContractContext& ctx)
     }
 
     // Insert a pointer to the entry in the m_pending map.
-    m_pending[pending.GetId()] =  m_beacon_db.find(ctx.m_tx.GetHash())->second;
+    InsertPending(m_beacon_db.find(ctx.m_tx.GetHash())->second);
 
     // For v3 payloads, store the ownership proof in the side map keyed by
     // the pending beacon's key ID. The proof data is still valid in the
@@ -587,8 +649,7 @@ void BeaconRegistry::Delete(const ContractContext& ctx)
     const auto payload = ctx->SharePayloadAs<BeaconPayload>();
 
     if (ctx->m_version >= 2) {
-        m_pending.erase(payload->m_beacon.GetId());
-        m_pending_ownership_proofs.erase(payload->m_beacon.GetId());
+        ErasePending(payload->m_beacon.GetId());
     }
 
     auto iter = m_beacons.find(payload->m_cpid);
@@ -604,12 +665,7 @@ void BeaconRegistry::Delete(const ContractContext& ctx)
     }
 
     // If the beacon exists in the pending map, delete the entry.
-    auto iter2 = m_pending.find(payload->m_beacon.m_public_key.GetID());
-
-    if (iter2 != m_pending.end())
-    {
-        m_pending.erase(payload->m_beacon.m_public_key.GetID());
-    }
+    ErasePending(payload->m_beacon.m_public_key.GetID());
 
     Beacon deleted_beacon(payload->m_beacon);
 
@@ -696,8 +752,7 @@ void BeaconRegistry::Revert(const ContractContext& ctx)
                 }
 
                 // Remove the found pending entry and its ownership proof if any.
-                m_pending_ownership_proofs.erase(pending_to_revert->first);
-                m_pending.erase(pending_to_revert);
+                ErasePending(pending_to_revert);
 
                 // Also remove this historical record, because in a revert it should not be retained.
                 m_beacon_db.erase(ctx.m_tx.GetHash());
@@ -804,7 +859,7 @@ void BeaconRegistry::Revert(const ContractContext& ctx)
                 }
                 else if (beacon_to_restore_ptr->m_status == BeaconStatusForStorage::PENDING)
                 {
-                    m_pending[beacon_to_restore_ptr->GetId()] = beacon_to_restore_ptr;
+                    InsertPending(beacon_to_restore_ptr);
                 }
                 else
                 {
@@ -1139,8 +1194,7 @@ void BeaconRegistry::ActivatePending(
 
         // Remove the pending beacon entry from the pending map. (Note this entry still exists in the historical
         // table and the db.
-        m_pending.erase(iter_pair.second->GetId());
-        m_pending_ownership_proofs.erase(iter_pair.second->GetId());
+        ErasePending(iter_pair.second->GetId());
     }
 
     // Clear the expired pending beacon set. There is no need to retain expired beacons beyond one SB boundary (which is when
@@ -1149,7 +1203,9 @@ void BeaconRegistry::ActivatePending(
     m_expired_pending.clear();
 
     // Mark remaining pending beacons that are expired with respect to pending age as expired and move to the expired map.
-    for (auto iter = m_pending.begin(); iter != m_pending.end(); /* no-op */) {
+    // The time index holds the oldest pending beacons first, so the walk stops at the first one that has not expired.
+    while (!m_pending_by_time.empty()) {
+        auto iter = m_pending.find(m_pending_by_time.begin()->second);
         PendingBeacon pending_beacon(*iter->second);
 
         // If the pending beacon has expired with no action remove the pending beacon.
@@ -1183,10 +1239,9 @@ void BeaconRegistry::ActivatePending(
             m_expired_pending.insert(m_beacon_db.find(pending_beacon.m_hash)->second);
 
             // Remove the pending beacon entry from the m_pending map.
-            m_pending_ownership_proofs.erase(iter->first);
-            iter = m_pending.erase(iter);
+            ErasePending(iter);
         } else {
-            ++iter;
+            break;
         }
     }
 }
@@ -1220,8 +1275,7 @@ void BeaconRegistry::Deactivate(const uint256 superblock_hash)
             }
 
             // Resurrect the pending record prior to the activation. This points to the pending record still in the db.
-            m_pending[static_cast<PendingBeacon>(*pending_beacon_entry->second).GetId()] =
-                    pending_beacon_entry->second;
+            InsertPending(pending_beacon_entry->second);
 
             // Erase the entry from the active beacons map. This also increments the iterator.
             iter = m_beacons.erase(iter);
@@ -1245,7 +1299,7 @@ void BeaconRegistry::Deactivate(const uint256 superblock_hash)
         auto pending_beacon_entry = m_beacon_db.find(iter->m_previous_hash);
 
         // Resurrect pending beacon entry
-        if (!m_pending.insert(std::make_pair(pending_beacon_entry->second->GetId(), pending_beacon_entry->second)).second) {
+        if (!InsertPending(pending_beacon_entry->second, false)) {
             LogPrintf("WARN: %s: Resurrected pending beacon entry, hash %s, from expired pending beacon for cpid %s during deactivation "
                       " of superblock hash %s already exists in the pending beacon map corresponding to beacon address %s.",
                       __func__,
@@ -1427,6 +1481,8 @@ int BeaconRegistry::Initialize()
 {
     int height = m_beacon_db.Initialize(m_beacons, m_pending, m_expired_pending, m_beacon_first_entries, false);
 
+    RebuildPendingIndexes();
+
     LogPrint(LogFlags::BEACON, "INFO: %s: m_beacon_db size after load: %u", __func__, m_beacon_db.size());
     LogPrint(LogFlags::BEACON, "INFO: %s: m_beacons size after load: %u", __func__, m_beacons.size());
 
@@ -1437,6 +1493,8 @@ void BeaconRegistry::ResetInMemoryOnly()
 {
     m_beacons.clear();
     m_pending.clear();
+    m_pending_by_cpid.clear();
+    m_pending_by_time.clear();
     m_pending_ownership_proofs.clear();
     m_expired_pending.clear();
     m_beacon_db.clear_in_memory_only();
@@ -14,7 +14,9 @@
 #include "gridcoin/cpid.h"
 #include "gridcoin/support/enumbytes.h"
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class CTransaction;
@@ -907,6 +909,23 @@ private:
     BeaconMap m_beacons;        //!< Contains the active registered beacons.
     PendingBeaconMap m_pending; //!< Contains beacons awaiting verification.
 
+    //!
+    //! \brief Key IDs of the pending beacons in m_pending grouped by CPID.
+    //!
+    //! Serves FindPending() without a scan of every pending beacon. Kept in
+    //! step with m_pending by InsertPending() and ErasePending().
+    //!
+    std::unordered_map<Cpid, std::set<CKeyID>> m_pending_by_cpid;
+
+    //!
+    //! \brief Key IDs of the pending beacons in m_pending ordered by beacon
+    //! timestamp.
+    //!
+    //! ActivatePending() walks this set from the oldest entry to find pending
+    //! beacons that exceed the retention age instead of checking every one.
+    //!
+    std::set<std::pair<int64_t, CKeyID>> m_pending_by_time;
+
     //!
     //! \brief In-memory side map of ownership proofs for pending beacons.
     //!
@@ -952,6 +971,40 @@ private:
     //!
     bool TryRenewal(Beacon_ptr& current_beacon_ptr, int& height, const BeaconPayload& payload);
 
+    //!
+    //! \brief Add a beacon to the pending beacon map and its indexes.
+    //!
+    //! \param beacon  Pending beacon to add.
+    //! \param replace Whether to replace a pending beacon with the same key ID.
+    //!
+    //! \return \c false if the map already contains a pending beacon with the
+    //! same key ID and \p replace is \c false.
+    //!
+    bool InsertPending(Beacon_ptr beacon, const bool replace = true);
+
+    //!
+    //! \brief Remove a beacon and its ownership proof from the pending beacon
+    //! map and its indexes.
+    //!
+    //! \param iter Points to the pending beacon to remove.
+    //!
+    //! \return An iterator to the pending beacon that follows the removed one.
+    //!
+    PendingBeaconMap::iterator ErasePending(PendingBeaconMap::iterator iter);
+
+    //!
+    //! \brief Remove the pending beacon with the specified key ID if it exists.
+    //!
+    //! \param key_id Identifies the pending beacon to remove.
+    //!
+    void ErasePending(const CKeyID& key_id);
+
+    //!
+    //! \brief Rebuild the pending beacon indexes from the pending beacon map.
+    //! This is used after the beacon database loads m_pending directly.
+    //!
+    void RebuildPendingIndexes();
+
 public:
     //!
     //! \brief Gets a reference to beacon database.
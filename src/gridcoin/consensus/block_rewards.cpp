@@ -18,10 +18,20 @@
 #include "validation.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <optional>
+#include <thread>
 
 using namespace GRC;
 
+namespace {
+//!
+//! \brief Maximum number of threads that verify the signatures in a block.
+//!
+constexpr unsigned int MAX_SIGNATURE_THREADS = 4;
+} // anonymous namespace
+
 BlockRewardRules::BlockRewardRules(
     const CBlockIndex* pindex_prev,
     int block_version,
@@ -316,11 +326,136 @@ bool BlockRewardRules::Check(std::string& error_out) const
 
     const Claim& claim = m_block->GetClaim();
 
+    // Verify the signatures up front so that the serial checks below only
+    // look up results. The checks run in the same order as before, so they
+    // report the same first error:
+    //
+    VerifySignatures();
+
     return claim.HasResearchReward()
         ? CheckResearcherClaim(error_out)
         : CheckNoncruncherClaim(error_out);
 }
 
+// -----------------------------------------------------------------------------
+// VerifySignatures — concurrent beacon signature verification
+// -----------------------------------------------------------------------------
+
+std::vector<uint8_t> BlockRewardRules::RunSignatureChecks(
+    const std::vector<std::function<bool()>>& checks)
+{
+    std::vector<uint8_t> results(checks.size(), 0);
+    std::atomic<size_t> next_check { 0 };
+
+    const auto worker = [&]() {
+        for (size_t i = next_check++; i < checks.size(); i = next_check++) {
+            results[i] = checks[i]();
+        }
+    };
+
+    const size_t thread_count = std::min<size_t>(
+        std::clamp(std::thread::hardware_concurrency(), 1u, MAX_SIGNATURE_THREADS),
+        std::max<size_t>(checks.size(), 1));
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < thread_count; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return results;
+}
+
+void BlockRewardRules::VerifySignatures() const
+{
+    const Claim& claim = m_block->GetClaim();
+    const uint256 last_block_hash = m_pindex->pprev->GetBlockHash();
+
+    m_claim_signature_verified = false;
+    m_verified_mrc_signatures.clear();
+
+    // The beacon lookups read the registries, so they stay on this thread.
+    // They select the same keys as the serial checks. ValidateMRC() checks
+    // MRCs against the beacons active at the time of the previous block:
+    //
+    std::vector<std::pair<MRC, CPubKey>> mrcs;
+
+    if (m_block_version >= 12
+        && !claim.m_mrc_tx_map.empty()
+        && claim.m_mrc_tx_map.size() <= GetMRCOutputLimit(m_block_version, false))
+    {
+        std::set<uint256> mrc_txids;
+
+        for (const auto& mrc_entry : claim.m_mrc_tx_map) {
+            mrc_txids.insert(mrc_entry.second);
+        }
+
+        for (const auto& tx : m_block->vtx) {
+            if (!mrc_txids.count(tx.GetHash())) continue;
+
+            for (const auto& contract : tx.GetContracts()) {
+                if (contract.m_type != ContractType::MRC) continue;
+
+                MRC mrc = contract.CopyPayloadAs<MRC>();
+
+                if (const CpidOption cpid = mrc.m_mining_id.TryCpid()) {
+                    if (const BeaconOption beacon = GetBeaconRegistry().TryActive(*cpid, m_pindex->pprev->nTime)) {
+                        mrcs.emplace_back(std::move(mrc), beacon->m_public_key);
+                    }
+                }
+            }
+        }
+    }
+
+    // CheckBeaconSignature() runs for researcher claims in version 9+ blocks:
+    std::optional<CPubKey> claim_key;
+
+    if (m_block_version > 8 && claim.HasResearchReward()) {
+        if (const CpidOption cpid = claim.m_mining_id.TryCpid()) {
+            const int64_t now = m_block_version >= 11 ? m_block_time : m_pindex->pprev->nTime;
+
+            if (const BeaconOption beacon = GetBeaconRegistry().TryActive(*cpid, now)) {
+                claim_key = beacon->m_public_key;
+            }
+        }
+    }
+
+    std::vector<std::function<bool()>> checks;
+    checks.reserve(mrcs.size() + 1);
+
+    for (const auto& [mrc, public_key] : mrcs) {
+        checks.emplace_back([&mrc = mrc, &public_key = public_key, &last_block_hash]() {
+            return mrc.VerifySignature(public_key, last_block_hash);
+        });
+    }
+
+    if (claim_key) {
+        checks.emplace_back([this, &claim, &claim_key, &last_block_hash]() {
+            return claim.VerifySignature(*claim_key, last_block_hash, m_block->vtx[1]);
+        });
+    }
+
+    if (checks.empty()) {
+        return;
+    }
+
+    const std::vector<uint8_t> results = RunSignatureChecks(checks);
+
+    for (size_t i = 0; i < mrcs.size(); ++i) {
+        if (results[i]) {
+            m_verified_mrc_signatures.insert(mrcs[i].first.GetHash());
+        }
+    }
+
+    m_claim_signature_verified = claim_key && results.back();
+}
+
 // -----------------------------------------------------------------------------
 // CheckNoncruncherClaim
 // -----------------------------------------------------------------------------
@@ -580,7 +715,9 @@ bool BlockRewardRules::CheckMRCRewards(
                                 *cpid, mrc_index->nTime);
 
                             if (beacon) {
-                                if (!ValidateMRC(m_pindex->pprev, mrc)) {
+                                if (!ValidateMRC(m_pindex->pprev, mrc,
+                                                 m_verified_mrc_signatures.count(mrc.GetHash()) > 0))
+                                {
                                     error_out = "An MRC in the claim failed to validate";
                                     return false;
                                 }
@@ -729,10 +866,11 @@ bool BlockRewardRules::CheckBeaconSignature(std::string& error_out) const
     const int64_t now = m_block_version >= 11 ? m_block_time : m_pindex->pprev->nTime;
 
     if (const BeaconOption beacon = GetBeaconRegistry().TryActive(*cpid, now)) {
-        if (claim.VerifySignature(
-            beacon->m_public_key,
-            m_pindex->pprev->GetBlockHash(),
-            m_block->vtx[1]))
+        if (m_claim_signature_verified
+            || claim.VerifySignature(
+                beacon->m_public_key,
+                m_pindex->pprev->GetBlockHash(),
+                m_block->vtx[1]))
         {
             return true;
         }
@@ -9,7 +9,11 @@
 #include "gridcoin/consensus/mutable_transaction.h"
 #include "gridcoin/sidestake.h"
 #include "script.h"
+#include "uint256.h"
 
+#include <cstdint>
+#include <functional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -75,6 +79,20 @@ public:
     //!
     bool Check(std::string& error_out) const;
 
+    //! Run independent signature checks concurrently.
+    //!
+    //! Check() verifies the MRC signatures and the claim signature of a block
+    //! with this before it runs the serial checks, which then reuse the
+    //! results. Each check depends only on its own inputs, so the results do
+    //! not depend on the number of threads or on the order they finish in.
+    //!
+    //! \param checks Signature verifications that must not throw.
+    //!
+    //! \return One flag for each check, in the same order, set if it passed.
+    //!
+    static std::vector<uint8_t> RunSignatureChecks(
+        const std::vector<std::function<bool()>>& checks);
+
     // --- Shared spec types ---------------------------------------------------
 
     //! A single eligible mandatory sidestake with pre-computed required amount.
@@ -200,6 +218,15 @@ private:
     CAmount m_fees;
     uint64_t m_coin_age;
 
+    // Signatures that passed the concurrent verification run by Check(). The
+    // serial checks skip verifying these again.
+    mutable bool m_claim_signature_verified = false;
+    mutable std::set<uint256> m_verified_mrc_signatures;
+
+    //! Verify the beacon signatures of the block concurrently and record the
+    //! ones that passed.
+    void VerifySignatures() const;
+
     // --- Full validation sub-checks ------------------------------------------
 
     bool CheckResearcherClaim(std::string& error_out) const;
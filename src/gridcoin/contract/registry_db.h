@@ -10,6 +10,8 @@
 #include "gridcoin/contract/payload.h"
 #include "gridcoin/support/enumbytes.h"
 
+#include <deque>
+
 using LogFlags = BCLog::LogFlags;
 
 namespace GRC {
@@ -53,6 +55,12 @@ public:
     //!
     const uint32_t m_version;
 
+    //!
+    //! \brief Number of historical entries loaded on demand by find() that are kept in memory when no registry map
+    //! references them. Beyond this, find() drops the oldest such entries, which LevelDB can supply again.
+    //!
+    static constexpr size_t MAX_LOADED_HISTORICAL_ENTRIES = 1000;
+
     typedef const std::shared_ptr<E> entry_ptr;
 
     typedef const entry_ptr entry_option;
@@ -61,6 +69,9 @@ public:
     //! \brief Initializes the template registry entry map structures from the replay of the entry states stored
     //! in the entry database.
     //!
+    //! Only the entries that end up in the current state maps stay in memory. Other historical entries remain in
+    //! LevelDB, and find() loads them by hash when a revert or a history walk needs them.
+    //!
     //! \param entries The map of current entries.
     //! \param pending_entries. The map of pending entries. This is not used in the general template, only in the beacons
     //! specialization.
@@ -153,10 +164,14 @@ public:
 
         uint64_t recnum_high_watermark = 0;
         uint64_t number_passivated = 0;
+        uint64_t number_not_resident = 0;
 
-        for (const auto& iter : storage_by_record_num) {
-            const uint64_t& recnum = iter.first;
-            const E& entry = iter.second;
+        // Each storage record is released once replayed so the replay does not hold two copies of the history.
+        for (auto iter = storage_by_record_num.begin();
+             iter != storage_by_record_num.end();
+             iter = storage_by_record_num.erase(iter)) {
+            const uint64_t& recnum = iter->first;
+            const E& entry = iter->second;
 
             recnum_high_watermark = std::max(recnum_high_watermark, recnum);
 
@@ -173,24 +188,34 @@ public:
                      recnum
                      );
 
-            // Insert the entry into the historical map.
-            m_historical[iter.second.m_hash] = std::make_shared<E>(entry);
-            entry_ptr& historical_entry_ptr = m_historical[iter.second.m_hash];
+            entry_ptr historical_entry_ptr = std::make_shared<E>(entry);
 
             HandleCurrentHistoricalEntries(entries, pending_entries, expired_entries, first_entries, entry,
                                                 historical_entry_ptr, recnum, key_type, populate_first_entries);
 
             number_passivated += (uint64_t) HandlePreviousHistoricalEntries(historical_entry_ptr);
+
+            // Keep the entry in the historical map only if a current state map references it. The rest stay in LevelDB
+            // and find() loads them on demand.
+            if (historical_entry_ptr.use_count() > 1) {
+                m_historical[entry.m_hash] = historical_entry_ptr;
+            } else {
+                m_historical.erase(entry.m_hash);
+                ++number_not_resident;
+            }
         } // storage_by_record_num iteration
 
-        LogPrint(LogFlags::CONTRACT, "INFO: %s: number of historical records passivated: %" PRId64 ".",
+        LogPrint(LogFlags::CONTRACT, "INFO: %s: number of historical records passivated: %" PRId64 ", not loaded into "
+                                     "memory: %" PRId64 ".",
                  __func__,
-                 number_passivated);
+                 number_passivated,
+                 number_not_resident);
 
         // Set the in-memory record number stored variable to the highest recnum encountered during the replay above.
         m_recnum_stored = recnum_high_watermark;
 
-        // Set the needs passivation flag to true, because the one-by-one passivation done above may not catch everything.
+        // Set the needs passivation flag to true, because entries kept above can be superseded later in the replay by
+        // entries that do not refer to them.
         m_needs_passivation = true;
 
         return height;
@@ -278,6 +303,7 @@ public:
     void clear_in_memory_only()
     {
         m_historical.clear();
+        m_loaded.clear();
         m_database_init = false;
         m_height_stored = 0;
         m_recnum_stored = 0;
@@ -599,6 +625,9 @@ public:
             // If the load from LevelDB is successful, insert into the historical map and return the iterator.
             if (Load(hash, entry)) {
                 iter = m_historical.insert(std::make_pair(hash, std::make_shared<E>(entry))).first;
+                m_loaded.push_back(hash);
+
+                TrimLoaded(iter);
 
                 // Set the needs passivation flag to true
                 m_needs_passivation = true;
@@ -641,6 +670,12 @@ private:
     //!
     H m_historical;
 
+    //!
+    //! \brief Hashes of the entries loaded from LevelDB by find(), oldest first. This bounds the memory used by
+    //! history walks and deep reverts between the scheduled passivations.
+    //!
+    std::deque<uint256> m_loaded;
+
     //!
     //! \brief Boolan to indicate whether the database has been successfully initialized from LevelDB during
     //! startup.
@@ -682,6 +717,25 @@ private:
     //!
     const std::string KeyType();
 
+    //!
+    //! \brief Drop the oldest entries loaded by find() from memory until the limit is met. Entries that a registry map
+    //! references stay in the historical map, but are no longer counted against the limit.
+    //!
+    //! \param keep The entry just loaded, which find() returns an iterator to. It is never dropped.
+    //!
+    void TrimLoaded(const typename H::iterator& keep)
+    {
+        while (m_loaded.size() > MAX_LOADED_HISTORICAL_ENTRIES) {
+            auto iter = m_historical.find(m_loaded.front());
+
+            if (iter != m_historical.end() && iter != keep && iter->second.use_count() == 1) {
+                m_historical.erase(iter);
+            }
+
+            m_loaded.pop_front();
+        }
+    }
+
     //!
     //! \brief Store an entry object in LevelDB with the provided key value.
     //!
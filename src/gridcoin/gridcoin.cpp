@@ -3,6 +3,7 @@
 // file COPYING or https://opensource.org/licenses/mit-license.php.
 
 #include "chainparams.h"
+#include "gridcoin/scraper/part_store.h"
 #include "gridcoin/scraper/scraper_registry.h"
 #include "main.h"
 #include "util/threadnames.h"
@@ -332,6 +333,15 @@ void InitializeScraper(ThreadHandlerPtr threads)
         nActiveBeforeSB = std::clamp<int64_t>(gArgs.GetArg("-activebeforesb", 14400), 300, 86400);
     }
 
+    // Keep the data of manifest parts on disk and cache only the recently
+    // used parts in memory:
+    const int64_t part_cache_mib = std::max<int64_t>(
+        gArgs.GetArg("-scraperpartcache", ScraperPartStore::DEFAULT_CACHE_SIZE), 0);
+
+    if (!GetScraperPartStore().Open(GetDataDir() / "Scraper" / "parts", part_cache_mib << 20)) {
+        LogPrintf("WARN: %s: scraper parts will be held in memory", __func__);
+    }
+
     // Run the scraper or subscriber housekeeping thread, but not both. The
     // subscriber housekeeping thread checks if the flag for the scraper thread
     // is true, and basically becomes a no-op, but it is silly to run it if the
@@ -13,6 +13,7 @@
 #include "gridcoin/scraper/scraper_net.h"
 #include "gridcoin/superblock.h"
 #include "node/blockstorage.h"
+#include "util/perfstats.h"
 #include "util/reverse_iterator.h"
 #include <util/string.h>
 
@@ -34,6 +35,8 @@ extern CCriticalSection cs_ScraperGlobals;
 extern CCriticalSection cs_ConvergedScraperStatsCache;
 extern ConvergedScraperStats ConvergedScraperStatsCache;
 
+static LatencyHistogram g_latency_validate_superblock("ValidateSuperblock"); //!< Reported by getperfstats.
+
 namespace {
 //!
 //! \brief Organizes superblocks for lookup to calculate research rewards.
@@ -1595,6 +1598,8 @@ bool Quorum::ValidateSuperblock(
 {
     using Result = SuperblockValidator::Result;
 
+    ScopedLatency latency(g_latency_validate_superblock);
+
     const Result result = SuperblockValidator(superblock, hint_bits).Validate(use_cache);
     std::string message;
 
@@ -1650,40 +1655,23 @@ std::vector<ExplainMagnitudeProject> Quorum::ExplainMagnitude(const Cpid cpid)
     // Get a read-only view of the current project greylist
     const WhitelistSnapshot greylist = GetWhitelist().Snapshot(GRC::ProjectEntry::ProjectFilterFlag::GREYLISTED, false, true);
 
-    const std::string cpid_str = cpid.ToString();
-    const Span<const char> cpid_span = Span{cpid_str};
-
-    // Compare the stats entry CPID and return the project name if it matches:
-    const auto try_item = [&](const std::string& object_id) {
-        const Span<const char> id_span = Span{object_id};
-        const Span<const char> cpid_subspan = id_span.last(32);
-
-        if (cpid_subspan != cpid_span) {
-            return Span<const char>();
-        }
-
-        return id_span.first(id_span.size() - 33);
-    };
-
     std::vector<ExplainMagnitudeProject> projects;
 
     LOCK(cs_ConvergedScraperStatsCache);
 
-    // Although the map is ordered, the keys begin with project names, so we
-    // cannot binary search for a block of CPID entries yet:
-    //
-    for (const auto& entry : ConvergedScraperStatsCache.mScraperConvergedStats.mScraperStats) {
-        if (entry.first.objecttype == statsobjecttype::byCPIDbyProject) {
-            const Span<const char> project_name = try_item(entry.first.objectID);
-
-            std::string s_project_name = std::string(project_name.begin(), project_name.end());
+    const ScraperStatsTable& stats = ConvergedScraperStatsCache.mScraperConvergedStats.mScraperStats;
 
-            if (project_name.size() > 0 && !greylist.Contains(s_project_name)) {
-                projects.emplace_back(
-                    std::string(project_name.begin(), project_name.end()),
-                    entry.second.statsvalue.dRAC,
-                    entry.second.statsvalue.dMag);
-            }
+    // The byCPIDbyProject entries are sorted by project and then by CPID, so
+    // we can binary search for the CPID in each project's block of entries:
+    //
+    for (ScraperStatsTable::ProjectIndex i = 0; i < stats.Projects().size(); ++i) {
+        const ScraperStatsTable::ProjectCpidEntry* entry = stats.Find(i, cpid);
+
+        if (entry != nullptr && !greylist.Contains(stats.ProjectName(i))) {
+            projects.emplace_back(
+                stats.ProjectName(i),
+                entry->statsvalue.dRAC,
+                entry->statsvalue.dMag);
         }
     }
 
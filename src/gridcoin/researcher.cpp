@@ -246,34 +246,145 @@ std::optional<std::string> ReadClientStateXml()
 }
 
 //!
-//! \brief Load a set of project XML sections from BOINC's client_state.xml
-//! file to gather CPIDs from.
+//! \brief Extract the project XML sections from the contents of BOINC's
+//! client_state.xml file to gather CPIDs from.
 //!
-//! \return Items containing the XML between each \c <project>...</project>
-//! section present in the client_state.xml file or an empty container when
-//! the file is not accessible or contains no project elements.
+//! The file also holds the state of every task, so this copies only the XML
+//! between each \c <project> and \c </project> tag in one pass.
 //!
-std::vector<std::string> FetchProjectsXml()
+//! \param client_state_xml The entire client_state.xml file.
+//!
+//! \return Items containing the XML of each project section present in the
+//! file or an empty container when the file contains no project elements.
+//!
+std::vector<std::string> ExtractProjectsXml(const std::string& client_state_xml)
+{
+    static const std::string open_tag = "<project>";
+    static const std::string close_tag = "</project>";
+
+    std::vector<std::string> projects;
+    std::string::size_type pos = client_state_xml.find(open_tag);
+
+    while (pos != std::string::npos) {
+        pos += open_tag.size();
+
+        const std::string::size_type end = client_state_xml.find(close_tag, pos);
+
+        projects.emplace_back(client_state_xml, pos, end == std::string::npos ? end : end - pos);
+
+        if (end == std::string::npos) {
+            break;
+        }
+
+        pos = client_state_xml.find(open_tag, end + close_tag.size());
+    }
+
+    if (projects.empty()) {
+        LogPrintf("BOINC is not attached to any projects. No CPIDs loaded.");
+    }
+
+    return projects;
+}
+
+//!
+//! \brief Projects parsed from BOINC's client_state.xml file by the last reload
+//! and the inputs that they depend on.
+//!
+struct ClientStateMemo
+{
+    fs::path m_path;              //!< Location of the file.
+    std::time_t m_mtime = 0;      //!< Modification time of the file.
+    uintmax_t m_size = 0;         //!< Size of the file in bytes.
+    bool m_stat_settled = false;  //!< Whether a later write must change m_mtime.
+    uint256 m_hash;               //!< Hash of the file contents.
+    std::string m_email;          //!< Email address used to verify the CPIDs.
+    bool m_pool_operator = false; //!< Value of -pooloperator used for the parse.
+    MiningProjectMap m_projects;  //!< Projects parsed from the file.
+};
+
+Mutex cs_client_state_memo;
+std::optional<ClientStateMemo> g_client_state_memo GUARDED_BY(cs_client_state_memo);
+
+//!
+//! \brief Load the mining projects from BOINC's client_state.xml file.
+//!
+//! BOINC rewrites the file often, but the project sections rarely change. The
+//! parsed projects are reused without reading the file when its modification
+//! time and size did not change, and without parsing it when its contents hash
+//! to the same value as the last parse.
+//!
+//! \return The projects present in the file or an empty map when the file is
+//! not accessible or contains no project elements. The team whitelist is not
+//! yet applied.
+//!
+MiningProjectMap LoadMiningProjects()
 {
+    const fs::path path = GetBoincDataDir() / "client_state.xml";
+    const std::string email = Researcher::Email();
+    const bool pool_operator = gArgs.GetBoolArg("-pooloperator", false);
+
+    // The modification time has a resolution of one second. A write later in
+    // the same second as the check does not change it, so the check trusts a
+    // modification time only if it is older than the second of the check:
+    //
+    const int64_t now = GetTime();
+
+    boost::system::error_code ec;
+    const std::time_t mtime = fs::last_write_time(path, ec);
+    const uintmax_t size = ec ? 0 : fs::file_size(path, ec);
+    const bool stat_ok = !ec;
+    const bool stat_settled = stat_ok && mtime < now;
+
+    LOCK(cs_client_state_memo);
+
+    const bool memo_matches = g_client_state_memo
+        && g_client_state_memo->m_path == path
+        && g_client_state_memo->m_email == email
+        && g_client_state_memo->m_pool_operator == pool_operator;
+
+    if (memo_matches
+        && stat_ok
+        && g_client_state_memo->m_stat_settled
+        && g_client_state_memo->m_mtime == mtime
+        && g_client_state_memo->m_size == size)
+    {
+        LogPrint(BCLog::LogFlags::VERBOSE, "INFO: %s: client_state.xml unchanged.", __func__);
+        return g_client_state_memo->m_projects;
+    }
+
     const std::optional<std::string> client_state_xml = ReadClientStateXml();
 
     if (!client_state_xml) {
-        return { };
+        g_client_state_memo.reset();
+        return MiningProjectMap();
     }
 
-    std::vector<std::string> projects = split(*client_state_xml, "<project>");
+    const uint256 hash = Hash(*client_state_xml);
 
-    if (projects.size() < 2) {
-        LogPrintf("BOINC is not attached to any projects. No CPIDs loaded.");
-        return { };
+    if (memo_matches && g_client_state_memo->m_hash == hash) {
+        LogPrint(BCLog::LogFlags::VERBOSE, "INFO: %s: client_state.xml contents unchanged.", __func__);
+
+        g_client_state_memo->m_mtime = mtime;
+        g_client_state_memo->m_size = size;
+        g_client_state_memo->m_stat_settled = stat_settled;
+
+        return g_client_state_memo->m_projects;
     }
 
-    // Drop the first element which never contains a project:
-    //
-    std::swap(projects.front(), projects.back());
-    projects.pop_back();
+    ClientStateMemo memo;
 
-    return projects;
+    memo.m_path = path;
+    memo.m_mtime = mtime;
+    memo.m_size = size;
+    memo.m_stat_settled = stat_settled;
+    memo.m_hash = hash;
+    memo.m_email = email;
+    memo.m_pool_operator = pool_operator;
+    memo.m_projects = MiningProjectMap::Parse(ExtractProjectsXml(*client_state_xml));
+
+    g_client_state_memo = std::move(memo);
+
+    return g_client_state_memo->m_projects;
 }
 
 //!
@@ -894,17 +1005,35 @@ MiningProject::MiningProject(std::string name,
 
 MiningProject MiningProject::Parse(const std::string& xml)
 {
+    // Scan the project section once for every element used below:
+    //
+    std::array<std::string, 8> elements = ExtractXMLElements(xml, {
+        "user_expavg_credit",
+        "project_name",
+        "external_cpid",
+        "team_name",
+        "master_url",
+        "email_hash",
+        "cross_project_id",
+        "user_name",
+    });
+
+    const std::string& external_cpid = elements[2];
+    const std::string& email_hash = elements[5];
+    const std::string& internal_cpid = elements[6];
+    const std::string& user_name = elements[7];
+
     double rac = 0.0;
 
-    if (!ParseDouble(ExtractXML(xml, "<user_expavg_credit>", "</user_expavg_credit>"), &rac)) {
+    if (!ParseDouble(elements[0], &rac)) {
         LogPrintf("WARN: %s: Unable to parse user RAC from legacy XML data.", __func__);
     }
 
     MiningProject project(
-        ExtractXML(xml, "<project_name>", "</project_name>"),
-        Cpid::Parse(ExtractXML(xml, "<external_cpid>", "</external_cpid>")),
-        ExtractXML(xml, "<team_name>", "</team_name>"),
-        ExtractXML(xml, "<master_url>", "</master_url>"),
+        std::move(elements[1]),
+        Cpid::Parse(external_cpid),
+        std::move(elements[3]),
+        std::move(elements[4]),
         rac);
 
     if (IsPoolCpid(project.m_cpid) && !gArgs.GetBoolArg("-pooloperator", false)) {
@@ -913,18 +1042,12 @@ MiningProject MiningProject::Parse(const std::string& xml)
     }
 
     if (project.m_cpid.IsZero()) {
-        const std::string external_cpid
-            = ExtractXML(xml, "<external_cpid>", "</external_cpid>");
-
         // Old BOINC server versions may not provide an external CPID element
         // in client_state.xml. For these cases, we'll recompute the external
         // CPID of the project from the internal CPID and email address:
         //
         if (external_cpid.empty()) {
-            if (const std::optional<Cpid> cpid = FallbackToCpidByEmail(
-                ExtractXML(xml, "<email_hash>", "</email_hash>"),
-                ExtractXML(xml, "<cross_project_id>", "</cross_project_id>")))
-            {
+            if (const std::optional<Cpid> cpid = FallbackToCpidByEmail(email_hash, internal_cpid)) {
                 project.m_cpid = *cpid;
                 return project;
             }
@@ -937,9 +1060,7 @@ MiningProject MiningProject::Parse(const std::string& xml)
         // "malformed CPID" notice to pool users for BOINC servers that do
         // not reply with an external CPID:
         //
-        if (IsPoolUsername(ExtractXML(xml, "<user_name>", "</user_name>"))
-            && !gArgs.GetBoolArg("-pooloperator", false))
-        {
+        if (IsPoolUsername(user_name) && !gArgs.GetBoolArg("-pooloperator", false)) {
             project.m_error = MiningProject::Error::POOL;
             return project;
         }
@@ -957,10 +1078,7 @@ MiningProject MiningProject::Parse(const std::string& xml)
     // We compare the digest of the internal CPID and email address to the
     // external CPID as a smoke test to avoid running with corrupted CPIDs.
     //
-    if (!project.m_cpid.Matches(
-        ExtractXML(xml, "<cross_project_id>", "</cross_project_id>"),
-        Researcher::Email()))
-    {
+    if (!project.m_cpid.Matches(internal_cpid, Researcher::Email())) {
         project.m_error = MiningProject::Error::MISMATCHED_CPID;
     }
 
@@ -1262,7 +1380,7 @@ void Researcher::Reload()
         LogPrintf("WARNING: boinckey is no longer supported.");
     }
 
-    Reload(MiningProjectMap::Parse(FetchProjectsXml()));
+    Reload(LoadMiningProjects());
 }
 
 void Researcher::Reload(MiningProjectMap projects, GRC::BeaconError beacon_error)
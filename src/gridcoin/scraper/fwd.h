@@ -5,10 +5,12 @@
 #ifndef GRIDCOIN_SCRAPER_FWD_H
 #define GRIDCOIN_SCRAPER_FWD_H
 
+#include <optional>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "gridcoin/cpid.h"
 #include "gridcoin/fwd.h"
 #include "gridcoin/scraper/scraper_net.h"
 #include "util.h"
@@ -169,8 +171,9 @@ struct ConvergedManifest
     /** Populates the part pointers map in the convergence */
     bool PopulateConvergedManifestPartPtrsMap();
 
-    /** Computes the converged content hash */
-    void ComputeConvergedContentHash();
+    /** Computes the converged content hash. Returns false, and sets a null hash, if the data of a part is not
+     *  available. */
+    bool ComputeConvergedContentHash();
 };
 
 
@@ -210,6 +213,86 @@ struct ScraperObjectStatsKeyComp
 /** Definition of the scraper statistics map(s) */
 typedef std::map<ScraperObjectStatsKey, ScraperObjectStats, ScraperObjectStatsKeyComp> ScraperStats;
 
+/** Columnar form of the scraper statistics. Each object type has its own dense table, sorted in the same order as the
+ * keys of the ScraperStats map. CPIDs are held as 16-byte values and projects as indexes into a sorted table of project
+ * names, so building the statistics does not allocate a map node and key strings for every CPID/project pair. Use
+ * ToMap() where the string-keyed map is needed, such as for RPC output.
+ */
+class ScraperStatsTable
+{
+public:
+    /** Index of a project in the sorted table of project names */
+    typedef uint32_t ProjectIndex;
+
+    /** Entry of the byCPID table */
+    struct CpidEntry
+    {
+        GRC::Cpid cpid;
+        ScraperObjectStatsValue statsvalue;
+    };
+
+    /** Entry of the byProject table, sorted by project name like the byProject entries of the map */
+    struct ProjectEntry
+    {
+        ProjectIndex project;
+        ScraperObjectStatsValue statsvalue;
+    };
+
+    /** Entry of the byCPIDbyProject table, sorted by project and then by CPID */
+    struct ProjectCpidEntry
+    {
+        ProjectIndex project;
+        GRC::Cpid cpid;
+        ScraperObjectStatsValue statsvalue;
+    };
+
+    ScraperStatsTable() = default;
+
+    /** Converts a statistics map. CPIDs are parsed like Superblock::FromStats() parsed the map keys. */
+    explicit ScraperStatsTable(const ScraperStats& stats);
+
+    /** Converts the tables back into the string-keyed statistics map. */
+    ScraperStats ToMap() const;
+
+    /** The number of entries across the tables, which matches the size of the equivalent map. */
+    size_t size() const;
+
+    bool empty() const { return size() == 0; }
+
+    const std::vector<std::string>& Projects() const { return m_projects; }
+    const std::string& ProjectName(ProjectIndex project) const { return m_projects[project]; }
+
+    const std::optional<ScraperObjectStatsValue>& NetworkWide() const { return m_network_wide; }
+    const std::vector<CpidEntry>& ByCPID() const { return m_by_cpid; }
+    const std::vector<ProjectEntry>& ByProject() const { return m_by_project; }
+    const std::vector<ProjectCpidEntry>& ByCPIDbyProject() const { return m_by_cpid_by_project; }
+
+    /** Looks up the byCPIDbyProject entry of a CPID in a project with a binary search. Returns nullptr if absent. */
+    const ProjectCpidEntry* Find(ProjectIndex project, const GRC::Cpid& cpid) const;
+
+    /** Adds the statistics of a project as Merge() would. The CPID entries must be sorted by CPID without duplicates. */
+    void AddProject(const std::string& project, const ScraperObjectStatsValue& statsvalue,
+                    const std::vector<CpidEntry>& cpids);
+
+    /** Moves the entries of another table into this one. Like std::map::merge, entries with keys that already exist in
+     * this table are left out. Appending projects that sort after the existing ones does not copy the existing entries.
+     */
+    void Merge(ScraperStatsTable&& other);
+
+    /** Replaces the byCPID table, which must be sorted by CPID without duplicates, and the network-wide entry. */
+    void SetNetworkWide(std::vector<CpidEntry> by_cpid, const ScraperObjectStatsValue& statsvalue);
+
+private:
+    /** Project names sorted like the "project,cpid" keys of the map, so the byCPIDbyProject table can order its
+     * entries by project index.
+     */
+    std::vector<std::string> m_projects;
+    std::optional<ScraperObjectStatsValue> m_network_wide;
+    std::vector<CpidEntry> m_by_cpid;
+    std::vector<ProjectEntry> m_by_project;
+    std::vector<ProjectCpidEntry> m_by_cpid_by_project;
+};
+
 /** modeled after AppCacheEntry/Section but named separately. */
 struct ScraperBeaconEntry
 {
@@ -319,7 +402,7 @@ struct ScraperProjectsAllCpidTotalCredit
  */
 struct ScraperStatsVerifiedBeaconsTotalCredits
 {
-    ScraperStats mScraperStats;
+    ScraperStatsTable mScraperStats;
     ScraperPendingBeaconMap mVerifiedMap;
     std::map<std::string, double> m_total_credit_map;
 };
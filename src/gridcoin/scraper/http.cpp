@@ -3,6 +3,7 @@
 // file COPYING or https://opensource.org/licenses/mit-license.php.
 
 #include "gridcoin/scraper/http.h"
+#include "crypto/sha256.h"
 #include "tinyformat.h"
 #include "util.h"
 
@@ -71,24 +72,164 @@ namespace
         return curl;
     }
 
-    struct progress {
-      timetype lastruntime;
-      CURL *curl;
+    //!
+    //! \brief Parse an etag value from an HTTP header field.
+    //!
+    //! This will parse etag values from headers in these standard formats:
+    //!
+    //!   ETag: "12345"
+    //!   ETag: W/"12345"
+    //!
+    //! The name of the header is matched in a case-insensitive fashion. This
+    //! function will return an empty string for non-standard, malformed, and
+    //! non-etag headers. It removes the quotes from the output and ignores a
+    //! space after the colon that separates the header name from the value.
+    //!
+    //! \param header Entire HTTP header field that includes the name and value.
+    //!
+    //! \return The parsed etag value or an empty string if the supplied header
+    //! contains no standard etag content.
+    //!
+    std::string ParseEtag(const std::string& header)
+    {
+        if (header.size() <= 8 || header[4] != ':') {
+            return std::string();
+        }
+
+        constexpr char expected[] = "etag";
+        constexpr int32_t shift_to_upper = 32;
+
+        for (size_t i = 0; i < 4; ++i) {
+            if (header[i] != expected[i] && header[i] != expected[i] - shift_to_upper) {
+                return std::string();
+            }
+        }
+
+        const size_t start_quote = header.find('"', 5);
+        const size_t end_quote = header.find('"', start_quote + 1);
+
+        if (start_quote == std::string::npos || end_quote == std::string::npos) {
+            return std::string();
+        }
+
+        return header.substr(start_quote + 1, end_quote - start_quote - 1);
+    }
+
+    //!
+    //! \brief State of a resumable download shared by the curl callbacks.
+    //!
+    struct ResumableTransfer
+    {
+        timetype lastruntime = 0;
+        CURL *curl = nullptr;
+
+        fs::path part_path;               //!< File that receives the bytes.
+        fs::path etag_path;               //!< Stores the ETag of the partial file.
+        ScopedFile file {nullptr, &fclose};
+        CSHA256 hasher;                   //!< Digest of the bytes in the file.
+        curl_off_t offset = 0;            //!< Bytes in the file before this transfer.
+
+        long response_code = 0;           //!< Status of the last response seen.
+        std::string etag;                 //!< ETag of the last response seen.
+        bool body_started = false;        //!< Whether the body has arrived.
+        bool failed = false;              //!< A file operation failed.
+
+        //!
+        //! \brief Get the number of bytes of the file that the server skipped.
+        //!
+        curl_off_t Resumed() const
+        {
+            return response_code == 206 ? offset : 0;
+        }
+
+        //!
+        //! \brief Discard the partial file when the server sends the whole file.
+        //!
+        bool Restart()
+        {
+            file.reset(fsbridge::fopen(part_path, "wb"));
+            hasher.Reset();
+            offset = 0;
+
+            return file != nullptr;
+        }
     };
 
+    size_t curl_header_resumable(char* ptr, size_t size, size_t nmemb, void* userp)
+    {
+        ResumableTransfer& transfer = *static_cast<ResumableTransfer*>(userp);
+        const std::string line(ptr, size * nmemb);
+
+        // Curl passes the headers of each redirect. Only the last response
+        // carries the body:
+        if (line.compare(0, 5, "HTTP/") == 0) {
+            const size_t space = line.find(' ');
+
+            transfer.response_code = space == std::string::npos ? 0 : atol(line.c_str() + space + 1);
+            transfer.etag.clear();
+        } else if (std::string etag = ParseEtag(line); !etag.empty()) {
+            transfer.etag = std::move(etag);
+        }
+
+        return size * nmemb;
+    }
+
+    size_t curl_write_resumable(void* ptr, size_t size, size_t nmemb, void* userp)
+    {
+        ResumableTransfer& transfer = *static_cast<ResumableTransfer*>(userp);
+        const size_t bytes = size * nmemb;
+
+        // Error pages must not end up in the partial file:
+        if (transfer.response_code != 200 && transfer.response_code != 206) {
+            return bytes;
+        }
+
+        if (!transfer.body_started) {
+            transfer.body_started = true;
+
+            // A full response to a range request means that the file changed
+            // or that the server does not support ranges:
+            if (transfer.response_code == 200 && transfer.offset > 0 && !transfer.Restart()) {
+                transfer.failed = true;
+
+                return 0;
+            }
+
+            if (transfer.response_code == 200) {
+                boost::system::error_code ec;
+                fs::remove(transfer.etag_path, ec);
+
+                if (!transfer.etag.empty()) {
+                    fsbridge::ofstream etag_file(transfer.etag_path, std::ios_base::out | std::ios_base::trunc);
+                    etag_file << transfer.etag;
+                }
+            }
+        }
+
+        if (fwrite(ptr, 1, bytes, transfer.file.get()) != bytes) {
+            transfer.failed = true;
+
+            return 0;
+        }
+
+        transfer.hasher.Write(static_cast<const unsigned char*>(ptr), bytes);
+
+        return bytes;
+    }
+
     static int newerprogress_callback(void *ptr, curl_off_t downtotal, curl_off_t downnow,
                                       curl_off_t uptotal, curl_off_t uplnow)
     {
-        struct progress *pg = (struct progress*)ptr;
+        ResumableTransfer *pg = (ResumableTransfer*)ptr;
         CURL *curl = pg->curl;
 
         // Thread interrupting
         try
         {
             boost::this_thread::interruption_point();
-            // Set this once.
-            if (DownloadStatus.GetSnapshotDownloadSize() == 0)
-                DownloadStatus.SetSnapshotDownloadSize(downtotal);
+            // Set this once. A resumed download reports the size of the rest.
+            if (DownloadStatus.GetSnapshotDownloadSize() == 0 && downtotal > 0)
+                DownloadStatus.SetSnapshotDownloadSize(downtotal + pg->Resumed());
 
             timetype currenttime = 0;
             curl_easy_getinfo(curl, timeopt, &currenttime);
@@ -131,8 +272,10 @@ namespace
 #endif
                     if (DownloadStatus.GetSnapshotDownloadSize() > 0 && (downnow > 0))
                     {
-                        DownloadStatus.SetSnapshotDownloadProgress(downnow * 100 / DownloadStatus.GetSnapshotDownloadSize());
-                        DownloadStatus.SetSnapshotDownloadAmount(downnow);
+                        const curl_off_t amount = downnow + pg->Resumed();
+
+                        DownloadStatus.SetSnapshotDownloadProgress(amount * 100 / DownloadStatus.GetSnapshotDownloadSize());
+                        DownloadStatus.SetSnapshotDownloadAmount(amount);
                     }
                 }
             }
@@ -155,48 +298,6 @@ namespace
 
 #endif
 
-    //!
-    //! \brief Parse an etag value from an HTTP header field.
-    //!
-    //! This will parse etag values from headers in these standard formats:
-    //!
-    //!   ETag: "12345"
-    //!   ETag: W/"12345"
-    //!
-    //! The name of the header is matched in a case-insensitive fashion. This
-    //! function will return an empty string for non-standard, malformed, and
-    //! non-etag headers. It removes the quotes from the output and ignores a
-    //! space after the colon that separates the header name from the value.
-    //!
-    //! \param header Entire HTTP header field that includes the name and value.
-    //!
-    //! \return The parsed etag value or an empty string if the supplied header
-    //! contains no standard etag content.
-    //!
-    std::string ParseEtag(const std::string& header)
-    {
-        if (header.size() <= 8 || header[4] != ':') {
-            return std::string();
-        }
-
-        constexpr char expected[] = "etag";
-        constexpr int32_t shift_to_upper = 32;
-
-        for (size_t i = 0; i < 4; ++i) {
-            if (header[i] != expected[i] && header[i] != expected[i] - shift_to_upper) {
-                return std::string();
-            }
-        }
-
-        const size_t start_quote = header.find('"', 5);
-        const size_t end_quote = header.find('"', start_quote + 1);
-
-        if (start_quote == std::string::npos || end_quote == std::string::npos) {
-            return std::string();
-        }
-
-        return header.substr(start_quote + 1, end_quote - start_quote - 1);
-    }
 } // anonymous namespace
 
 Http::CurlLifecycle::CurlLifecycle()
@@ -348,80 +449,182 @@ void Http::DownloadSnapshot()
 
     LogPrint(BCLog::LogFlags::VERBOSE, "INFO: %s: Downloading snapshot to %s.", __func__, destination.string());
 
-    ScopedFile fp(fsbridge::fopen(destination, "wb"), &fclose);
+    const std::string digest = DownloadResumable(url, destination);
 
-    if (!fp)
+    // Interrupted. The partial file remains for the next attempt.
+    if (digest.empty())
+        return;
+
+    DownloadStatus.SetSnapshotSHA256(digest);
+    DownloadStatus.SetSnapshotDownloadComplete(true);
+
+    return;
+}
+
+std::string Http::DownloadResumable(const std::string& url, const fs::path& destination)
+{
+    ResumableTransfer transfer;
+
+    transfer.part_path = destination.string() + ".part";
+    transfer.etag_path = destination.string() + ".etag";
+
+    std::string resume_etag;
+
+    if (fs::exists(transfer.part_path) && fs::exists(transfer.etag_path))
+    {
+        fsbridge::ifstream etag_file(transfer.etag_path);
+        std::getline(etag_file, resume_etag);
+    }
+
+    // Only resume a file that the server can validate with its ETag.
+    // Otherwise, bytes from two versions of the file could mix.
+    if (!resume_etag.empty())
     {
-        DownloadStatus.SetSnapshotDownloadFailed(true);
+        ScopedFile existing(fsbridge::fopen(transfer.part_path, "rb"), &fclose);
+
+        if (existing)
+        {
+            uint8_t buffer[32768];
+            size_t bytesread = 0;
+
+            try
+            {
+                while ((bytesread = fread(buffer, 1, sizeof(buffer), existing.get())))
+                {
+                    boost::this_thread::interruption_point();
+
+                    transfer.hasher.Write(buffer, bytesread);
+                    transfer.offset += bytesread;
+                }
+            }
+            catch (boost::thread_interrupted&)
+            {
+                return "";
+            }
+        }
+    }
 
+    transfer.file.reset(fsbridge::fopen(transfer.part_path, transfer.offset > 0 ? "ab" : "wb"));
+
+    if (!transfer.file)
+    {
         throw std::runtime_error(
                 tfm::strformat("Snapshot Downloader: Error opening target %s: %s (%d)",
-                            destination.string(), strerror(errno), errno));
+                            transfer.part_path.string(), strerror(errno), errno));
     }
 
-    std::string buffer;
-    std::string header;
+    if (transfer.offset > 0)
+    {
+        LogPrint(BCLog::LogFlags::VERBOSE, "INFO: %s: Resuming download of %s at byte %d.",
+                 __func__, url, transfer.offset);
+    }
 
     struct curl_slist* headers = nullptr;
     headers = curl_slist_append(headers, "Accept: */*");
     headers = curl_slist_append(headers, "User-Agent: curl/7.63.0");
 
-    CURL* curl;
-    curl = curl_easy_init();
-
-    struct progress fileprogress;
-
-    fileprogress.lastruntime = 0;
-    fileprogress.curl = curl;
-    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
-    curl_easy_setopt(curl, CURLOPT_PROXY, "");
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_UNRESTRICTED_AUTH, 1L);
-    curl_easy_setopt(curl, CURLOPT_VERBOSE, 0);
-    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 10000L);
-    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, 60L);
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curl_write_file);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp.get());
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    if (transfer.offset > 0)
+    {
+        headers = curl_slist_append(headers, ("If-Range: \"" + resume_etag + "\"").c_str());
+    }
+
+    ScopedCurl curl(curl_easy_init(), &curl_easy_cleanup);
+
+    transfer.curl = curl.get();
+    curl_easy_setopt(curl.get(), CURLOPT_CONNECTTIMEOUT, 10L);
+    curl_easy_setopt(curl.get(), CURLOPT_PROXY, "");
+    curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl.get(), CURLOPT_UNRESTRICTED_AUTH, 1L);
+    curl_easy_setopt(curl.get(), CURLOPT_VERBOSE, 0);
+    curl_easy_setopt(curl.get(), CURLOPT_LOW_SPEED_LIMIT, 10000L);
+    curl_easy_setopt(curl.get(), CURLOPT_LOW_SPEED_TIME, 60L);
+    curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, curl_write_resumable);
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &transfer);
+    curl_easy_setopt(curl.get(), CURLOPT_HEADERFUNCTION, curl_header_resumable);
+    curl_easy_setopt(curl.get(), CURLOPT_HEADERDATA, &transfer);
+    curl_easy_setopt(curl.get(), CURLOPT_HTTPHEADER, headers);
+
+    // Unlike CURLOPT_RESUME_FROM, a plain range accepts a full response when
+    // the If-Range condition fails:
+    const std::string range = tfm::strformat("%d-", transfer.offset);
+
+    if (transfer.offset > 0)
+    {
+        curl_easy_setopt(curl.get(), CURLOPT_RANGE, range.c_str());
+    }
 
 #if LIBCURL_VERSION_NUM >= 0x072000
-    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, newerprogress_callback);
-    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &fileprogress);
+    curl_easy_setopt(curl.get(), CURLOPT_XFERINFOFUNCTION, newerprogress_callback);
+    curl_easy_setopt(curl.get(), CURLOPT_XFERINFODATA, &transfer);
 #else
-    curl_easy_setopt(curl, CURLOPT_PROGRESSFUNCTION, olderprogress_callback);
-    curl_easy_setopt(curl, CURLOPT_PROGRESSDATA, &fileprogress);
+    curl_easy_setopt(curl.get(), CURLOPT_PROGRESSFUNCTION, olderprogress_callback);
+    curl_easy_setopt(curl.get(), CURLOPT_PROGRESSDATA, &transfer);
 #endif
 
-    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl.get(), CURLOPT_NOPROGRESS, 0L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = curl_easy_perform(curl.get());
 
     curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
 
     if (res > 0)
     {
         if (res == CURLE_ABORTED_BY_CALLBACK)
-            return;
+            return "";
 
-        else
+        if (transfer.failed)
         {
-            DownloadStatus.SetSnapshotDownloadFailed(true);
-
-            throw std::runtime_error(tfm::strformat("Snapshot Downloader: Failed to download file %s: %s",
-                                                 url, curl_easy_strerror(res)));
+            throw std::runtime_error(tfm::strformat("Snapshot Downloader: Failed to write %s: %s (%d)",
+                                                 transfer.part_path.string(), strerror(errno), errno));
         }
+
+        throw std::runtime_error(tfm::strformat("Snapshot Downloader: Failed to download file %s: %s",
+                                             url, curl_easy_strerror(res)));
     }
 
-    // Validate HTTP return code.
     long response_code;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-    EvaluateResponse(response_code, url);
+    curl_easy_getinfo(curl.get(), CURLINFO_RESPONSE_CODE, &response_code);
 
-    DownloadStatus.SetSnapshotDownloadComplete(true);
+    // The server rejects the range when the partial file holds every byte but
+    // was not renamed. It is cheaper to start over than to trust that file:
+    if (response_code == 416)
+    {
+        transfer.file.reset();
+        fs::remove(transfer.part_path);
+        fs::remove(transfer.etag_path);
 
-    return;
+        return DownloadResumable(url, destination);
+    }
+
+    // Validate HTTP return code.
+    if (response_code != 206)
+    {
+        EvaluateResponse(response_code, url);
+    }
+
+    // A full response without a body never reaches the write callback:
+    if (response_code == 200 && !transfer.body_started && transfer.offset > 0 && !transfer.Restart())
+    {
+        throw std::runtime_error(tfm::strformat("Snapshot Downloader: Error opening target %s: %s (%d)",
+                                             transfer.part_path.string(), strerror(errno), errno));
+    }
+
+    if (fflush(transfer.file.get()) != 0)
+    {
+        throw std::runtime_error(tfm::strformat("Snapshot Downloader: Failed to write %s: %s (%d)",
+                                             transfer.part_path.string(), strerror(errno), errno));
+    }
+
+    transfer.file.reset();
+
+    fs::rename(transfer.part_path, destination);
+    fs::remove(transfer.etag_path);
+
+    uint8_t digest[CSHA256::OUTPUT_SIZE];
+    transfer.hasher.Finalize(digest);
+
+    return HexStr(digest);
 }
 
 std::string Http::GetSnapshotSHA256()
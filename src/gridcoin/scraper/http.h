@@ -33,6 +33,7 @@ public:
         CleanupBlockchainDataProgress = 0;
         CleanupBlockchainDataComplete = false;
         CleanupBlockchainDataFailed = false;
+        SnapshotSHA256.clear();
     }
 
     bool GetSnapshotDownloadComplete()
@@ -119,6 +120,13 @@ public:
         return CleanupBlockchainDataFailed;
     }
 
+    std::string GetSnapshotSHA256()
+    {
+        LOCK(cs_lock);
+
+        return SnapshotSHA256;
+    }
+
     void SetSnapshotDownloadComplete(bool SnapshotDownloadComplete_in)
     {
         LOCK(cs_lock);
@@ -203,6 +211,13 @@ public:
         CleanupBlockchainDataFailed = CleanupBlockchainDataFailed_in;
     }
 
+    void SetSnapshotSHA256(const std::string& SnapshotSHA256_in)
+    {
+        LOCK(cs_lock);
+
+        SnapshotSHA256 = SnapshotSHA256_in;
+    }
+
 private:
     CCriticalSection cs_lock;
 
@@ -218,6 +233,7 @@ private:
     int CleanupBlockchainDataProgress = 0;
     bool CleanupBlockchainDataComplete = false;
     bool CleanupBlockchainDataFailed = false;
+    std::string SnapshotSHA256; //!< Hex digest computed while downloading.
 };
 
 extern SnapshotStatus DownloadStatus;
@@ -303,10 +319,36 @@ public:
     //! \brief Download Snapshot with progress updates.
     //!
     //! Downloads the snapshot from the latest snapshot.zip hosted on download.gridcoin.us.
+    //! Resumes a previous download that did not finish and stores the SHA256
+    //! digest of the file in DownloadStatus.
     //!
     //! \throws HttpException on invalid server response.
     //!
     void DownloadSnapshot();
+
+    //!
+    //! \brief Download a file that may resume after an interruption.
+    //!
+    //! Writes to \p destination with a ".part" suffix and renames the file to
+    //! \p destination when the transfer completes. When a partial file exists
+    //! from an earlier attempt, requests only the remaining bytes with a range
+    //! request. The server's ETag of the partial file goes in an If-Range
+    //! header, so a file that changed on the server downloads from the start.
+    //! The SHA256 digest accumulates as the bytes arrive.
+    //!
+    //! Reports progress through DownloadStatus.
+    //!
+    //! \param url URL to download.
+    //! \param destination Destination path, including filename.
+    //!
+    //! \return Hex SHA256 digest of the complete file, or an empty string when
+    //! the thread was interrupted.
+    //!
+    //! \throws HttpException on invalid server response.
+    //! \throws std::runtime_error on download or file failure. The partial file
+    //! remains for the next attempt.
+    //!
+    std::string DownloadResumable(const std::string& url, const fs::path& destination);
     //!
     //! \brief Fetch the sha256sum from snapshot server.
     //!
@@ -0,0 +1,278 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "gridcoin/scraper/part_delta.h"
+#include "hash.h"
+#include "serialize.h"
+#include "streams.h"
+#include "version.h"
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace boostio = boost::iostreams;
+
+namespace {
+//!
+//! \brief Version of the delta encoding. Bump when the layout changes.
+//!
+constexpr uint8_t PART_DELTA_FORMAT = 2;
+
+//!
+//! \brief Largest uncompressed text accepted from a part or a delta. This
+//! guards against compression bombs; project stats files are a few MiB.
+//!
+constexpr size_t MAX_PART_TEXT_SIZE = 128 * 1024 * 1024;
+
+//!
+//! \brief Copy a range of lines from the older part and then append new lines.
+//!
+struct PartDeltaRun
+{
+    uint32_t m_base_line = 0;
+    uint32_t m_copy_lines = 0;
+    std::vector<std::string> m_new_lines;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action)
+    {
+        READWRITE(VARINT(m_base_line));
+        READWRITE(VARINT(m_copy_lines));
+        READWRITE(m_new_lines);
+    }
+};
+
+//!
+//! \brief Inflate gzipped data.
+//!
+//! \return The text, or \c std::nullopt if the data is not gzipped, is
+//! corrupt, or inflates beyond \c MAX_PART_TEXT_SIZE.
+//!
+std::optional<std::string> Decompress(const SerializeData& data)
+{
+    if (data.size() < 2 || data[0] != std::byte{0x1f} || data[1] != std::byte{0x8b}) {
+        return std::nullopt;
+    }
+
+    boostio::array_source source(reinterpret_cast<const char*>(data.data()), data.size());
+    boostio::filtering_istream in;
+    in.push(boostio::gzip_decompressor());
+    in.push(source);
+
+    std::string text;
+    char buffer[64 * 1024];
+
+    try {
+        while (in) {
+            in.read(buffer, sizeof(buffer));
+            text.append(buffer, in.gcount());
+
+            if (text.size() > MAX_PART_TEXT_SIZE) {
+                return std::nullopt;
+            }
+        }
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+
+    if (in.bad()) {
+        return std::nullopt;
+    }
+
+    return text;
+}
+
+//!
+//! \brief Gzip text the same way that the scraper compresses its files.
+//!
+SerializeData Compress(const std::string& text)
+{
+    std::istringstream stream(text);
+    boostio::filtering_istream in;
+    in.push(boostio::gzip_compressor());
+    in.push(stream);
+
+    std::string compressed;
+    boostio::copy(in, boostio::back_inserter(compressed));
+
+    const auto begin = reinterpret_cast<const std::byte*>(compressed.data());
+
+    return SerializeData(begin, begin + compressed.size());
+}
+
+//!
+//! \brief Split text into lines. Joining the lines with newlines yields the
+//! same text again, including any trailing newline.
+//!
+std::vector<std::string_view> SplitLines(const std::string& text)
+{
+    std::vector<std::string_view> lines;
+    size_t start = 0;
+
+    for (size_t end = text.find('\n'); end != std::string::npos; end = text.find('\n', start)) {
+        lines.emplace_back(text.data() + start, end - start);
+        start = end + 1;
+    }
+
+    lines.emplace_back(text.data() + start, text.size() - start);
+
+    return lines;
+}
+
+//!
+//! \brief Find runs of target lines that appear in the base lines.
+//!
+//! Stats files keep their rows in a stable order from cycle to cycle, so a
+//! greedy match that extends each run as far as the base allows finds nearly
+//! all shared rows without a full diff.
+//!
+std::vector<PartDeltaRun> DiffLines(
+    const std::vector<std::string_view>& base,
+    const std::vector<std::string_view>& target)
+{
+    std::unordered_map<std::string_view, uint32_t> base_index;
+    base_index.reserve(base.size());
+
+    for (uint32_t i = 0; i < base.size(); ++i) {
+        base_index.emplace(base[i], i);
+    }
+
+    std::vector<PartDeltaRun> runs;
+    size_t next_base_line = base.size();
+
+    for (const auto& line : target) {
+        if (!runs.empty()
+            && runs.back().m_new_lines.empty()
+            && next_base_line < base.size()
+            && base[next_base_line] == line)
+        {
+            ++runs.back().m_copy_lines;
+            ++next_base_line;
+            continue;
+        }
+
+        const auto iter = base_index.find(line);
+
+        if (iter != base_index.end()) {
+            runs.push_back({ iter->second, 1, {} });
+            next_base_line = iter->second + 1;
+            continue;
+        }
+
+        if (runs.empty()) {
+            runs.emplace_back();
+        }
+
+        runs.back().m_new_lines.emplace_back(line);
+        next_base_line = base.size();
+    }
+
+    return runs;
+}
+} // Anonymous namespace
+
+std::optional<SerializeData> MakeScraperPartDelta(const SerializeData& base, const SerializeData& target)
+{
+    const std::optional<std::string> base_text = Decompress(base);
+    const std::optional<std::string> target_text = Decompress(target);
+
+    if (!base_text || !target_text) {
+        return std::nullopt;
+    }
+
+    // The hash of the text lets the receiver tell a delta that rebuilds the
+    // wrong text from a zlib build that compresses the right text differently:
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss << PART_DELTA_FORMAT
+       << Hash(*target_text)
+       << DiffLines(SplitLines(*base_text), SplitLines(*target_text));
+
+    SerializeData delta = Compress(ss.str());
+
+    if (delta.size() >= target.size()) {
+        return std::nullopt;
+    }
+
+    // The receiver rebuilds the part by compressing the text again. Only send
+    // the delta if that reproduces the exact part published by the scraper:
+    const std::optional<SerializeData> rebuilt = ApplyScraperPartDelta(base, delta);
+
+    if (!rebuilt || *rebuilt != target) {
+        return std::nullopt;
+    }
+
+    return delta;
+}
+
+std::optional<SerializeData> ApplyScraperPartDelta(const SerializeData& base, const SerializeData& delta)
+{
+    const std::optional<std::string> base_text = Decompress(base);
+    const std::optional<std::string> delta_body = Decompress(delta);
+
+    if (!base_text || !delta_body) {
+        return std::nullopt;
+    }
+
+    const std::vector<std::string_view> base_lines = SplitLines(*base_text);
+
+    uint8_t format;
+    uint256 text_hash;
+    std::vector<PartDeltaRun> runs;
+
+    try {
+        CDataStream ss(MakeByteSpan(*delta_body), SER_NETWORK, PROTOCOL_VERSION);
+        ss >> format;
+
+        if (format != PART_DELTA_FORMAT) {
+            return std::nullopt;
+        }
+
+        ss >> text_hash >> runs;
+    } catch (const std::ios_base::failure&) {
+        return std::nullopt;
+    }
+
+    std::string text;
+    bool first_line = true;
+
+    const auto append_line = [&](const std::string_view line) {
+        if (!first_line) {
+            text += '\n';
+        }
+
+        text.append(line);
+        first_line = false;
+
+        return text.size() <= MAX_PART_TEXT_SIZE;
+    };
+
+    for (const auto& run : runs) {
+        if (run.m_base_line > base_lines.size() || run.m_copy_lines > base_lines.size() - run.m_base_line) {
+            return std::nullopt;
+        }
+
+        for (uint32_t i = run.m_base_line; i < run.m_base_line + run.m_copy_lines; ++i) {
+            if (!append_line(base_lines[i])) return std::nullopt;
+        }
+
+        for (const auto& line : run.m_new_lines) {
+            if (!append_line(line)) return std::nullopt;
+        }
+    }
+
+    if (Hash(text) != text_hash) {
+        return std::nullopt;
+    }
+
+    return Compress(text);
+}
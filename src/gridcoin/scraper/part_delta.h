@@ -0,0 +1,45 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_SCRAPER_PART_DELTA_H
+#define GRIDCOIN_SCRAPER_PART_DELTA_H
+
+#include "support/allocators/zeroafterfree.h"
+
+#include <optional>
+
+//!
+//! \brief Encode a scraper manifest part as the rows that changed since an
+//! older part.
+//!
+//! Scrapers publish the same gzipped CSV files for each project every cycle,
+//! and most rows do not change between cycles. A delta lists the runs of rows
+//! to copy from the older part and the new rows between them, and the receiver
+//! compresses the rebuilt CSV again to get the part. The delta carries the
+//! hash of the CSV so that the receiver can check the rebuilt text on its own.
+//!
+//! \param base   Data of the part that the receiver already holds.
+//! \param target Data of the part to encode.
+//!
+//! \return The encoded delta, or \c std::nullopt when either part is not a
+//! gzipped text file, when the delta is not smaller than the part, or when
+//! recompressing the rebuilt text does not reproduce the part byte for byte.
+//!
+std::optional<SerializeData> MakeScraperPartDelta(const SerializeData& base, const SerializeData& target);
+
+//!
+//! \brief Rebuild a scraper manifest part from an older part and a delta made
+//! by \c MakeScraperPartDelta().
+//!
+//! The result is only a candidate. Callers must check it against the hash of
+//! the part that they asked for. A mismatch then means that the local zlib
+//! compresses the text differently than the scraper's zlib did.
+//!
+//! \return The rebuilt part data, or \c std::nullopt if the delta is malformed,
+//! does not fit the older part, or rebuilds text that does not match the hash
+//! in the delta.
+//!
+std::optional<SerializeData> ApplyScraperPartDelta(const SerializeData& base, const SerializeData& delta);
+
+#endif // GRIDCOIN_SCRAPER_PART_DELTA_H
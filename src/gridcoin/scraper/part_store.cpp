@@ -0,0 +1,278 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "gridcoin/scraper/part_store.h"
+#include "hash.h"
+#include "logging.h"
+#include "util/system.h"
+
+#include <cstdio>
+
+namespace {
+//!
+//! \brief Read the contents of a part file.
+//!
+//! \return \c false if the file does not exist or fails to read completely.
+//!
+bool ReadPartFile(const fs::path& path, SerializeData& data)
+{
+    FILE* file = fsbridge::fopen(path, "rb");
+
+    if (!file) {
+        return false;
+    }
+
+    bool ok = std::fseek(file, 0, SEEK_END) == 0;
+    const long size = ok ? std::ftell(file) : -1;
+    ok = size >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+
+    if (ok) {
+        data.resize(size);
+        ok = std::fread(data.data(), 1, data.size(), file) == data.size();
+    }
+
+    std::fclose(file);
+
+    return ok;
+}
+
+//!
+//! \brief Write a part file through a temporary file so that a crash never
+//! leaves a truncated part under the final name.
+//!
+bool WritePartFile(const fs::path& path, const SerializeData& data)
+{
+    fs::path path_tmp = path;
+    path_tmp += ".tmp";
+
+    FILE* file = fsbridge::fopen(path_tmp, "wb");
+
+    if (!file) {
+        return false;
+    }
+
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || !RenameOver(path_tmp, path)) {
+        fs::remove(path_tmp);
+        return false;
+    }
+
+    return true;
+}
+} // Anonymous namespace
+
+bool ScraperPartStore::Open(const fs::path& directory, const size_t cache_bytes)
+{
+    LOCK(m_mutex);
+
+    try {
+        fs::create_directories(directory);
+
+        for (const auto& dir_entry : fs::directory_iterator(directory)) {
+            if (fs::is_regular_file(dir_entry.status())) {
+                fs::remove(dir_entry.path());
+            }
+        }
+    } catch (const fs::filesystem_error& e) {
+        error("%s: cannot use scraper part directory %s: %s", __func__, directory.string(), e.what());
+
+        return false;
+    }
+
+    m_directory = directory;
+    m_cache_bytes = cache_bytes;
+
+    for (auto& [hash, entry] : m_entries) {
+        StoreEntry(hash, entry);
+    }
+
+    Trim();
+
+    return true;
+}
+
+void ScraperPartStore::Put(const uint256& hash, SerializeData data)
+{
+    LOCK(m_mutex);
+
+    const auto [iter, inserted] = m_entries.try_emplace(hash);
+
+    // Parts are content-addressed, so a part already held by the store
+    // already has this data:
+    if (!inserted) {
+        return;
+    }
+
+    Entry& entry = iter->second;
+
+    entry.m_size = data.size();
+    entry.m_data = std::make_shared<const SerializeData>(std::move(data));
+    entry.m_lru = m_lru.end();
+    m_memory_usage += entry.m_size;
+
+    if (!m_directory.empty()) {
+        StoreEntry(hash, entry);
+        Trim();
+    }
+}
+
+std::shared_ptr<const SerializeData> ScraperPartStore::Get(const uint256& hash)
+{
+    LOCK(m_mutex);
+
+    auto iter = m_entries.find(hash);
+
+    if (iter == m_entries.end()) {
+        return nullptr;
+    }
+
+    Entry& entry = iter->second;
+
+    if (entry.m_data) {
+        if (entry.m_stored) {
+            m_lru.splice(m_lru.begin(), m_lru, entry.m_lru);
+        }
+
+        return entry.m_data;
+    }
+
+    SerializeData data;
+
+    if (!ReadPartFile(PartPath(hash), data)) {
+        error("%s: failed to read scraper part %s", __func__, hash.GetHex());
+
+        EraseEntry(iter);
+
+        return nullptr;
+    }
+
+    if (Hash(data) != hash) {
+        error("%s: scraper part %s does not match its hash", __func__, hash.GetHex());
+
+        EraseEntry(iter);
+
+        return nullptr;
+    }
+
+    // Trimming the cache may drop this part again if it exceeds the limit by
+    // itself, so hold on to the data for the caller first:
+    auto loaded = std::make_shared<const SerializeData>(std::move(data));
+
+    entry.m_data = loaded;
+    entry.m_lru = m_lru.insert(m_lru.begin(), hash);
+    m_memory_usage += entry.m_size;
+
+    Trim();
+
+    return loaded;
+}
+
+void ScraperPartStore::Erase(const uint256& hash)
+{
+    LOCK(m_mutex);
+
+    auto iter = m_entries.find(hash);
+
+    if (iter == m_entries.end()) {
+        return;
+    }
+
+    EraseEntry(iter);
+}
+
+void ScraperPartStore::Close()
+{
+    LOCK(m_mutex);
+
+    // Forget the files rather than removing them one by one. Open() removes
+    // them at the next start:
+    for (auto iter = m_entries.begin(); iter != m_entries.end();) {
+        if (!iter->second.m_data) {
+            iter = m_entries.erase(iter);
+            continue;
+        }
+
+        iter->second.m_stored = false;
+        ++iter;
+    }
+
+    m_lru.clear();
+    m_directory.clear();
+}
+
+size_t ScraperPartStore::MemoryUsage() const
+{
+    LOCK(m_mutex);
+
+    return m_memory_usage;
+}
+
+void ScraperPartStore::EraseEntry(std::map<uint256, Entry>::iterator iter)
+{
+    Entry& entry = iter->second;
+
+    if (entry.m_data) {
+        m_memory_usage -= entry.m_size;
+
+        if (entry.m_stored) {
+            m_lru.erase(entry.m_lru);
+        }
+    }
+
+    if (entry.m_stored) {
+        try {
+            fs::remove(PartPath(iter->first));
+        } catch (const fs::filesystem_error& e) {
+            LogPrintf("WARN: %s: failed to remove scraper part %s: %s", __func__, iter->first.GetHex(), e.what());
+        }
+    }
+
+    m_entries.erase(iter);
+}
+
+void ScraperPartStore::StoreEntry(const uint256& hash, Entry& entry)
+{
+    if (entry.m_stored || !entry.m_data) {
+        return;
+    }
+
+    // A part that fails to write stays pinned in memory:
+    if (!WritePartFile(PartPath(hash), *entry.m_data)) {
+        error("%s: failed to write scraper part %s", __func__, hash.GetHex());
+
+        return;
+    }
+
+    entry.m_stored = true;
+    entry.m_lru = m_lru.insert(m_lru.begin(), hash);
+}
+
+void ScraperPartStore::Trim()
+{
+    while (m_memory_usage > m_cache_bytes && !m_lru.empty()) {
+        Entry& entry = m_entries.at(m_lru.back());
+
+        m_memory_usage -= entry.m_size;
+        entry.m_data.reset();
+        m_lru.pop_back();
+    }
+}
+
+fs::path ScraperPartStore::PartPath(const uint256& hash) const
+{
+    return m_directory / hash.GetHex();
+}
+
+ScraperPartStore& GetScraperPartStore()
+{
+    // Intentionally leaked: manifests held in static maps erase their parts
+    // from the store while the executable destroys those maps at exit. The
+    // store is closed at shutdown before that, so the erasures do not touch
+    // the disk.
+    static ScraperPartStore* store = new ScraperPartStore();
+
+    return *store;
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_SCRAPER_PART_STORE_H
+#define GRIDCOIN_SCRAPER_PART_STORE_H
+
+#include "fs.h"
+#include "support/allocators/zeroafterfree.h"
+#include "sync.h"
+#include "uint256.h"
+
+#include <list>
+#include <map>
+#include <memory>
+
+//!
+//! \brief Content-addressed store for the data of scraper manifest parts.
+//!
+//! Nodes keep the parts of every manifest received in the retention period,
+//! which adds up to many megabytes per scraper. Once opened on a directory,
+//! the store writes each part to a file named by the part hash and keeps only
+//! the most recently used parts in memory, up to a byte limit. The rest load
+//! from disk on demand, and the store checks them against their hash before it
+//! hands them out. Until it is opened, the store holds every part in memory.
+//!
+class ScraperPartStore
+{
+public:
+    //!
+    //! \brief Default size in MiB of the parts held in memory.
+    //!
+    static constexpr size_t DEFAULT_CACHE_SIZE = 32;
+
+    //!
+    //! \brief Write parts to the specified directory and limit the memory used
+    //! by the parts cached from it.
+    //!
+    //! Files left in the directory by a previous run are removed, because the
+    //! manifests that referenced them are gone. Parts stored before the call
+    //! move to the directory.
+    //!
+    //! \param directory   Holds one file for each part.
+    //! \param cache_bytes Maximum size of the parts cached in memory.
+    //!
+    //! \return \c false if the directory is not usable. The store then keeps
+    //! every part in memory.
+    //!
+    bool Open(const fs::path& directory, const size_t cache_bytes);
+
+    //!
+    //! \brief Store the data of a part.
+    //!
+    //! \param hash Hash of the part data, which callers compute when the part
+    //! arrives.
+    //! \param data Part data to store.
+    //!
+    void Put(const uint256& hash, SerializeData data);
+
+    //!
+    //! \brief Get the data of a part, reading it from disk if not in memory.
+    //!
+    //! \return The part data, or \c nullptr if the store does not hold the
+    //! part. A part that fails to read or to match its hash is dropped from
+    //! the store, so that it can be stored again when it arrives again.
+    //!
+    std::shared_ptr<const SerializeData> Get(const uint256& hash);
+
+    //!
+    //! \brief Remove a part that no manifest references anymore.
+    //!
+    void Erase(const uint256& hash);
+
+    //!
+    //! \brief Stop using the directory. Called at shutdown.
+    //!
+    //! Manifests held in static maps erase their parts when the executable
+    //! destroys those maps at exit. After the store closes, it drops the parts
+    //! that are only on disk and leaves the files in place.
+    //!
+    void Close();
+
+    //!
+    //! \brief Get the size of the part data held in memory.
+    //!
+    size_t MemoryUsage() const;
+
+private:
+    //!
+    //! \brief State of a part held by the store.
+    //!
+    struct Entry
+    {
+        std::shared_ptr<const SerializeData> m_data; //!< Data, or nullptr when only on disk.
+        std::list<uint256>::iterator m_lru;          //!< Position in m_lru when cached.
+        size_t m_size = 0;                           //!< Size of the part data.
+        bool m_stored = false;                       //!< Whether the data is on disk.
+    };
+
+    mutable Mutex m_mutex;
+    fs::path m_directory GUARDED_BY(m_mutex);
+    size_t m_cache_bytes GUARDED_BY(m_mutex) = 0;
+    size_t m_memory_usage GUARDED_BY(m_mutex) = 0;
+    std::map<uint256, Entry> m_entries GUARDED_BY(m_mutex);
+    std::list<uint256> m_lru GUARDED_BY(m_mutex); //!< Cached parts that are on disk, most recent first.
+
+    //!
+    //! \brief Remove an entry from memory and from disk.
+    //!
+    void EraseEntry(std::map<uint256, Entry>::iterator iter) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    //!
+    //! \brief Write the data of an entry to disk and put it into the cache.
+    //!
+    void StoreEntry(const uint256& hash, Entry& entry) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    //!
+    //! \brief Drop the least recently used parts that are on disk from memory
+    //! until the cache fits into its limit.
+    //!
+    void Trim() EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    fs::path PartPath(const uint256& hash) const EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+};
+
+//!
+//! \brief Get the global store for scraper manifest part data.
+//!
+ScraperPartStore& GetScraperPartStore();
+
+#endif // GRIDCOIN_SCRAPER_PART_STORE_H
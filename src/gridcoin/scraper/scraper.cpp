@@ -19,6 +19,7 @@
 #include "gridcoin/superblock.h"
 #include "gridcoin/support/block_finder.h"
 #include "gridcoin/support/xml.h"
+#include "logging/writer.h"
 
 #include <zlib.h>
 #include <boost/algorithm/string/classification.hpp>
@@ -36,8 +37,10 @@
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/date_time/gregorian/greg_date.hpp>
 #include <util/strencodings.h>
+#include <atomic>
 #include <random>
 #include <stdexcept>
+#include <thread>
 #include <util/string.h>
 
 using namespace GRC;
@@ -420,7 +423,7 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsFromSingleManifest(CScrap
  * @return bool true if successful
  */
 bool LoadProjectFileToStatsByCPID(const std::string& project, const fs::path& file, const double& projectmag,
-                                  ScraperStats& mScraperStats);
+                                  ScraperStatsTable& mScraperStats);
 /**
  * @brief Computes statistics from a provided project object
  * @param project
@@ -430,7 +433,7 @@ bool LoadProjectFileToStatsByCPID(const std::string& project, const fs::path& fi
  * @return bool true if successful
  */
 bool LoadProjectObjectToStatsByCPID(const std::string& project, const SerializeData& ProjectData, const double& projectmag,
-                                    ScraperStats& mScraperStats);
+                                    ScraperStatsTable& mScraperStats);
 /**
  * @brief Computes statistics from a provided project data stream. This is used by LoadProjectFileToStatsByCPID.
  * @param project
@@ -440,7 +443,21 @@ bool LoadProjectObjectToStatsByCPID(const std::string& project, const SerializeD
  * @return bool true if successful
  */
 bool ProcessProjectStatsFromStreamByCPID(const std::string& project, boostio::filtering_istream& sUncompressedIn,
-                                         const double& projectmag, ScraperStats& mScraperStats);
+                                         const double& projectmag, ScraperStatsTable& mScraperStats);
+/**
+ * @brief Computes statistics for the project parts of a converged manifest and adds them to the stats map. The parts
+ * are decompressed and parsed on several threads. Each project is computed exactly as a serial load would, and the
+ * per-project tables are merged in the part map's key order, so the result does not depend on the thread count.
+ * A project part that is not available fails the whole computation, because the magnitudes of the other projects
+ * would not match the convergence. The node asks its peers for the missing part again.
+ * @param StructConvergedManifest
+ * @param greylist
+ * @param dMagnitudePerProject
+ * @param mScraperStats
+ * @return bool true if the data of every project part was available
+ */
+bool LoadProjectPartsToStatsByCPID(const ConvergedManifest& StructConvergedManifest, const WhitelistSnapshot& greylist,
+                                   const double& dMagnitudePerProject, ScraperStatsTable& mScraperStats);
 /**
  * @brief Once the project statistics have been computed for all of the whitelisted projects, this function is called
  * to compute network-wide statistics, and also compute the magnitudes, which cannot be computed until all projects are
@@ -448,14 +465,14 @@ bool ProcessProjectStatsFromStreamByCPID(const std::string& project, boostio::fi
  * @param mScraperStats
  * @return bool true if successful
  */
-bool ProcessNetworkWideFromProjectStats(ScraperStats& mScraperStats);
+bool ProcessNetworkWideFromProjectStats(ScraperStatsTable& mScraperStats);
 /**
- * @brief Stores the provided mScraperStats statistics map to file.
+ * @brief Stores the provided mScraperStats statistics to file.
  * @param file
  * @param mScraperStats
  * @return bool true if successful
  */
-bool StoreStats(const fs::path& file, const ScraperStats& mScraperStats);
+bool StoreStats(const fs::path& file, const ScraperStatsTable& mScraperStats);
 /**
  * @brief Saves a CScraperManifest contents to a subdirectory of the scraper data directory which is the left 7 digits
  * of the manifest hash
@@ -818,20 +835,65 @@ private:
 
     fsbridge::ofstream logfile;
 
+    //! Lines waiting for the writer. The scraper logs in bursts from few threads.
+    static constexpr size_t SCRAPER_LOG_QUEUE_SIZE = 4096;
+
+    //! Writes queued lines to the log file when -logasync is enabled.
+    std::unique_ptr<BCLog::BackgroundWriter> m_writer;
+
+    void write(const std::vector<std::string>& lines, uint64_t dropped)
+    {
+        LOCK(cs_log);
+
+        if (!logfile.is_open()) return;
+
+        if (dropped > 0)
+        {
+            logfile << DateTimeStrFormat("%x %H:%M:%S", GetAdjustedTime())
+                    << " [WARNING] <ScraperLogger> : dropped " << dropped
+                    << " log lines because the log queue was full.\n";
+        }
+
+        for (const auto& line : lines)
+        {
+            logfile << line << '\n';
+        }
+
+        logfile.flush();
+    }
+
 public:
+    //! Set when the singleton exists so that shutdown does not create it.
+    static std::atomic<bool> fInstantiated;
+
     ScraperLogger()
     {
-        LOCK(cs_log);
+        {
+            LOCK(cs_log);
 
-        fs::path plogfile = pathDataDir / "scraper.log";
-        logfile.open(plogfile, std::ios_base::out | std::ios_base::app);
+            fs::path plogfile = pathDataDir / "scraper.log";
+            logfile.open(plogfile, std::ios_base::out | std::ios_base::app);
 
-        if (!logfile.is_open())
-            LogPrintf("ERROR: Scraper: Logger: Failed to open logging file\n");
+            if (!logfile.is_open())
+                LogPrintf("ERROR: Scraper: Logger: Failed to open logging file\n");
+        }
+
+        if (gArgs.GetBoolArg("-logasync", DEFAULT_LOGASYNC))
+        {
+            m_writer = std::make_unique<BCLog::BackgroundWriter>(
+                SCRAPER_LOG_QUEUE_SIZE,
+                [this](const std::vector<std::string>& lines, uint64_t dropped) { write(lines, dropped); },
+                "grc-scraperlog");
+        }
+
+        fInstantiated = true;
     }
 
     ~ScraperLogger()
     {
+        // Drain the queue before the file closes.
+        m_writer.reset();
+
         LOCK(cs_log);
 
         if (logfile.is_open())
@@ -843,6 +905,8 @@ public:
 
     void output(const std::string& tofile)
     {
+        if (m_writer && m_writer->Submit(std::string(tofile))) return;
+
         LOCK(cs_log);
 
         if (logfile.is_open())
@@ -851,8 +915,15 @@ public:
         return;
     }
 
+    void flush()
+    {
+        if (m_writer) m_writer->Flush();
+    }
+
     void closelogfile()
     {
+        flush();
+
         LOCK(cs_log);
 
         if (logfile.is_open())
@@ -899,6 +970,9 @@ public:
 
         if (fImmediate || (fArchiveDaily && ArchiveCheckDate > PrevArchiveCheckDate))
         {
+            // Lines logged before the rotation belong in the archived file:
+            flush();
+
             {
                 LOCK(cs_log);
 
@@ -1017,8 +1091,15 @@ ScraperLogger& ScraperLogInstance()
 
 /** Protects the scraper logger singleton */
 CCriticalSection ScraperLogger::cs_log;
+std::atomic<bool> ScraperLogger::fInstantiated{false};
 boost::gregorian::date ScraperLogger::PrevArchiveCheckDate = boost::posix_time::from_time_t(GetAdjustedTime()).date();
 
+/** Writes out the lines queued for the scraper log. Called at shutdown. */
+void FlushScraperLog()
+{
+    if (ScraperLogger::fInstantiated) ScraperLogInstance().flush();
+}
+
 /** Accessor function to make scraper log entries using the scraper logger. Also shunts a subset of entries to the
  * debug log as appropriate.
  */
@@ -1688,7 +1769,7 @@ void Scraper(bool bSingleShot)
             _log(logattribute::INFO, "Scraper", "download size so far: " + ToString(ndownloadsize) + " upload size so far: "
                  + ToString(nuploadsize));
 
-            ScraperStats mScraperStats = GetScraperStatsByCurrentFileManifestState().mScraperStats;
+            ScraperStatsTable mScraperStats = GetScraperStatsByCurrentFileManifestState().mScraperStats;
 
             _log(logattribute::INFO, "Scraper", "mScraperStats has the following number of elements: "
                  + ToString(mScraperStats.size()));
@@ -3716,72 +3797,336 @@ bool StoreScraperFileManifest(const fs::path& file)
     return true;
 }
 
-bool StoreStats(const fs::path& file, const ScraperStats& mScraperStats)
+/** Orders project names like the "project,cpid" keys of the byCPIDbyProject entries in the statistics map, that is,
+ * as if each name ended with a comma. This differs from the plain name order of the byProject entries when one name
+ * is a prefix of another that continues with a character below the comma, like "foo" and "foo bar".
+ */
+static bool ProjectKeyLess(const std::string& a, const std::string& b)
 {
-    LOCK(cs_ConvergedStats);
-
-    if (fs::exists(file))
-        fs::remove(file);
-
-    fsbridge::ofstream outgzfile(file, std::ios_base::out | std::ios_base::binary);
+    const size_t length = std::min(a.size(), b.size());
+    const int result = a.compare(0, length, b, 0, length);
 
-    if (!outgzfile)
+    if (result != 0 || a.size() == b.size())
     {
-        _log(logattribute::ERR, "StoreStats", "Failed to open stats gzip file (" + file.string() + ")");
+        return result < 0;
+    }
 
-        return false;
+    if (a.size() < b.size())
+    {
+        return static_cast<unsigned char>(b[length]) >= ',';
     }
 
-    boostio::filtering_istream out;
-    out.push(boostio::gzip_compressor());
-    std::stringstream stream;
+    return static_cast<unsigned char>(a[length]) < ',';
+}
 
-    _log(logattribute::INFO, "StoreStats", "Started processing " + file.string());
+ScraperStatsTable::ScraperStatsTable(const ScraperStats& stats)
+{
+    for (const auto& entry : stats)
+    {
+        if (entry.first.objecttype == statsobjecttype::byProject)
+        {
+            m_projects.push_back(entry.first.objectID);
+        }
+        else if (entry.first.objecttype == statsobjecttype::byCPIDbyProject)
+        {
+            m_projects.push_back(entry.first.objectID.substr(0, entry.first.objectID.rfind(',')));
+        }
+    }
 
-    // Header.
-    stream << "StatsType," << "Project," << "CPID," << "TC," << "RAT," << "RAC," << "AvgRAC," << "Mag\n";
+    std::sort(m_projects.begin(), m_projects.end(), ProjectKeyLess);
+    m_projects.erase(std::unique(m_projects.begin(), m_projects.end()), m_projects.end());
+
+    const auto project_index = [&](const std::string& project) {
+        return static_cast<ProjectIndex>(
+            std::lower_bound(m_projects.begin(), m_projects.end(), project, ProjectKeyLess) - m_projects.begin());
+    };
 
-    for (auto const& entry : mScraperStats)
+    for (const auto& entry : stats)
     {
-        // This nonsense is to align the key to the columns of the csv.
-        std::string sobjectIDforcsv;
+        const std::string& object_id = entry.first.objectID;
 
-        switch(entry.first.objecttype)
+        switch (entry.first.objecttype)
         {
+        case statsobjecttype::NetworkWide:
+            m_network_wide = entry.second.statsvalue;
+            break;
+        case statsobjecttype::byCPID:
+            m_by_cpid.push_back({ GRC::Cpid::Parse(object_id), entry.second.statsvalue });
+            break;
+        case statsobjecttype::byProject:
+            m_by_project.push_back({ project_index(object_id), entry.second.statsvalue });
+            break;
         case statsobjecttype::byCPIDbyProject:
         {
-            sobjectIDforcsv = entry.first.objectID;
+            const size_t separator = object_id.rfind(',');
+
+            m_by_cpid_by_project.push_back({ project_index(object_id.substr(0, separator)),
+                                             GRC::Cpid::Parse(object_id.substr(separator + 1)),
+                                             entry.second.statsvalue });
             break;
         }
-        case statsobjecttype::byProject:
+        }
+    }
+
+    // The map orders CPIDs by their hex strings, which is the same as the byte order of well-formed CPIDs.
+    std::stable_sort(m_by_cpid.begin(), m_by_cpid.end(), [](const CpidEntry& a, const CpidEntry& b) {
+        return a.cpid < b.cpid;
+    });
+
+    std::stable_sort(m_by_cpid_by_project.begin(), m_by_cpid_by_project.end(),
+                     [](const ProjectCpidEntry& a, const ProjectCpidEntry& b) {
+        return std::tie(a.project, a.cpid) < std::tie(b.project, b.cpid);
+    });
+}
+
+ScraperStats ScraperStatsTable::ToMap() const
+{
+    ScraperStats stats;
+
+    const auto insert = [&](statsobjecttype objecttype, std::string object_id, const ScraperObjectStatsValue& statsvalue) {
+        ScraperObjectStats entry { { objecttype, std::move(object_id) }, statsvalue };
+
+        stats.emplace_hint(stats.end(), entry.statskey, entry);
+    };
+
+    if (m_network_wide)
+    {
+        insert(statsobjecttype::NetworkWide, "", *m_network_wide);
+    }
+
+    for (const auto& entry : m_by_cpid)
+    {
+        insert(statsobjecttype::byCPID, entry.cpid.ToString(), entry.statsvalue);
+    }
+
+    for (const auto& entry : m_by_project)
+    {
+        insert(statsobjecttype::byProject, m_projects[entry.project], entry.statsvalue);
+    }
+
+    for (const auto& entry : m_by_cpid_by_project)
+    {
+        insert(statsobjecttype::byCPIDbyProject, m_projects[entry.project] + "," + entry.cpid.ToString(),
+               entry.statsvalue);
+    }
+
+    return stats;
+}
+
+size_t ScraperStatsTable::size() const
+{
+    return (m_network_wide ? 1 : 0) + m_by_cpid.size() + m_by_project.size() + m_by_cpid_by_project.size();
+}
+
+const ScraperStatsTable::ProjectCpidEntry* ScraperStatsTable::Find(ProjectIndex project, const GRC::Cpid& cpid) const
+{
+    const auto iter = std::lower_bound(m_by_cpid_by_project.begin(), m_by_cpid_by_project.end(),
+                                       std::make_pair(project, cpid),
+                                       [](const ProjectCpidEntry& entry, const std::pair<ProjectIndex, GRC::Cpid>& key) {
+        return std::tie(entry.project, entry.cpid) < std::tie(key.first, key.second);
+    });
+
+    if (iter == m_by_cpid_by_project.end() || iter->project != project || iter->cpid != cpid)
+    {
+        return nullptr;
+    }
+
+    return &*iter;
+}
+
+void ScraperStatsTable::AddProject(const std::string& project, const ScraperObjectStatsValue& statsvalue,
+                                   const std::vector<CpidEntry>& cpids)
+{
+    ScraperStatsTable other;
+
+    other.m_projects.push_back(project);
+    other.m_by_project.push_back({ 0, statsvalue });
+    other.m_by_cpid_by_project.reserve(cpids.size());
+
+    for (const auto& entry : cpids)
+    {
+        other.m_by_cpid_by_project.push_back({ 0, entry.cpid, entry.statsvalue });
+    }
+
+    Merge(std::move(other));
+}
+
+void ScraperStatsTable::Merge(ScraperStatsTable&& other)
+{
+    if (!m_network_wide)
+    {
+        m_network_wide = other.m_network_wide;
+    }
+
+    if (!other.m_by_cpid.empty())
+    {
+        std::vector<CpidEntry> by_cpid;
+        by_cpid.reserve(m_by_cpid.size() + other.m_by_cpid.size());
+
+        std::set_union(m_by_cpid.begin(), m_by_cpid.end(), other.m_by_cpid.begin(), other.m_by_cpid.end(),
+                       std::back_inserter(by_cpid), [](const CpidEntry& a, const CpidEntry& b) {
+            return a.cpid < b.cpid;
+        });
+
+        m_by_cpid = std::move(by_cpid);
+    }
+
+    if (other.m_projects.empty())
+    {
+        return;
+    }
+
+    // The scraper adds projects in name order, so the entries of the other table usually go after the existing ones.
+    // The byProject entries follow the plain name order, which can differ from the order of the name table:
+    if (m_projects.empty()
+        || (ProjectKeyLess(m_projects.back(), other.m_projects.front())
+            && (m_by_project.empty() || other.m_by_project.empty()
+                || ProjectName(m_by_project.back().project) < other.ProjectName(other.m_by_project.front().project))))
+    {
+        const ProjectIndex offset = m_projects.size();
+
+        m_projects.insert(m_projects.end(),
+                          std::make_move_iterator(other.m_projects.begin()),
+                          std::make_move_iterator(other.m_projects.end()));
+
+        m_by_project.reserve(m_by_project.size() + other.m_by_project.size());
+        m_by_cpid_by_project.reserve(m_by_cpid_by_project.size() + other.m_by_cpid_by_project.size());
+
+        for (const auto& entry : other.m_by_project)
         {
-            sobjectIDforcsv = entry.first.objectID + ",";
-            break;
+            m_by_project.push_back({ entry.project + offset, entry.statsvalue });
         }
-        case statsobjecttype::byCPID:
+
+        for (const auto& entry : other.m_by_cpid_by_project)
         {
-            sobjectIDforcsv = "," + entry.first.objectID;
-            break;
+            m_by_cpid_by_project.push_back({ entry.project + offset, entry.cpid, entry.statsvalue });
         }
-        case statsobjecttype::NetworkWide:
+
+        return;
+    }
+
+    std::vector<std::string> projects;
+
+    std::set_union(m_projects.begin(), m_projects.end(), other.m_projects.begin(), other.m_projects.end(),
+                   std::back_inserter(projects), ProjectKeyLess);
+
+    // Both name tables are sorted, so mapping the indexes into the union preserves the order of the entries:
+    const auto reindex = [&](const std::vector<std::string>& names,
+                             std::vector<ProjectEntry>& by_project,
+                             std::vector<ProjectCpidEntry>& by_cpid_by_project) {
+        std::vector<ProjectIndex> indexes;
+        indexes.reserve(names.size());
+
+        for (const auto& name : names)
         {
-            sobjectIDforcsv = ",";
-            break;
+            indexes.push_back(std::lower_bound(projects.begin(), projects.end(), name, ProjectKeyLess)
+                              - projects.begin());
+        }
+
+        for (auto& entry : by_project)
+        {
+            entry.project = indexes[entry.project];
         }
+
+        for (auto& entry : by_cpid_by_project)
+        {
+            entry.project = indexes[entry.project];
         }
+    };
+
+    reindex(m_projects, m_by_project, m_by_cpid_by_project);
+    reindex(other.m_projects, other.m_by_project, other.m_by_cpid_by_project);
+
+    std::vector<ProjectEntry> by_project;
+    by_project.reserve(m_by_project.size() + other.m_by_project.size());
 
-        std::string sScraperStatsEntry = GetTextForstatsobjecttype(entry.first.objecttype) + ","
+    std::set_union(m_by_project.begin(), m_by_project.end(), other.m_by_project.begin(), other.m_by_project.end(),
+                   std::back_inserter(by_project), [&](const ProjectEntry& a, const ProjectEntry& b) {
+        return projects[a.project] < projects[b.project];
+    });
+
+    std::vector<ProjectCpidEntry> by_cpid_by_project;
+    by_cpid_by_project.reserve(m_by_cpid_by_project.size() + other.m_by_cpid_by_project.size());
+
+    std::set_union(m_by_cpid_by_project.begin(), m_by_cpid_by_project.end(),
+                   other.m_by_cpid_by_project.begin(), other.m_by_cpid_by_project.end(),
+                   std::back_inserter(by_cpid_by_project), [](const ProjectCpidEntry& a, const ProjectCpidEntry& b) {
+        return std::tie(a.project, a.cpid) < std::tie(b.project, b.cpid);
+    });
+
+    m_projects = std::move(projects);
+    m_by_project = std::move(by_project);
+    m_by_cpid_by_project = std::move(by_cpid_by_project);
+}
+
+void ScraperStatsTable::SetNetworkWide(std::vector<CpidEntry> by_cpid, const ScraperObjectStatsValue& statsvalue)
+{
+    m_by_cpid = std::move(by_cpid);
+    m_network_wide = statsvalue;
+}
+
+bool StoreStats(const fs::path& file, const ScraperStatsTable& mScraperStats)
+{
+    LOCK(cs_ConvergedStats);
+
+    if (fs::exists(file))
+        fs::remove(file);
+
+    fsbridge::ofstream outgzfile(file, std::ios_base::out | std::ios_base::binary);
+
+    if (!outgzfile)
+    {
+        _log(logattribute::ERR, "StoreStats", "Failed to open stats gzip file (" + file.string() + ")");
+
+        return false;
+    }
+
+    boostio::filtering_istream out;
+    out.push(boostio::gzip_compressor());
+    std::stringstream stream;
+
+    _log(logattribute::INFO, "StoreStats", "Started processing " + file.string());
+
+    // Header.
+    stream << "StatsType," << "Project," << "CPID," << "TC," << "RAT," << "RAC," << "AvgRAC," << "Mag\n";
+
+    // The object ID is aligned to the project and CPID columns of the csv.
+    const auto write_entry = [&](statsobjecttype objecttype, const std::string& sobjectIDforcsv,
+                                 const ScraperObjectStatsValue& statsvalue) {
+        std::string sScraperStatsEntry = GetTextForstatsobjecttype(objecttype) + ","
                 + sobjectIDforcsv + ","
-                + ToString(entry.second.statsvalue.dTC) + ","
-                + ToString(entry.second.statsvalue.dRAT) + ","
-                + ToString(entry.second.statsvalue.dRAC) + ","
-                + ToString(entry.second.statsvalue.dAvgRAC) + ","
-                + ToString(entry.second.statsvalue.dMag) + ","
+                + ToString(statsvalue.dTC) + ","
+                + ToString(statsvalue.dRAT) + ","
+                + ToString(statsvalue.dRAC) + ","
+                + ToString(statsvalue.dAvgRAC) + ","
+                + ToString(statsvalue.dMag) + ","
                 + "\n";
         stream << sScraperStatsEntry;
+    };
+
+    if (mScraperStats.NetworkWide())
+    {
+        write_entry(statsobjecttype::NetworkWide, ",", *mScraperStats.NetworkWide());
+    }
+
+    for (const auto& entry : mScraperStats.ByCPID())
+    {
+        write_entry(statsobjecttype::byCPID, "," + entry.cpid.ToString(), entry.statsvalue);
+    }
+
+    for (const auto& entry : mScraperStats.ByProject())
+    {
+        write_entry(statsobjecttype::byProject, mScraperStats.ProjectName(entry.project) + ",", entry.statsvalue);
+    }
+
+    for (const auto& entry : mScraperStats.ByCPIDbyProject())
+    {
+        write_entry(statsobjecttype::byCPIDbyProject,
+                    mScraperStats.ProjectName(entry.project) + "," + entry.cpid.ToString(),
+                    entry.statsvalue);
     }
 
-    _log(logattribute::INFO, "StoreStats", "Finished processing stats from map.");
+    _log(logattribute::INFO, "StoreStats", "Finished processing stats from table.");
 
     out.push(stream);
     boost::iostreams::copy(out, outgzfile);
@@ -3794,7 +4139,7 @@ bool StoreStats(const fs::path& file, const ScraperStats& mScraperStats)
 }
 
 bool LoadProjectFileToStatsByCPID(const std::string& project, const fs::path& file,
-                                  const double& projectmag, ScraperStats& mScraperStats)
+                                  const double& projectmag, ScraperStatsTable& mScraperStats)
 {
     fsbridge::ifstream ingzfile(file, std::ios_base::in | std::ios_base::binary);
 
@@ -3816,9 +4161,9 @@ bool LoadProjectFileToStatsByCPID(const std::string& project, const fs::path& fi
 }
 
 bool LoadProjectObjectToStatsByCPID(const std::string& project, const SerializeData& ProjectData,
-                                    const double& projectmag, ScraperStats& mScraperStats)
+                                    const double& projectmag, ScraperStatsTable& mScraperStats)
 {
-    boostio::basic_array_source<char> input_source((const char*)&ProjectData[0], ProjectData.size());
+    boostio::basic_array_source<char> input_source((const char*)ProjectData.data(), ProjectData.size());
     boostio::stream<boostio::basic_array_source<char>> ingzss(input_source);
 
     boostio::filtering_istream in;
@@ -3831,9 +4176,12 @@ bool LoadProjectObjectToStatsByCPID(const std::string& project, const SerializeD
 }
 
 bool ProcessProjectStatsFromStreamByCPID(const std::string& project, boostio::filtering_istream& sUncompressedIn,
-                                         const double& projectmag, ScraperStats& mScraperStats)
+                                         const double& projectmag, ScraperStatsTable& mScraperStats)
 {
-    std::vector<std::string> vXML;
+    std::vector<ScraperStatsTable::CpidEntry> vCPIDStats;
+
+    // Rows whose CPID cannot key a stats table entry, by the CPID string as written.
+    std::map<std::string, ScraperObjectStatsValue> mUnkeyedCPIDStats;
 
     // Lets vector the user blocks
     std::string line;
@@ -3849,7 +4197,7 @@ bool ProcessProjectStatsFromStreamByCPID(const std::string& project, boostio::fi
         if (fields.size() < 4)
             continue;
 
-        ScraperObjectStats statsentry = {};
+        ScraperStatsTable::CpidEntry statsentry = {};
 
         const std::string& sTC = fields[0];
         const std::string& sRAT = fields[1];
@@ -3901,150 +4249,189 @@ bool ProcessProjectStatsFromStreamByCPID(const std::string& project, boostio::fi
         // Mag is dealt with on the second pass, so is set to 0.0 on the first pass.
         statsentry.statsvalue.dMag = 0.0;
 
-        statsentry.statskey.objecttype = statsobjecttype::byCPIDbyProject;
-        statsentry.statskey.objectID = project + "," + cpid;
+        // The stats are keyed by the 16-byte CPID, which only the lowercase hex form that the scrapers write converts
+        // back to the same string. Other rows get no entry, but they still count toward the project totals as they
+        // did when the stats were keyed by string, so that the magnitudes of the other CPIDs do not change.
+        statsentry.cpid = GRC::Cpid::Parse(cpid);
+
+        if (statsentry.cpid.ToString() != cpid)
+        {
+            _log(logattribute::WARNING, __func__, "Cannot key cpid " + cpid + " for project " + project);
+
+            mUnkeyedCPIDStats[cpid] = statsentry.statsvalue;
+            dProjectRAC += statsentry.statsvalue.dRAC;
 
-        // Insert stats entry into map by the key.
-        mScraperStats[statsentry.statskey] = statsentry;
+            continue;
+        }
+
+        vCPIDStats.push_back(statsentry);
 
         // Increment project
         dProjectRAC += statsentry.statsvalue.dRAC;
     }
 
-    _log(logattribute::INFO, "LoadProjectObjectToStatsByCPID",
-         "There are " + ToString(mScraperStats.size()) + " CPID entries for " + project);
+    // Sort the entries into CPID order. When a CPID repeats, the last row wins, as it did when the rows were
+    // assigned to a map by key one at a time.
+    std::stable_sort(vCPIDStats.begin(), vCPIDStats.end(),
+                     [](const ScraperStatsTable::CpidEntry& a, const ScraperStatsTable::CpidEntry& b) {
+        return a.cpid < b.cpid;
+    });
 
-    // The mScraperStats here is scoped to only this project so we do not need project filtering here.
-    ScraperStats::iterator entry;
+    auto last = vCPIDStats.begin();
+
+    for (auto iter = vCPIDStats.begin(); iter != vCPIDStats.end(); ++iter)
+    {
+        if (last != vCPIDStats.begin() && std::prev(last)->cpid == iter->cpid)
+        {
+            *std::prev(last) = *iter;
+        }
+        else
+        {
+            *last++ = *iter;
+        }
+    }
+
+    vCPIDStats.erase(last, vCPIDStats.end());
+
+    _log(logattribute::INFO, "LoadProjectObjectToStatsByCPID",
+         "There are " + ToString(vCPIDStats.size()) + " CPID entries for " + project);
 
     // Statistics tracked for greylisted projects have zero project magnitude, so no need to go through
     // and update the CPID level mags. They are all zero if project magnitude is zero.
     if (projectmag > 0) {
-        for (auto const& entry : mScraperStats)
+        for (auto& entry : vCPIDStats)
         {
-            ScraperObjectStats statsentry;
-
-            statsentry.statskey = entry.first;
-            statsentry.statsvalue.dTC = entry.second.statsvalue.dTC;
-            statsentry.statsvalue.dRAT = entry.second.statsvalue.dRAT;
-            statsentry.statsvalue.dRAC = entry.second.statsvalue.dRAC;
-            // As per the above the individual (byCPIDbyProject) level the AvgRAC is the same as the RAC.
-            statsentry.statsvalue.dAvgRAC = entry.second.statsvalue.dAvgRAC;
-            statsentry.statsvalue.dMag = MagRound(entry.second.statsvalue.dRAC / dProjectRAC * projectmag);
+            entry.statsvalue.dMag = MagRound(entry.statsvalue.dRAC / dProjectRAC * projectmag);
+        }
 
-            // Update map entry with the magnitude.
-            mScraperStats[statsentry.statskey] = statsentry;
+        for (auto& entry : mUnkeyedCPIDStats)
+        {
+            entry.second.dMag = MagRound(entry.second.dRAC / dProjectRAC * projectmag);
         }
     }
 
     // Due to rounding to MAG_ROUND, the actual total project magnitude will not be exactly projectmag,
     // but it should be very close. Roll up project statistics.
-    ScraperObjectStats ProjectStatsEntry = {};
-
-    ProjectStatsEntry.statskey.objecttype = statsobjecttype::byProject;
-    ProjectStatsEntry.statskey.objectID = project;
+    ScraperObjectStatsValue ProjectStatsEntry = {};
 
     unsigned int nCPIDCount = 0;
-    for (auto const& entry : mScraperStats)
+    for (auto const& entry : vCPIDStats)
     {
-        ProjectStatsEntry.statsvalue.dTC += entry.second.statsvalue.dTC;
-        ProjectStatsEntry.statsvalue.dRAT += entry.second.statsvalue.dRAT;
-        ProjectStatsEntry.statsvalue.dRAC += entry.second.statsvalue.dRAC;
-        ProjectStatsEntry.statsvalue.dMag += entry.second.statsvalue.dMag;
+        ProjectStatsEntry.dTC += entry.statsvalue.dTC;
+        ProjectStatsEntry.dRAT += entry.statsvalue.dRAT;
+        ProjectStatsEntry.dRAC += entry.statsvalue.dRAC;
+        ProjectStatsEntry.dMag += entry.statsvalue.dMag;
+
+        nCPIDCount++;
+    }
+
+    for (auto const& entry : mUnkeyedCPIDStats)
+    {
+        ProjectStatsEntry.dTC += entry.second.dTC;
+        ProjectStatsEntry.dRAT += entry.second.dRAT;
+        ProjectStatsEntry.dRAC += entry.second.dRAC;
+        ProjectStatsEntry.dMag += entry.second.dMag;
 
         nCPIDCount++;
     }
 
     //Compute AvgRAC for project across CPIDs and set.
-    (nCPIDCount > 0) ? ProjectStatsEntry.statsvalue.dAvgRAC = ProjectStatsEntry.statsvalue.dRAC / nCPIDCount :
-            ProjectStatsEntry.statsvalue.dAvgRAC = 0.0;
+    (nCPIDCount > 0) ? ProjectStatsEntry.dAvgRAC = ProjectStatsEntry.dRAC / nCPIDCount :
+            ProjectStatsEntry.dAvgRAC = 0.0;
 
-    // Insert project level map entry.
-    mScraperStats[ProjectStatsEntry.statskey] = ProjectStatsEntry;
+    // Insert the project level entry and the CPID entries of the project.
+    mScraperStats.AddProject(project, ProjectStatsEntry, vCPIDStats);
 
     return true;
 }
 
-bool ProcessNetworkWideFromProjectStats(ScraperStats& mScraperStats)
+bool ProcessNetworkWideFromProjectStats(ScraperStatsTable& mScraperStats)
 {
-    // -------- CPID ----------------- stats entry ---- # of projects
-    std::map<std::string, std::pair<ScraperObjectStats, unsigned int>> mByCPID;
+    const std::vector<ScraperStatsTable::ProjectCpidEntry>& by_cpid_by_project = mScraperStats.ByCPIDbyProject();
+
+    // Group the entries by CPID. The stable sort keeps each CPID's projects in project order, so the sums below
+    // accumulate in the same order as they did over the map.
+    std::vector<const ScraperStatsTable::ProjectCpidEntry*> vByCPIDbyProject;
+    vByCPIDbyProject.reserve(by_cpid_by_project.size());
 
-    for (const auto& byCPIDbyProjectEntry : mScraperStats)
+    for (const auto& entry : by_cpid_by_project)
     {
-        if (byCPIDbyProjectEntry.first.objecttype == statsobjecttype::byCPIDbyProject)
+        vByCPIDbyProject.push_back(&entry);
+    }
+
+    std::stable_sort(vByCPIDbyProject.begin(), vByCPIDbyProject.end(),
+                     [](const ScraperStatsTable::ProjectCpidEntry* a, const ScraperStatsTable::ProjectCpidEntry* b) {
+        return a->cpid < b->cpid;
+    });
+
+    std::vector<ScraperStatsTable::CpidEntry> vByCPID;
+
+    // Number of projects tallied for each entry of vByCPID.
+    std::vector<unsigned int> vProjectCount;
+
+    for (const auto& byCPIDbyProjectEntry : vByCPIDbyProject)
+    {
+        if (!vByCPID.empty() && vByCPID.back().cpid == byCPIDbyProjectEntry->cpid)
         {
-            std::string CPID = split(byCPIDbyProjectEntry.first.objectID, ",")[1];
+            ScraperObjectStatsValue& statsvalue = vByCPID.back().statsvalue;
 
-            auto mByCPID_entry = mByCPID.find(CPID);
-            if (mByCPID_entry != mByCPID.end())
-            {
-                mByCPID_entry->second.first.statsvalue.dTC += byCPIDbyProjectEntry.second.statsvalue.dTC;
-                mByCPID_entry->second.first.statsvalue.dRAT += byCPIDbyProjectEntry.second.statsvalue.dRAT;
-                mByCPID_entry->second.first.statsvalue.dRAC += byCPIDbyProjectEntry.second.statsvalue.dRAC;
-                mByCPID_entry->second.first.statsvalue.dMag += byCPIDbyProjectEntry.second.statsvalue.dMag;
-                // Note the following is VERY inelegant. It CAPS the CPID magnitude to CPID_MAG_LIMIT.
-                // No attempt to renormalize the magnitudes due to this cap is done at this time. This means
-                // The total magnitude across projects will NOT match the total across all CPIDs and the network.
-                mByCPID_entry->second.first.statsvalue.dMag =
-                        std::min<double>(CPID_MAG_LIMIT, mByCPID_entry->second.first.statsvalue.dMag);
-                // Increment number of projects tallied
-                ++mByCPID_entry->second.second;
-            }
-            else
-            {
-                // Since an entry did not already exist, start a new one.
-                ScraperObjectStats CPIDStatsEntry;
-
-                CPIDStatsEntry.statskey.objecttype = statsobjecttype::byCPID;
-                CPIDStatsEntry.statskey.objectID = CPID;
-
-                CPIDStatsEntry.statsvalue.dTC = byCPIDbyProjectEntry.second.statsvalue.dTC;
-                CPIDStatsEntry.statsvalue.dRAT = byCPIDbyProjectEntry.second.statsvalue.dRAT;
-                CPIDStatsEntry.statsvalue.dRAC = byCPIDbyProjectEntry.second.statsvalue.dRAC;
-                // Note the following is VERY inelegant. It CAPS the CPID magnitude to CPID_MAG_LIMIT.
-                // No attempt to renormalize the magnitudes due to this cap is done at this time. This means
-                // The total magnitude across projects will NOT match the total across all CPIDs and the network.
-                CPIDStatsEntry.statsvalue.dMag =
-                        std::min<double>(CPID_MAG_LIMIT, byCPIDbyProjectEntry.second.statsvalue.dMag);
-
-                // This is the first project encountered, because otherwise there would already be an entry.
-                mByCPID[CPID] = std::make_pair(CPIDStatsEntry, 1);
-            }
+            statsvalue.dTC += byCPIDbyProjectEntry->statsvalue.dTC;
+            statsvalue.dRAT += byCPIDbyProjectEntry->statsvalue.dRAT;
+            statsvalue.dRAC += byCPIDbyProjectEntry->statsvalue.dRAC;
+            statsvalue.dMag += byCPIDbyProjectEntry->statsvalue.dMag;
+            // Note the following is VERY inelegant. It CAPS the CPID magnitude to CPID_MAG_LIMIT.
+            // No attempt to renormalize the magnitudes due to this cap is done at this time. This means
+            // The total magnitude across projects will NOT match the total across all CPIDs and the network.
+            statsvalue.dMag = std::min<double>(CPID_MAG_LIMIT, statsvalue.dMag);
+            // Increment number of projects tallied
+            ++vProjectCount.back();
+        }
+        else
+        {
+            // Since an entry did not already exist, start a new one.
+            ScraperStatsTable::CpidEntry CPIDStatsEntry = {};
+
+            CPIDStatsEntry.cpid = byCPIDbyProjectEntry->cpid;
+
+            CPIDStatsEntry.statsvalue.dTC = byCPIDbyProjectEntry->statsvalue.dTC;
+            CPIDStatsEntry.statsvalue.dRAT = byCPIDbyProjectEntry->statsvalue.dRAT;
+            CPIDStatsEntry.statsvalue.dRAC = byCPIDbyProjectEntry->statsvalue.dRAC;
+            // Note the following is VERY inelegant. It CAPS the CPID magnitude to CPID_MAG_LIMIT.
+            // No attempt to renormalize the magnitudes due to this cap is done at this time. This means
+            // The total magnitude across projects will NOT match the total across all CPIDs and the network.
+            CPIDStatsEntry.statsvalue.dMag = std::min<double>(CPID_MAG_LIMIT, byCPIDbyProjectEntry->statsvalue.dMag);
+
+            // This is the first project encountered, because otherwise there would already be an entry.
+            vByCPID.push_back(CPIDStatsEntry);
+            vProjectCount.push_back(1);
         }
     }
 
     unsigned int nCPIDProjectCount = 0;
 
     //Also track the network wide rollup.
-    ScraperObjectStats NetworkWideStatsEntry {};
-
-    NetworkWideStatsEntry.statskey.objecttype = statsobjecttype::NetworkWide;
-    // ObjectID is blank string for network-wide.
-    NetworkWideStatsEntry.statskey.objectID = "";
+    ScraperObjectStatsValue NetworkWideStatsEntry {};
 
-    for (auto mByCPID_entry = mByCPID.begin(); mByCPID_entry != mByCPID.end(); ++mByCPID_entry)
+    for (size_t i = 0; i < vByCPID.size(); ++i)
     {
-        unsigned int nProjectCount = mByCPID_entry->second.second;
+        ScraperObjectStatsValue& statsvalue = vByCPID[i].statsvalue;
+        unsigned int nProjectCount = vProjectCount[i];
 
         // Compute CPID AvgRAC across the projects for that CPID and set.
         if (nProjectCount)
         {
-            mByCPID_entry->second.first.statsvalue.dAvgRAC = mByCPID_entry->second.first.statsvalue.dRAC / nProjectCount;
+            statsvalue.dAvgRAC = statsvalue.dRAC / nProjectCount;
         }
         else
         {
-            mByCPID_entry->second.first.statsvalue.dAvgRAC = 0.0;
+            statsvalue.dAvgRAC = 0.0;
         }
 
-        // Update scraper map with complete entry including dAvgRAC
-        mScraperStats[mByCPID_entry->second.first.statskey] = mByCPID_entry->second.first;
-
         // Increment the network wide stats.
-        NetworkWideStatsEntry.statsvalue.dTC += mByCPID_entry->second.first.statsvalue.dTC;
-        NetworkWideStatsEntry.statsvalue.dRAT += mByCPID_entry->second.first.statsvalue.dRAT;
-        NetworkWideStatsEntry.statsvalue.dRAC += mByCPID_entry->second.first.statsvalue.dRAC;
-        NetworkWideStatsEntry.statsvalue.dMag += mByCPID_entry->second.first.statsvalue.dMag;
+        NetworkWideStatsEntry.dTC += statsvalue.dTC;
+        NetworkWideStatsEntry.dRAT += statsvalue.dRAT;
+        NetworkWideStatsEntry.dRAC += statsvalue.dRAC;
+        NetworkWideStatsEntry.dMag += statsvalue.dMag;
 
         ++nCPIDProjectCount;
     }
@@ -4052,15 +4439,118 @@ bool ProcessNetworkWideFromProjectStats(ScraperStats& mScraperStats)
     // Compute Network AvgRAC across all ByCPIDByProject elements and set.
     if (nCPIDProjectCount)
     {
-        NetworkWideStatsEntry.statsvalue.dAvgRAC = NetworkWideStatsEntry.statsvalue.dRAC / nCPIDProjectCount;
+        NetworkWideStatsEntry.dAvgRAC = NetworkWideStatsEntry.dRAC / nCPIDProjectCount;
     }
     else
     {
-        NetworkWideStatsEntry.statsvalue.dAvgRAC = 0.0;
+        NetworkWideStatsEntry.dAvgRAC = 0.0;
+    }
+
+    // Replace the byCPID entries, which now include dAvgRAC, and the (single) network-wide entry.
+    mScraperStats.SetNetworkWide(std::move(vByCPID), NetworkWideStatsEntry);
+
+    return true;
+}
+
+//!
+//! \brief Maximum number of threads that decompress and parse project parts.
+//!
+constexpr unsigned int MAX_STATS_THREADS = 8;
+
+bool LoadProjectPartsToStatsByCPID(const ConvergedManifest& StructConvergedManifest, const WhitelistSnapshot& greylist,
+                                   const double& dMagnitudePerProject, ScraperStatsTable& mScraperStats)
+{
+    struct ProjectPart
+    {
+        std::string project;
+        std::shared_ptr<const SerializeData> data;
+        double projectmag;
+        ScraperStatsTable stats;
+    };
+
+    std::vector<ProjectPart> parts;
+
+    for (const auto& entry : StructConvergedManifest.ConvergedManifestPartPtrsMap)
+    {
+        const std::string& project = entry.first;
+
+        // Do not process the BeaconList, VerifiedBeacons, ProjectsAllCpidTotalCredits, or ProjectPublicKeys
+        // as a project stats file.
+        if (project == "BeaconList" || project == "VerifiedBeacons" || project == "ProjectsAllCpidTotalCredits"
+                || project == "ProjectPublicKeys")
+        {
+            continue;
+        }
+
+        std::shared_ptr<const SerializeData> data = entry.second->GetData();
+
+        if (!data)
+        {
+            _log(logattribute::ERR, "LoadProjectPartsToStatsByCPID", "Part data for project " + project
+                 + " is not available. Requesting it again.");
+
+            CSplitBlob::RequestPart(entry.second->hash);
+
+            return false;
+        }
+
+        // Project magnitude for a greylisted project is zero.
+        parts.push_back({ project, std::move(data), greylist.Contains(project) ? 0.0 : dMagnitudePerProject, {} });
+    }
+
+    std::atomic<size_t> next_part { 0 };
+    std::exception_ptr error;
+    Mutex error_mutex;
+
+    const auto worker = [&]() {
+        for (size_t i = next_part++; i < parts.size(); i = next_part++)
+        {
+            ProjectPart& part = parts[i];
+
+            _log(logattribute::INFO, "LoadProjectPartsToStatsByCPID", "Processing stats for project: " + part.project);
+
+            try
+            {
+                LoadProjectObjectToStatsByCPID(part.project, *part.data, part.projectmag, part.stats);
+            }
+            catch (...)
+            {
+                LOCK(error_mutex);
+                if (!error) error = std::current_exception();
+                next_part = parts.size();
+            }
+        }
+    };
+
+    const size_t thread_count = std::min<size_t>(
+        std::clamp(std::thread::hardware_concurrency(), 1u, MAX_STATS_THREADS),
+        std::max<size_t>(parts.size(), 1));
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        threads.emplace_back(worker);
     }
 
-    // Insert the (single) network-wide entry into the overall map.
-    mScraperStats[NetworkWideStatsEntry.statskey] = NetworkWideStatsEntry;
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    // The keys of different projects never collide, and the parts are in
+    // project name order, so each merge appends to the table.
+    for (auto& part : parts)
+    {
+        mScraperStats.Merge(std::move(part.stats));
+    }
 
     return true;
 }
@@ -4106,7 +4596,7 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsByCurrentFileManifestStat
                     {
                         std::string project = entry.first;
                         fs::path file = pathScraper / entry.second.filename;
-                        ScraperStats mProjectScraperStats;
+                        ScraperStatsTable mProjectScraperStats;
 
                         _log(logattribute::INFO, "GetScraperStatsByCurrentFileManifestState",
                              "Processing stats for project: " + project);
@@ -4118,11 +4608,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsByCurrentFileManifestStat
                             LoadProjectFileToStatsByCPID(project, file, 0.0, mProjectScraperStats);
                         }
 
-                        // Insert into overall map.
-                        for (auto const& entry2 : mProjectScraperStats)
-                        {
-                            stats_verified_beacons_tc.mScraperStats[entry2.first] = entry2.second;
-                        }
+                        // Insert into overall table.
+                        stats_verified_beacons_tc.mScraperStats.Merge(std::move(mProjectScraperStats));
                     }
                 }
 
@@ -4167,7 +4654,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsByConvergedManifest(const
     auto iter = StructConvergedManifest.ConvergedManifestPartPtrsMap.find("VerifiedBeacons");
     if (iter != StructConvergedManifest.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -4184,7 +4672,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsByConvergedManifest(const
     iter = StructConvergedManifest.ConvergedManifestPartPtrsMap.find("ProjectsAllCpidTotalCredits");
     if (iter != StructConvergedManifest.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -4220,40 +4709,20 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsByConvergedManifest(const
 
     double dMagnitudePerProject = NETWORK_MAGNITUDE / nActiveProjects;
 
-    ScraperStats mScraperStats;
-
+    ScraperStatsTable mScraperStats;
 
-    for (auto entry = StructConvergedManifest.ConvergedManifestPartPtrsMap.begin();
-         entry != StructConvergedManifest.ConvergedManifestPartPtrsMap.end(); ++entry)
+    // Without every project part, the stats cannot reproduce the convergence. Return no stats, as if there were
+    // no convergence:
+    if (!LoadProjectPartsToStatsByCPID(StructConvergedManifest, greylist, dMagnitudePerProject, mScraperStats))
     {
-        std::string project = entry->first;
-        ScraperStats mProjectScraperStats;
+        _log(logattribute::ERR, "GetScraperStatsByConvergedManifest", "Stats processing failed: missing project part");
 
-        // Do not process the BeaconList, VerifiedBeacons, ProjectsAllCpidTotalCredits, or ProjectPublicKeys
-        // as a project stats file.
-        if (project != "BeaconList" && project != "VerifiedBeacons" && project != "ProjectsAllCpidTotalCredits"
-                && project != "ProjectPublicKeys")
-        {
-            _log(logattribute::INFO, "GetScraperStatsByConvergedManifest", "Processing stats for project: " + project);
-
-            if (!greylist.Contains(project)) {
-                LoadProjectObjectToStatsByCPID(project, entry->second->data, dMagnitudePerProject, mProjectScraperStats);
-            } else {
-                // Project magnitude for a greylisted project is zero.
-                LoadProjectObjectToStatsByCPID(project, entry->second->data, 0.0, mProjectScraperStats);
-            }
-
-            // Insert into overall map.
-            for (auto const& entry2 : mProjectScraperStats)
-            {
-                mScraperStats[entry2.first] = entry2.second;
-            }
-        }
+        return {};
     }
 
     ProcessNetworkWideFromProjectStats(mScraperStats);
 
-    stats_verified_beacons_tc.mScraperStats = mScraperStats;
+    stats_verified_beacons_tc.mScraperStats = std::move(mScraperStats);
 
     _log(logattribute::INFO, "GetScraperStatsByConvergedManifest", "Completed stats processing");
 
@@ -4283,7 +4752,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsFromSingleManifest(CScrap
     auto iter = StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.find("VerifiedBeacons");
     if (iter != StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -4304,7 +4774,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsFromSingleManifest(CScrap
     iter = StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.find("ProjectsAllCpidTotalCredits");
     if (iter != StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -4341,29 +4812,12 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsFromSingleManifest(CScrap
 
     double dMagnitudePerProject = NETWORK_MAGNITUDE / nActiveProjects;
 
-    for (auto entry = StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.begin();
-         entry != StructDummyConvergedManifest.ConvergedManifestPartPtrsMap.end(); ++entry)
+    if (!LoadProjectPartsToStatsByCPID(StructDummyConvergedManifest, greylist, dMagnitudePerProject,
+                                       stats_verified_beacons_tc.mScraperStats))
     {
-        std::string project = entry->first;
-        ScraperStats mProjectScraperStats;
+        _log(logattribute::ERR, "GetScraperStatsFromSingleManifest", "Stats processing failed: missing project part");
 
-        // Do not process the BeaconList, VerifiedBeacons, ProjectsAllCpidTotalCredits, or ProjectPublicKeys
-        // as a project stats file.
-        if (project != "BeaconList" && project != "VerifiedBeacons" && project != "ProjectsAllCpidTotalCredits"
-                && project != "ProjectPublicKeys")
-        {
-            _log(logattribute::INFO, "GetScraperStatsFromSingleManifest", "Processing stats for project: " + project);
-
-            if (!greylist.Contains(project)) {
-                LoadProjectObjectToStatsByCPID(project, entry->second->data, dMagnitudePerProject, mProjectScraperStats);
-            } else {
-                // Project magnitude for a greylisted project is zero.
-                LoadProjectObjectToStatsByCPID(project, entry->second->data, 0.0, mProjectScraperStats);
-            }
-
-            // Insert into overall map.
-            stats_verified_beacons_tc.mScraperStats.insert(mProjectScraperStats.begin(), mProjectScraperStats.end());
-       }
+        return {};
     }
 
     ProcessNetworkWideFromProjectStats(stats_verified_beacons_tc.mScraperStats);
@@ -4468,7 +4922,16 @@ bool ScraperSaveCScraperManifestToFiles(uint256 nManifestHash)
             return false;
         }
 
-        outfile.write((const char*)iter->data.data(), iter->data.size());
+        const std::shared_ptr<const SerializeData> data = iter->GetData();
+
+        if (!data)
+        {
+            _log(logattribute::ERR, "ScraperSaveCScraperManifestToFiles", "Part data for (" + outputfile + ") is not available.");
+
+            return false;
+        }
+
+        outfile.write((const char*)data->data(), data->size());
 
         outfile.flush();
         outfile.close();
@@ -5087,11 +5550,11 @@ bool ConvergedManifest::operator()(const CScraperManifest_shared_ptr& in)
     bool bConvergedContentHashMatches = WITH_LOCK(CScraperConvergedManifest_ptr->cs_manifest,
                                                   return PopulateConvergedManifestPartPtrsMap());
 
-    ComputeConvergedContentHash();
+    const bool bConvergedContentHashComputed = ComputeConvergedContentHash();
 
     nUnderlyingManifestContentHash = in->nContentHash;
 
-    return bConvergedContentHashMatches;
+    return bConvergedContentHashMatches && bConvergedContentHashComputed;
 }
 
 bool ConvergedManifest::PopulateConvergedManifestPartPtrsMap()
@@ -5139,16 +5602,29 @@ EXCLUSIVE_LOCKS_REQUIRED(CScraperConvergedManifest_ptr->cs_manifest)
     return true;
 }
 
-void ConvergedManifest::ComputeConvergedContentHash()
+bool ConvergedManifest::ComputeConvergedContentHash()
 {
     CDataStream ss(SER_NETWORK,1);
 
     for (const auto& iter : ConvergedManifestPartPtrsMap)
     {
-        ss << iter.second->data;
+        const std::shared_ptr<const SerializeData> data = iter.second->GetData();
+
+        if (!data)
+        {
+            _log(logattribute::ERR, "ComputeConvergedContentHash", "Part data for " + iter.first + " is not available.");
+
+            nContentHash.SetNull();
+
+            return false;
+        }
+
+        ss << *data;
     }
 
     nContentHash = Hash(ss);
+
+    return true;
 }
 
 // ------------------------------------ This an out parameter.
@@ -5534,7 +6010,8 @@ bool ScraperConstructConvergedManifestByProject(const WhitelistSnapshot& project
                     iPart = CSplitBlob::mapParts.find(std::get<0>(iter.second));
                 }
 
-                uint256 nContentHashCheck = Hash(iPart->second.data);
+                const std::shared_ptr<const SerializeData> data = iPart->second.GetData();
+                uint256 nContentHashCheck = data ? Hash(*data) : uint256{};
 
                 if (nContentHashCheck != iPart->first)
                 {
@@ -5613,7 +6090,7 @@ bool ScraperConstructConvergedManifestByProject(const WhitelistSnapshot& project
         LOCK(manifest->cs_manifest);
 
         // Bail if BeaconList is not found or empty.
-        if (pair == CScraperManifest::mapManifest.end() || manifest->vParts[0]->data.size() == 0)
+        if (pair == CScraperManifest::mapManifest.end() || !manifest->vParts[0]->present())
         {
             _log(logattribute::WARNING, "ScraperConstructConvergedManifestByProject",
                  "BeaconList was not found in the converged manifests from the scrapers.");
@@ -5699,7 +6176,15 @@ bool ScraperConstructConvergedManifestByProject(const WhitelistSnapshot& project
                 }
             }
 
-            StructConvergedManifest.ComputeConvergedContentHash();
+            if (!StructConvergedManifest.ComputeConvergedContentHash())
+            {
+                _log(logattribute::ERR, "ScraperConstructConvergedManifestByProject",
+                     "Part data of the converged manifest is not available.");
+
+                StructConvergedManifest = {};
+
+                return false;
+            }
 
             StructConvergedManifest.timestamp = GetAdjustedTime();
             StructConvergedManifest.bByParts = true;
@@ -5942,12 +6427,19 @@ bool LoadBeaconListFromConvergedManifest(const ConvergedManifest& StructConverge
     auto iter = StructConvergedManifest.ConvergedManifestPartPtrsMap.find("BeaconList");
 
     // Bail if the beacon list is not found, or the part is zero size (missing referenced part)
-    if (iter == StructConvergedManifest.ConvergedManifestPartPtrsMap.end() || iter->second->data.size() == 0)
+    if (iter == StructConvergedManifest.ConvergedManifestPartPtrsMap.end() || !iter->second->present())
+    {
+        return false;
+    }
+
+    const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+
+    if (!data || data->empty())
     {
         return false;
     }
 
-    boostio::basic_array_source<char> input_source((char*)&iter->second->data[0], iter->second->data.size());
+    boostio::basic_array_source<char> input_source((char*)data->data(), data->size());
     boostio::stream<boostio::basic_array_source<char>> ingzss(input_source);
 
     boostio::filtering_istream in;
@@ -5996,7 +6488,8 @@ std::vector<uint160> GetVerifiedBeaconIDs(const ConvergedManifest& StructConverg
     const auto& iter = StructConvergedManifest.ConvergedManifestPartPtrsMap.find("VerifiedBeacons");
     if (iter != StructConvergedManifest.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -6043,7 +6536,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsVerifiedBeaconsTotalCredi
     auto iter = stats.Convergence.ConvergedManifestPartPtrsMap.find("VerifiedBeacons");
     if (iter != stats.Convergence.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -6058,7 +6552,8 @@ ScraperStatsVerifiedBeaconsTotalCredits GetScraperStatsVerifiedBeaconsTotalCredi
     iter = stats.Convergence.ConvergedManifestPartPtrsMap.find("ProjectsAllCpidTotalCredits");
     if (iter != stats.Convergence.ConvergedManifestPartPtrsMap.end())
     {
-        CDataStream part(iter->second->data, SER_NETWORK, 1);
+        const std::shared_ptr<const SerializeData> data = iter->second->GetData();
+        CDataStream part(data ? *data : SerializeData(), SER_NETWORK, 1);
 
         try
         {
@@ -6166,6 +6661,10 @@ Superblock ScraperGetSuperblockContract(bool bStoreConvergedStats, bool bContrac
                 ScraperStatsVerifiedBeaconsTotalCredits mScraperConvergedStats
                         = GetScraperStatsByConvergedManifest(StructConvergedManifest);
 
+                // The stats are empty if a project part of the convergence is missing. Treat this like no
+                // convergence until the part arrives again.
+                if (mScraperConvergedStats.mScraperStats.empty()) return empty_superblock;
+
                 _log(logattribute::INFO, "ScraperGetSuperblockContract",
                      "mScraperStats has the following number of elements: "
                      + ToString(mScraperConvergedStats.mScraperStats.size()));
@@ -6904,7 +7403,7 @@ UniValue scraperreport(const UniValue& params, bool fHelp)
 
                 const CSplitBlob::CPart& part = iter.second;
 
-                uint64_t part_data_size = part.data.size();
+                uint64_t part_data_size = part.size();
 
                 total_part_data_size += part_data_size;
 
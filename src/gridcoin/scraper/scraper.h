@@ -123,6 +123,10 @@ typedef std::map<std::string, std::map<std::string, int64_t>> mTeamIDs;
  * @return uint256 hash
  */
 uint256 GetFileHash(const fs::path& inputfile);
+/**
+ * @brief Waits until the scraper log writer thread has written every queued line. Called at shutdown.
+ */
+void FlushScraperLog();
 /**
  * @brief Provides the computed scraper stats and verified beacons from the input converged manifest
  * @param StructConvergedManifest
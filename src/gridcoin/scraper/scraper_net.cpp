@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <atomic>
+#include <deque>
 #include <stdexcept>
 #include "main.h"
 #include "net.h"
@@ -18,11 +19,75 @@
 #include "gridcoin/appcache.h"
 #include "gridcoin/project.h"
 #include "gridcoin/scraper/fwd.h"
+#include "gridcoin/scraper/part_delta.h"
+#include "gridcoin/scraper/part_store.h"
 #include "gridcoin/scraper/scraper_net.h"
 #include "gridcoin/superblock.h"
 
 //Globals
 std::map<uint256, std::pair<int64_t, std::shared_ptr<CScraperManifest>>> CScraperManifest::mapPendingDeletedManifest;
+std::map<std::string, std::pair<int64_t, uint256>> CScraperManifest::mapLatestParts;
+
+/** Maximum number of delta bases remembered for a peer, in either direction. A peer only uses the base of the part
+ *  it asks us for, but it names bases to every peer that announces a manifest, so the maps must not grow without bound.
+ */
+static constexpr size_t MAX_PART_BASES_PER_NODE = 1000;
+
+/** Number of part deltas remembered after building them. Nodes that sync the same manifests ask for the same deltas. */
+static constexpr size_t MAX_CACHED_PART_DELTAS = 64;
+
+/** Maximum number of part deltas built for a peer per PART_DELTA_WINDOW seconds. Building a delta inflates two
+ *  stats files and compresses the result, so a peer must not make us do that without limit. Deltas taken from the
+ *  cache do not count. Once the limit is reached, the peer receives whole parts.
+ */
+static constexpr unsigned int MAX_PART_DELTAS_PER_NODE = 64;
+static constexpr int64_t PART_DELTA_WINDOW = 10 * 60;
+
+namespace {
+/** Remembers the part deltas built recently, keyed by the base and the target part hashes. A null delta records that
+ *  no delta smaller than the part exists.
+ */
+class PartDeltaCache
+{
+public:
+    typedef std::pair<uint256, uint256> Key;
+
+    bool Get(const Key& key, std::shared_ptr<const SerializeData>& delta) const
+    {
+        LOCK(m_mutex);
+
+        auto iter = m_deltas.find(key);
+
+        if (iter == m_deltas.end()) return false;
+
+        delta = iter->second;
+
+        return true;
+    }
+
+    void Put(const Key& key, std::shared_ptr<const SerializeData> delta)
+    {
+        LOCK(m_mutex);
+
+        if (!m_deltas.emplace(key, std::move(delta)).second) return;
+
+        m_order.push_back(key);
+
+        if (m_order.size() > MAX_CACHED_PART_DELTAS)
+        {
+            m_deltas.erase(m_order.front());
+            m_order.pop_front();
+        }
+    }
+
+private:
+    mutable Mutex m_mutex;
+    std::map<Key, std::shared_ptr<const SerializeData>> m_deltas GUARDED_BY(m_mutex);
+    std::deque<Key> m_order GUARDED_BY(m_mutex); //!< Keys in insertion order, oldest first.
+};
+
+PartDeltaCache g_part_delta_cache;
+} // anonymous namespace
 extern unsigned int SCRAPER_MISBEHAVING_NODE_BANSCORE;
 extern int64_t SCRAPER_DEAUTHORIZED_BANSCORE_GRACE_PERIOD;
 extern int64_t SCRAPER_CMANIFEST_RETENTION_TIME;
@@ -45,6 +110,7 @@ bool CSplitBlob::RecvPart(CNode* pfrom, CDataStream& vRecv)
     auto& ss = vRecv;
     uint256 hash(Hash(ss));
     mapAlreadyAskedFor.erase(CInv(MSG_PART, hash));
+    if (pfrom) pfrom->mapPartBasesNamed.erase(hash);
 
     LOCK(cs_mapParts);
 
@@ -59,7 +125,13 @@ bool CSplitBlob::RecvPart(CNode* pfrom, CDataStream& vRecv)
         {
             LogPrint(BCLog::LogFlags::MANIFEST, "received part %s %u refs", hash.GetHex(), (unsigned) part.refs.size());
 
-            part.data = SerializeData(vRecv.begin(), vRecv.end());
+            // The objects that reference a part lost by the part store already counted it as received.
+            const bool recovered = part.received();
+
+            part.SetData(SerializeData(vRecv.begin(), vRecv.end()));
+
+            if (recovered) return true;
+
             for (const auto& ref : part.refs)
             {
                 CSplitBlob& split = *ref.first;
@@ -95,6 +167,119 @@ bool CSplitBlob::RecvPart(CNode* pfrom, CDataStream& vRecv)
     }
 }
 
+bool CSplitBlob::RecvPartBase(CNode* pfrom, CDataStream& vRecv)
+{
+    uint256 hash;
+    uint256 base_hash;
+
+    vRecv >> hash >> base_hash;
+
+    if (pfrom->mapPartBases.size() >= MAX_PART_BASES_PER_NODE)
+    {
+        pfrom->mapPartBases.erase(pfrom->mapPartBases.begin());
+    }
+
+    pfrom->mapPartBases[hash] = base_hash;
+
+    return true;
+}
+
+bool CSplitBlob::RecvPartDelta(CNode* pfrom, CDataStream& vRecv)
+{
+    uint256 hash;
+    uint256 base_hash;
+    SerializeData delta;
+
+    vRecv >> hash >> base_hash >> delta;
+
+    // Only accept the delta against the base that we named to this node when we asked it for the part.
+    auto inamed = pfrom->mapPartBasesNamed.find(hash);
+
+    if (inamed == pfrom->mapPartBasesNamed.end() || inamed->second != base_hash)
+    {
+        LOCK(cs_ScraperGlobals);
+
+        pfrom->Misbehaving(SCRAPER_MISBEHAVING_NODE_BANSCORE / 5);
+        LogPrintf("WARNING: CSplitBlob::RecvPartDelta: Unrequested part delta received from %s. Adding %u banscore.",
+                  pfrom->addr.ToString(), SCRAPER_MISBEHAVING_NODE_BANSCORE / 5);
+
+        return false;
+    }
+
+    pfrom->mapPartBasesNamed.erase(inamed);
+
+    std::shared_ptr<const SerializeData> base_data;
+
+    {
+        LOCK(cs_mapParts);
+
+        auto ipart = mapParts.find(hash);
+
+        if (ipart == mapParts.end() || ipart->second.present())
+        {
+            LogPrint(BCLog::LogFlags::MANIFEST, "received unneeded part delta %s", hash.GetHex());
+            return false;
+        }
+
+        auto ibase = mapParts.find(base_hash);
+
+        if (ibase != mapParts.end())
+        {
+            base_data = ibase->second.GetData();
+        }
+    }
+
+    // Rebuilding the part inflates and compresses a whole stats file, so do it without holding cs_mapParts.
+    std::optional<SerializeData> data;
+
+    if (base_data)
+    {
+        data = ApplyScraperPartDelta(*base_data, delta);
+    }
+
+    // The sender forgets the base after one delta, so asking again fetches the whole part. The sender checks that
+    // the delta rebuilds the part before sending it, so a delta that rebuilds the wrong text counts as misbehavior,
+    // unless this node lost the base part since it named it. Text that matches but compresses to a different part
+    // only means that the zlib builds differ, so the node just fetches the whole part.
+    if (!data || Hash(*data) != hash)
+    {
+        if (base_data && !data)
+        {
+            LOCK(cs_ScraperGlobals);
+
+            pfrom->Misbehaving(SCRAPER_MISBEHAVING_NODE_BANSCORE / 5);
+            LogPrintf("WARNING: CSplitBlob::RecvPartDelta: Part delta %s from %s does not apply to base %s. "
+                      "Adding %u banscore.", hash.GetHex(), pfrom->addr.ToString(), base_hash.GetHex(),
+                      SCRAPER_MISBEHAVING_NODE_BANSCORE / 5);
+        }
+
+        LogPrint(BCLog::LogFlags::MANIFEST, "part delta %s does not rebuild from base %s, requesting whole part",
+                 hash.GetHex(), base_hash.GetHex());
+
+        mapAlreadyAskedFor.erase(CInv(MSG_PART, hash));
+        pfrom->AskFor(CInv(MSG_PART, hash));
+
+        return false;
+    }
+
+    LogPrint(BCLog::LogFlags::MANIFEST, "received part %s as %u byte delta of %s", hash.GetHex(),
+             (unsigned) delta.size(), base_hash.GetHex());
+
+    CDataStream ss(*data, SER_NETWORK, PROTOCOL_VERSION);
+
+    return RecvPart(pfrom, ss);
+}
+
+void CSplitBlob::RequestPart(const uint256& hash)
+{
+    LOCK(cs_vNodes);
+
+    for (auto const& pnode : vNodes)
+    {
+        pnode->AskFor(CInv(MSG_PART, hash));
+    }
+}
+
 bool CSplitBlob::isComplete() const EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manifest)
 {
     return (!m_publish_in_progress && cntPartsRcvd == vParts.size());
@@ -107,13 +292,13 @@ void CSplitBlob::addPart(const uint256& ihash)
     assert(ihash != Hash(MakeByteSpan(vParts)));
 
     unsigned n = vParts.size();
-    auto rc = mapParts.emplace(ihash,CPart(ihash));
+    auto rc = mapParts.try_emplace(ihash, ihash);
     CPart& part = rc.first->second;
 
     /* add to local vector */
     vParts.push_back(&part);
 
-    if (part.present()) cntPartsRcvd++;
+    if (part.received()) cntPartsRcvd++;
 
     /* nature of set ensures no duplicates */
     part.refs.emplace(this, n);
@@ -127,7 +312,7 @@ int CSplitBlob::addPartData(CDataStream&& vData, const bool& publish_in_progress
 
     uint256 hash(Hash(vData));
 
-    auto it = mapParts.emplace(hash, CPart(hash));
+    auto it = mapParts.try_emplace(hash, hash);
 
     /* common part */
     CPart& part = it.first->second;
@@ -157,18 +342,61 @@ CSplitBlob::~CSplitBlob()
 
         part.refs.erase(std::pair<CSplitBlob*, unsigned int>(this, n));
 
-        if (part.refs.empty()) mapParts.erase(part.hash);
+        if (part.refs.empty())
+        {
+            GetScraperPartStore().Erase(part.hash);
+            mapParts.erase(part.hash);
+        }
     }
 }
 
+std::shared_ptr<const SerializeData> CSplitBlob::CPart::GetData() const
+{
+    std::shared_ptr<const SerializeData> data = GetScraperPartStore().Get(hash);
+
+    if (!data && received() && !m_lost.exchange(true))
+    {
+        LogPrintf("WARNING: CSplitBlob::CPart::GetData: scraper part %s is lost. It will be requested again.",
+                  hash.GetHex());
+    }
+
+    return data;
+}
+
+void CSplitBlob::CPart::SetData(SerializeData data)
+{
+    m_size = data.size();
+    GetScraperPartStore().Put(hash, std::move(data));
+    m_lost = false;
+}
+
 void CSplitBlob::UseAsSource(CNode* pfrom) EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manifest, CSplitBlob::cs_mapParts)
 {
     if (pfrom)
     {
-        for (const CPart* part : vParts)
+        for (unsigned int n = 0; n < vParts.size(); ++n)
         {
+            const CPart* part = vParts[n];
+
             if (!part->present())
             {
+                /* Name a similar part that we hold first so that the node can reply with a delta. */
+                if (pfrom->nServices & NODE_PART_DELTA)
+                {
+                    const uint256 base_hash = FindPartBase(n);
+
+                    if (!base_hash.IsNull())
+                    {
+                        if (pfrom->mapPartBasesNamed.size() >= MAX_PART_BASES_PER_NODE)
+                        {
+                            pfrom->mapPartBasesNamed.erase(pfrom->mapPartBasesNamed.begin());
+                        }
+
+                        pfrom->mapPartBasesNamed[part->hash] = base_hash;
+                        pfrom->PushMessage(NetMsgType::PARTBASE, part->hash, base_hash);
+                    }
+                }
+
                 /*Actually request the part. Inventory system will prevent redundant requests.*/
                 pfrom->AskFor(CInv(MSG_PART, part->hash));
             }
@@ -176,19 +404,85 @@ void CSplitBlob::UseAsSource(CNode* pfrom) EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::
     }
 }
 
-bool CSplitBlob::SendPartTo(CNode* pto, const uint256& hash) EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_mapParts)
+uint256 CSplitBlob::FindPartBase(unsigned int) const
 {
-    auto ipart = mapParts.find(hash);
+    return uint256{};
+}
+
+bool CSplitBlob::SendPartTo(CNode* pto, const uint256& hash) LOCKS_EXCLUDED(CSplitBlob::cs_mapParts)
+{
+    std::shared_ptr<const SerializeData> data;
+    std::shared_ptr<const SerializeData> base_data;
+    uint256 base_hash;
 
-    if (ipart != mapParts.end())
     {
-        if (ipart->second.present())
+        LOCK(cs_mapParts);
+
+        auto ipart = mapParts.find(hash);
+
+        if (ipart == mapParts.end()) return false;
+
+        data = ipart->second.GetData();
+
+        if (!data) return false;
+
+        auto ibase = pto->mapPartBases.find(hash);
+
+        if (ibase != pto->mapPartBases.end())
+        {
+            base_hash = ibase->second;
+            pto->mapPartBases.erase(ibase);
+
+            auto ibase_part = mapParts.find(base_hash);
+
+            if (ibase_part != mapParts.end()) base_data = ibase_part->second.GetData();
+        }
+    }
+
+    if (base_data)
+    {
+        const PartDeltaCache::Key key(base_hash, hash);
+        std::shared_ptr<const SerializeData> delta;
+
+        if (!g_part_delta_cache.Get(key, delta))
+        {
+            const int64_t now = GetAdjustedTime();
+
+            if (now - pto->nPartDeltaWindowStart >= PART_DELTA_WINDOW)
+            {
+                pto->nPartDeltaWindowStart = now;
+                pto->nPartDeltasBuilt = 0;
+            }
+
+            // Building the delta inflates and compresses whole stats files, so it happens without holding
+            // cs_mapParts, and only a limited number of times for each peer.
+            if (pto->nPartDeltasBuilt < MAX_PART_DELTAS_PER_NODE)
+            {
+                ++pto->nPartDeltasBuilt;
+
+                if (std::optional<SerializeData> built = MakeScraperPartDelta(*base_data, *data))
+                {
+                    delta = std::make_shared<const SerializeData>(std::move(*built));
+                }
+
+                g_part_delta_cache.Put(key, delta);
+            }
+            else
+            {
+                LogPrint(BCLog::LogFlags::MANIFEST, "part delta limit reached for %s, sending whole part %s",
+                         pto->addrName, hash.GetHex());
+            }
+        }
+
+        if (delta)
         {
-            pto->PushMessage(NetMsgType::PART,ipart->second.getReader());
+            pto->PushMessage(NetMsgType::PARTDELTA, hash, base_hash, *delta);
             return true;
         }
     }
-    return false;
+
+    pto->PushMessage(NetMsgType::PART, CDataStream(*data, SER_NETWORK, PROTOCOL_VERSION));
+    return true;
 }
 
 CScraperManifest::CScraperManifest() {}
@@ -844,6 +1138,22 @@ void CScraperManifest::Complete() EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manife
 {
     m_publish_in_progress = false;
 
+    // Remember the newest part of each project as the delta base for the parts of later manifests:
+    const auto record_latest_part = [&](const std::string& name, const int part_index) {
+        if (part_index < 0 || (size_t) part_index >= vParts.size()) return;
+
+        auto& latest = mapLatestParts[name];
+
+        if (nTime >= latest.first) latest = { nTime, vParts[part_index]->hash };
+    };
+
+    record_latest_part("BeaconList", BeaconList);
+
+    for (const dentry& entry : projects)
+    {
+        record_latest_part(entry.project, entry.part1);
+    }
+
     // Notify peers that we have a new manifest
     LogPrint(BCLog::LogFlags::MANIFEST, "manifest %s complete with %u parts", phash->GetHex(), (unsigned)vParts.size());
     {
@@ -858,6 +1168,38 @@ void CScraperManifest::Complete() EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manife
              sCManifestName, phash->GetHex());
 }
 
+uint256 CScraperManifest::FindPartBase(unsigned int n) const EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manifest, CSplitBlob::cs_mapParts)
+{
+    std::string name;
+
+    if (BeaconList == (int) n)
+    {
+        name = "BeaconList";
+    }
+    else
+    {
+        for (const dentry& entry : projects)
+        {
+            if (entry.part1 == (int) n)
+            {
+                name = entry.project;
+                break;
+            }
+        }
+    }
+
+    auto ilatest = mapLatestParts.find(name);
+
+    if (name.empty() || ilatest == mapLatestParts.end()) return uint256{};
+
+    // The latest part may belong to a manifest that was deleted since.
+    auto ipart = mapParts.find(ilatest->second.second);
+
+    if (ipart == mapParts.end() || !ipart->second.present() || ipart->first == vParts[n]->hash) return uint256{};
+
+    return ipart->first;
+}
+
 UniValue CScraperManifest::ToJson() const EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::cs_manifest, CSplitBlob::cs_mapParts)
 {
     UniValue r(UniValue::VOBJ);
@@ -888,8 +1230,8 @@ UniValue CScraperManifest::ToJson() const EXCLUSIVE_LOCKS_REQUIRED(CSplitBlob::c
         if (part.project != "ProjectsAllCpidTotalCredits") {
             projects.push_back(part.ToJson());
 
-        } else if (!vParts[part.part1]->data.empty()) {
-            CDataStream ss(vParts[part.part1]->data, SER_NETWORK, 1);
+        } else if (const std::shared_ptr<const SerializeData> data = vParts[part.part1]->GetData()) {
+            CDataStream ss(*data, SER_NETWORK, 1);
 
             ss >> total_credit_map;
 
@@ -1036,5 +1378,12 @@ UniValue getmpart(const UniValue& params, bool fHelp)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Object not found");
     }
 
-    return UniValue(HexStr(ipart->second.data));
+    const std::shared_ptr<const SerializeData> data = ipart->second.GetData();
+
+    if (!data)
+    {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Object data not available");
+    }
+
+    return UniValue(HexStr(*data));
 }
@@ -18,6 +18,8 @@
 
 #include <univalue.h>
 
+#include <atomic>
+
 /** Abstract class for blobs that are split into parts. This more complex approach using a parent vanilla parts class will
  *  allow the parts system to be used for other purposes besides the scrapers if needed in the future.
  * polymorphism.
@@ -31,13 +33,26 @@ public:
      */
     struct CPart {
         std::set<std::pair<CSplitBlob*, unsigned int>> refs;
-        SerializeData data;
         uint256 hash;
         CPart(const uint256& ihash)
             :hash(ihash)
         {}
-        CDataStream getReader() const { return CDataStream(data, SER_NETWORK, PROTOCOL_VERSION); }
-        bool present() const { return !this->data.empty(); }
+        /** Get the part data from the part store. Returns nullptr if the part is not present or fails to load. A part
+         *  that fails to load is no longer present, so that it is requested again from the next node that announces
+         *  a manifest with it.
+         */
+        std::shared_ptr<const SerializeData> GetData() const;
+        /** Hand the part data to the part store, which may keep it on disk rather than in memory. */
+        void SetData(SerializeData data);
+        size_t size() const { return m_size; }
+        bool present() const { return m_size > 0 && !m_lost; }
+        /** Whether the part data arrived before, even if the part store lost it since. The split objects that
+         *  reference the part count it as received.
+         */
+        bool received() const { return m_size > 0; }
+    private:
+        size_t m_size = 0;
+        mutable std::atomic<bool> m_lost{false};
     };
 
     // static methods
@@ -46,11 +61,27 @@ public:
      */
     static bool RecvPart(CNode* pfrom, CDataStream& vRecv);
 
-    /** Forward requested Part of Blob.
+    /** Process a message naming a part held by the peer that may serve as the base of a delta for the part that
+     *  the peer requests next.
+     */
+    static bool RecvPartBase(CNode* pfrom, CDataStream& vRecv);
+
+    /** Process a message containing Part of Blob encoded as a delta against another part.
+     * @return whether the data was useful
+     */
+    static bool RecvPartDelta(CNode* pfrom, CDataStream& vRecv);
+
+    /** Forward requested Part of Blob. Sends a delta instead if the node named a base part for it and the delta
+     *  is smaller. Takes the lock on cs_mapParts, and builds deltas without holding it.
      * @returns whether something was sent
      */
     static bool SendPartTo(CNode* pto, const uint256& hash);
 
+    /** Ask the connected peers for a part that this node needs again, such as a part that the part store lost.
+     *  The inventory system sends the request to one peer at a time.
+     */
+    static void RequestPart(const uint256& hash);
+
     // public methods
     /** Boolean that returns whether all parts for the split object have been received. */
     bool isComplete() const;
@@ -61,6 +92,11 @@ public:
     /** Use the node as download source for this Split object. */
     void UseAsSource(CNode* pnode);
 
+    /** Find a present part that is likely similar to part n, to serve as the base of a delta for it.
+     * @returns the hash of the base part, or a null hash if there is none.
+     */
+    virtual uint256 FindPartBase(unsigned int n) const;
+
     /** Add a part reference to vParts. Creates a CPart if necessary. */
     void addPart(const uint256& ihash);
 
@@ -109,6 +145,11 @@ public: /* static methods */
     /** map from index hash to scraper Index, so we can process Inv messages */
     static std::map<uint256, std::shared_ptr<CScraperManifest>> mapManifest GUARDED_BY(cs_mapManifest);
 
+    /** map from part name (project or "BeaconList") to the time and hash of the part in the latest complete
+     *  manifest, used to pick delta bases when requesting parts
+     */
+    static std::map<std::string, std::pair<int64_t, uint256>> mapLatestParts GUARDED_BY(cs_mapParts);
+
     /** map of manifests that are pending deletion */
     // ------------ hash -------------- nTime ------- pointer to CScraperManifest
     static std::map<uint256, std::pair<int64_t, std::shared_ptr<CScraperManifest>>> mapPendingDeletedManifest GUARDED_BY(cs_mapManifest);
@@ -206,6 +247,9 @@ public: /* public methods */
     /** Hook called when all parts are available */
     void Complete() override;
 
+    /** Use the part of the same project from the latest complete manifest as the delta base. */
+    uint256 FindPartBase(unsigned int n) const override;
+
     /** Serialize this object for sending over the network. This includes the signature as well as the payload. */
     void Serialize(CDataStream& s) const;
     /** Serialize without the signature. We need this to generate the (inner) content for the hash to sign with the key. */
@@ -30,14 +30,6 @@ namespace {
 template<typename T>
 class ScraperStatsSuperblockBuilder
 {
-    // The loop below depends on the relative value of these enum types:
-    static_assert(statsobjecttype::NetworkWide < statsobjecttype::byCPID,
-        "Unexpected enumeration order of scraper stats map object types.");
-    static_assert(statsobjecttype::byCPID < statsobjecttype::byCPIDbyProject,
-        "Unexpected enumeration order of scraper stats map object types.");
-    static_assert(statsobjecttype::byProject < statsobjecttype::byCPIDbyProject,
-        "Unexpected enumeration order of scraper stats map object types.");
-
 public:
     //!
     //! \brief Initialize an instance that wraps the provided superblock.
@@ -56,51 +48,33 @@ public:
     //!
     void BuildFromStats(const ScraperStatsVerifiedBeaconsTotalCredits& stats_verified_beacons_tc)
     {
-        for (const auto& entry : stats_verified_beacons_tc.mScraperStats) {
-            // A CPID, project name, or project name/CPID pair that identifies
-            // the current statistics record:
-            const std::string& object_id = entry.first.objectID;
-
-            switch (entry.first.objecttype) {
-            // This map starts with a single, network-wide statistics entry.
-            // Skip it because superblock objects will recalculate the stats
-            // as needed after deserialization.
-            //
-            case statsobjecttype::NetworkWide:
-                continue;
+        const ScraperStatsTable& stats = stats_verified_beacons_tc.mScraperStats;
 
-            case statsobjecttype::byCPID:
-                m_superblock.m_cpids.Add(
-                    Cpid::Parse(object_id),
-                    Magnitude::RoundFrom(entry.second.statsvalue.dMag));
-
-                break;
-
-            case statsobjecttype::byProject:
-                m_superblock.m_projects.Add(
-                    object_id,
-                    Superblock::ProjectStats(
-                        std::nearbyint(entry.second.statsvalue.dTC),
-                        std::nearbyint(entry.second.statsvalue.dAvgRAC),
-                        std::nearbyint(entry.second.statsvalue.dRAC))
-                    );
-
-                break;
-
-            // The scraper statistics map orders the entries by "objecttype"
-            // starting with "byCPID" and "byProject". After importing these
-            // sections into the superblock, we can exit this loop.
-            //
-            default:
-                goto end_build_from_stats_loop;
-            }
+        // The network-wide statistics entry is skipped because superblock
+        // objects will recalculate the stats as needed after deserialization.
+        //
+        // The tables are sorted in the same order as the entries of the old
+        // statistics map, so we add the CPIDs and then the projects:
+        //
+        for (const auto& entry : stats.ByCPID()) {
+            m_superblock.m_cpids.Add(
+                entry.cpid,
+                Magnitude::RoundFrom(entry.statsvalue.dMag));
         }
 
-    // ScraperStatsQuorumHasher expects the verified beacons data after the
-    // CPID and project data, so we use a goto statement to break the above
-    // loop instead or reordering the logic to use a return statement:
-    //
-    end_build_from_stats_loop:
+        for (const auto& entry : stats.ByProject()) {
+            m_superblock.m_projects.Add(
+                stats.ProjectName(entry.project),
+                Superblock::ProjectStats(
+                    std::nearbyint(entry.statsvalue.dTC),
+                    std::nearbyint(entry.statsvalue.dAvgRAC),
+                    std::nearbyint(entry.statsvalue.dRAC))
+                );
+        }
+
+        // ScraperStatsQuorumHasher expects the verified beacons data after the
+        // CPID and project data:
+        //
         m_superblock.m_verified_beacons.Reset(stats_verified_beacons_tc.mVerifiedMap);
 
         // This is equivalent to superblock v3+ and doesn't require a lock on cs_main.
@@ -1005,8 +979,9 @@ void Superblock::ProjectIndex::SetHint(
         return;
     }
 
-    const uint256 part_hash = Hash(part_data_ptr->data);
-    iter->second.m_convergence_hint = part_hash.GetUint64(0) >> 32;
+    // Parts are keyed by the hash of their data, so the hint does not need to
+    // load the data:
+    iter->second.m_convergence_hint = part_data_ptr->hash.GetUint64(0) >> 32;
 
     m_converged_by_project = true;
 }
@@ -5,7 +5,9 @@
 #ifndef GRIDCOIN_SUPPORT_XML_H
 #define GRIDCOIN_SUPPORT_XML_H
 
+#include <array>
 #include <string>
+#include <string_view>
 
 inline std::string ExtractXML(const std::string& xml, const std::string& key, const std::string& key_end)
 {
@@ -24,4 +26,66 @@ inline std::string ExtractXML(const std::string& xml, const std::string& key, co
     return xml.substr(loc + (key.length()), loc_end - loc - (key.length()));
 }
 
+//!
+//! \brief Extract the text of several elements from an XML fragment in a single
+//! pass over the fragment.
+//!
+//! Like ExtractXML(), this takes the first occurrence of each element, matches
+//! only elements without attributes, and does not decode entities. The scan
+//! skips the content of each element that it extracts.
+//!
+//! \param xml  XML fragment to scan.
+//! \param tags Names of the elements to extract, without angle brackets.
+//!
+//! \return The text of each element in the order of \p tags. The text is empty
+//! for elements not found.
+//!
+template <size_t N>
+std::array<std::string, N> ExtractXMLElements(
+    const std::string& xml,
+    const std::string_view (&tags)[N])
+{
+    std::array<std::string, N> values;
+    std::array<bool, N> found {};
+    size_t remaining = N;
+
+    std::string::size_type pos = xml.find('<');
+
+    while (remaining > 0 && pos != std::string::npos) {
+        const std::string::size_type name_begin = pos + 1;
+        const std::string::size_type name_end = xml.find('>', name_begin);
+
+        if (name_end == std::string::npos) {
+            break;
+        }
+
+        const std::string_view name(xml.data() + name_begin, name_end - name_begin);
+        std::string::size_type next = name_end + 1;
+
+        for (size_t i = 0; i < N; ++i) {
+            if (found[i] || name != tags[i]) {
+                continue;
+            }
+
+            std::string close_tag = "</";
+            close_tag.append(name).append(">");
+
+            const std::string::size_type value_end = xml.find(close_tag, next);
+
+            if (value_end != std::string::npos) {
+                values[i] = xml.substr(next, value_end - next);
+                next = value_end + close_tag.size();
+                found[i] = true;
+                --remaining;
+            }
+
+            break;
+        }
+
+        pos = xml.find('<', next);
+    }
+
+    return values;
+}
+
 #endif // GRIDCOIN_SUPPORT_XML_H
@@ -18,6 +18,9 @@
 #include "util.h"
 #include "node/ui_interface.h"
 
+#include <map>
+#include <optional>
+#include <tuple>
 #include <unordered_map>
 
 using namespace GRC;
@@ -971,8 +974,128 @@ public:
     friend bool Tally::RemoveAccount(const Cpid& cpid);
 }; // ResearcherTally
 
+//!
+//! \brief Remembers accrual results computed for the current chain context.
+//!
+//! The miner, MRC and block validation, RPC and GUI calculate the accrual of
+//! the same CPID for the same block several times. The tally clears the cache
+//! when it changes the reward data. The cache also clears itself when the tip
+//! or the current superblock moves, because contracts in connected blocks can
+//! change the inputs of the newbie correction and the magnitude unit.
+//!
+//! THREAD SAFETY: Lock cs_main like for the rest of the tally.
+//!
+class AccrualCache
+{
+public:
+    //!
+    //! \brief Get the cached accrual for the specified CPID.
+    //!
+    //! \return The accrual if cached.
+    //!
+    std::optional<CAmount> GetAccrual(
+        const Cpid& cpid,
+        const int64_t payment_time,
+        const CBlockIndex* const last_block_ptr)
+    {
+        Refresh();
+
+        const auto iter = m_accruals.find({ cpid, payment_time, last_block_ptr });
+
+        if (iter == m_accruals.end()) {
+            return std::nullopt;
+        }
+
+        return iter->second;
+    }
+
+    //!
+    //! \brief Cache the accrual calculated for the specified CPID.
+    //!
+    void PutAccrual(
+        const Cpid& cpid,
+        const int64_t payment_time,
+        const CBlockIndex* const last_block_ptr,
+        const CAmount accrual)
+    {
+        // Every GUI refresh asks for a new payment time, so keep the cache from
+        // growing without bound when the tip does not move for a while:
+        //
+        if (m_accruals.size() >= MAX_CACHED_ACCRUALS) {
+            m_accruals.clear();
+        }
+
+        m_accruals.emplace(std::make_tuple(cpid, payment_time, last_block_ptr), accrual);
+    }
+
+    //!
+    //! \brief Get the cached newbie accrual correction for the specified CPID.
+    //!
+    //! \return The correction if cached.
+    //!
+    std::optional<CAmount> GetNewbieCorrection(const Cpid& cpid, const SuperblockPtr& superblock)
+    {
+        Refresh();
+
+        const auto iter = m_newbie_corrections.find({ cpid, superblock.m_height });
+
+        if (iter == m_newbie_corrections.end()) {
+            return std::nullopt;
+        }
+
+        return iter->second;
+    }
+
+    //!
+    //! \brief Cache the newbie accrual correction for the specified CPID.
+    //!
+    void PutNewbieCorrection(const Cpid& cpid, const SuperblockPtr& superblock, const CAmount correction)
+    {
+        m_newbie_corrections.emplace(std::make_pair(cpid, superblock.m_height), correction);
+    }
+
+    //!
+    //! \brief Drop the cached results after a change to the tally.
+    //!
+    void Clear()
+    {
+        m_accruals.clear();
+        m_newbie_corrections.clear();
+    }
+
+private:
+    //!
+    //! \brief Maximum number of accrual results to keep.
+    //!
+    static constexpr size_t MAX_CACHED_ACCRUALS = 4096;
+
+    using AccrualKey = std::tuple<Cpid, int64_t, const CBlockIndex*>;
+
+    std::map<AccrualKey, CAmount> m_accruals;                      //!< By CPID, payment time, and block.
+    std::map<std::pair<Cpid, int64_t>, CAmount> m_newbie_corrections; //!< By CPID and superblock height.
+    const CBlockIndex* m_tip = nullptr;                            //!< Chain tip of the cached results.
+    int64_t m_superblock_height = 0;                               //!< Current superblock of the cached results.
+
+    //!
+    //! \brief Drop the cached results if the chain tip or the current
+    //! superblock changed since they were calculated.
+    //!
+    void Refresh()
+    {
+        const int64_t superblock_height = Quorum::CurrentSuperblock().m_height;
+
+        if (m_tip != pindexBest || m_superblock_height != superblock_height) {
+            Clear();
+
+            m_tip = pindexBest;
+            m_superblock_height = superblock_height;
+        }
+    }
+}; // AccrualCache
+
 ResearcherTally g_researcher_tally; //!< Tracks lifetime research rewards.
 NetworkTally g_network_tally;       //!< Tracks legacy two-week network averages.
+AccrualCache g_accrual_cache;       //!< Remembers calculated accrual results.
 
 } // Anonymous namespace
 
@@ -1009,6 +1132,7 @@ bool Tally::Initialize(CBlockIndex* pindex)
 
     const int64_t start_time = GetTimeMillis();
 
+    g_accrual_cache.Clear();
     g_researcher_tally.Initialize(pindex, Quorum::CurrentSuperblock());
 
     LogPrintf(
@@ -1028,6 +1152,8 @@ bool Tally::ActivateSnapshotAccrual(const CBlockIndex* const pindex)
     //
     Quorum::CommitSuperblock(pindex->nHeight);
 
+    g_accrual_cache.Clear();
+
     return g_researcher_tally.ActivateSnapshotAccrual(
         pindex,
         Quorum::CurrentSuperblock());
@@ -1087,7 +1213,53 @@ CAmount Tally::GetAccrual(
     const int64_t payment_time,
     const CBlockIndex* const last_block_ptr)
 {
-    return GetComputer(cpid, payment_time, last_block_ptr)->Accrual();
+    if (const std::optional<CAmount> accrual = g_accrual_cache.GetAccrual(cpid, payment_time, last_block_ptr)) {
+        return *accrual;
+    }
+
+    const CAmount accrual = GetComputer(cpid, payment_time, last_block_ptr)->Accrual();
+
+    g_accrual_cache.PutAccrual(cpid, payment_time, last_block_ptr, accrual);
+
+    return accrual;
+}
+
+std::map<Cpid, CAmount> Tally::GetAccruals(
+    const int64_t payment_time,
+    const CBlockIndex* const last_block_ptr)
+{
+    std::map<Cpid, CAmount> accruals;
+
+    if (!last_block_ptr) {
+        for (const auto& account_pair : Accounts()) {
+            accruals.emplace(account_pair.first, 0);
+        }
+
+        return accruals;
+    }
+
+    // Share one superblock reference between the snapshot computers instead
+    // of fetching it and the account again for each CPID:
+    //
+    const SuperblockPtr superblock = Quorum::CurrentSuperblock();
+
+    for (const auto& account_pair : Accounts()) {
+        const Cpid& cpid = account_pair.first;
+        CAmount accrual = 0;
+
+        if (const std::optional<CAmount> cached = g_accrual_cache.GetAccrual(cpid, payment_time, last_block_ptr)) {
+            accrual = *cached;
+        } else if (last_block_ptr->nVersion >= 11) {
+            accrual = GetSnapshotComputer(cpid, account_pair.second, payment_time, last_block_ptr, superblock)
+                ->Accrual();
+        } else {
+            accrual = GetLegacyComputer(cpid, payment_time, last_block_ptr)->Accrual();
+        }
+
+        accruals.emplace(cpid, accrual);
+    }
+
+    return accruals;
 }
 
 CAmount Tally::AccrualNearLimit(
@@ -1106,6 +1278,10 @@ CAmount Tally::AccrualNearLimit(
 //!
 CAmount Tally::GetNewbieSuperblockAccrualCorrection(const Cpid& cpid, const SuperblockPtr& current_superblock)
 {
+    if (const std::optional<CAmount> correction = g_accrual_cache.GetNewbieCorrection(cpid, current_superblock)) {
+        return *correction;
+    }
+
     // This function was moved from the anonymous namespace and private, to public and made static, because it has
     // to be called from BlockRewardRules::Check() directly too. Why?
 
@@ -1224,6 +1400,8 @@ CAmount Tally::GetNewbieSuperblockAccrualCorrection(const Cpid& cpid, const Supe
         LogPrint(BCLog::LogFlags::ACCRUAL, "ERROR: %s: No active beacon for cpid %s.",
                  __func__, cpid.ToString());
 
+        g_accrual_cache.PutNewbieCorrection(cpid, current_superblock, accrual);
+
         return accrual;
     }
 
@@ -1295,6 +1473,8 @@ CAmount Tally::GetNewbieSuperblockAccrualCorrection(const Cpid& cpid, const Supe
         pindex = pindex->pprev;
     }
 
+    g_accrual_cache.PutNewbieCorrection(cpid, current_superblock, accrual);
+
     return accrual;
 }
 
@@ -1373,6 +1553,8 @@ void Tally::RecordRewardBlock(const CBlockIndex* const pindex)
 {
     if (!pindex) return;
 
+    g_accrual_cache.Clear();
+
     LogPrint(BCLog::LogFlags::TALLY, "INFO: %s: pindex->ResearchSubsidy() = %s",
              __func__,
              FormatMoney(pindex->ResearchSubsidy()));
@@ -1396,6 +1578,8 @@ void Tally::ForgetRewardBlock(const CBlockIndex* const pindex)
 {
     if (!pindex) return;
 
+    g_accrual_cache.Clear();
+
     // Un-record tally for staker's research
     if (pindex->ResearchSubsidy() > 0) {
         if (const CpidOption cpid = pindex->GetMiningId().TryCpid()) {
@@ -1409,11 +1593,15 @@ void Tally::ForgetRewardBlock(const CBlockIndex* const pindex)
 
 bool Tally::ApplySuperblock(SuperblockPtr superblock)
 {
+    g_accrual_cache.Clear();
+
     return g_researcher_tally.ApplySuperblock(std::move(superblock));
 }
 
 bool Tally::RevertSuperblock()
 {
+    g_accrual_cache.Clear();
+
     return g_researcher_tally.RevertSuperblock(Quorum::CurrentSuperblock());
 }
 
@@ -1425,6 +1613,8 @@ void Tally::LegacyRecount(const CBlockIndex* pindex)
 
     LogPrint(LogFlags::TALLY, "Tally::LegacyRecount(%" PRId64 ")", pindex->nHeight);
 
+    g_accrual_cache.Clear();
+
     const int64_t consensus_depth = pindex->nHeight - CONSENSUS_LOOKBACK;
     const int64_t lookback_depth = BLOCKS_PER_DAY * NetworkTally::TALLY_DAYS;
 
@@ -1476,10 +1666,14 @@ void Tally::CloseRegistryFile()
 }
 
 ResearchAccount& Tally::CreateAccount(const Cpid& cpid) {
+    g_accrual_cache.Clear();
+
     return g_researcher_tally.m_researchers[cpid];
 }
 
 bool Tally::RemoveAccount(const Cpid& cpid) {
+    g_accrual_cache.Clear();
+
     if (!g_researcher_tally.m_researchers.count(cpid)) {
         return false;
     }
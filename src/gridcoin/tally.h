@@ -9,6 +9,8 @@
 #include "gridcoin/account.h"
 #include "gridcoin/accrual/computer.h"
 
+#include <map>
+
 class CBlockIndex;
 
 namespace GRC {
@@ -115,13 +117,19 @@ public:
     //! \param cpid The CPID of the account to fetch.
     //!
     //! \return An account that matches the CPID or a blank account if no
-    //! research reward data exists for the CPID.
+    //! research reward data exists for the CPID. The reference is valid only
+    //! until the tally creates another account because the account map may
+    //! reallocate its storage. Copy the account to keep it longer.
     //!
     static const ResearchAccount& GetAccount(const Cpid cpid);
 
     //!
     //! \brief Calculate the research reward accrual for the specified CPID.
     //!
+    //! The tally remembers the result until the reward data or the chain tip
+    //! changes, because the miner, MRC and block validation, RPC and GUI ask
+    //! for the accrual of the same CPID at the same block.
+    //!
     //! \param cpid           CPID to calculate research accrual for.
     //! \param payment_time   Time of payment to calculate rewards at.
     //! \param last_block_ptr Refers to the block for the reward.
@@ -133,6 +141,19 @@ public:
         const int64_t payment_time,
         const CBlockIndex* const last_block_ptr);
 
+    //!
+    //! \brief Calculate the research reward accrual for every CPID that has a
+    //! research account in one pass.
+    //!
+    //! \param payment_time   Time of payment to calculate rewards at.
+    //! \param last_block_ptr Refers to the block for the reward.
+    //!
+    //! \return Research reward accrual in units of 1/100000000 GRC by CPID.
+    //!
+    static std::map<Cpid, CAmount> GetAccruals(
+        const int64_t payment_time,
+        const CBlockIndex* const last_block_ptr);
+
     //!
     //! \brief A value of the accrual that is near the MaxReward for the accrual computer in context based on
     //! the rate of accrual. This is defined in the implementation of the virtual method NearRewardLimit()
@@ -292,6 +313,8 @@ public:
     //! \param cpid Cpid of the account.
     //!
     //! \return The account being created or an existing account with the same cpid.
+    //! Creating an account invalidates references to every other account that
+    //! the tally returned before, so do not hold one across this call.
     //!
     static ResearchAccount& CreateAccount(const Cpid& cpid);
 
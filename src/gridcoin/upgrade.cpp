@@ -3,12 +3,13 @@
 // file COPYING or https://opensource.org/licenses/mit-license.php.
 
 #include "gridcoin/upgrade.h"
-#include <crypto/sha256.h>
 #include "util.h"
 #include "init.h"
 
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
+#include <thread>
 #include <univalue.h>
 #include <vector>
 #include <boost/thread.hpp>
@@ -20,6 +21,12 @@
 
 using namespace GRC;
 
+//!
+//! \brief Maximum number of threads that extract the snapshot. Extraction is
+//! mostly limited by the disk beyond this.
+//!
+constexpr unsigned int MAX_EXTRACT_THREADS = 4;
+
 SnapshotExtractStatus GRC::ExtractStatus;
 
 bool GRC::fCancelOperation = false;
@@ -459,40 +466,9 @@ void Upgrade::VerifySHA256SUM()
         return;
     }
 
-    CSHA256 hasher;
-
-    fs::path fileloc = GetDataDir() / "snapshot.zip";
-    uint8_t buffer[32768];
-    int bytesread = 0;
-
-    CAutoFile file(fsbridge::fopen(fileloc, "rb"), SER_DISK, CLIENT_VERSION);
-
-    if (file.IsNull())
-    {
-        error("%s: Failed to open snapshot.zip.", __func__);
-
-        DownloadStatus.SetSHA256SUMFailed(true);
-
-        return;
-    }
-
-    unsigned int total_reads = fs::file_size(fileloc) / sizeof(buffer) + 1;
-
-    unsigned int read_count = 0;
-    while ((bytesread = fread(buffer, 1, sizeof(buffer), file.Get())))
-    {
-        hasher.Write(buffer, bytesread);
-        ++read_count;
-
-        DownloadStatus.SetSHA256SUMProgress(read_count * 100 / total_reads);
-    }
-
-    uint8_t digest[CSHA256::OUTPUT_SIZE];
-    hasher.Finalize(digest);
-
-    const std::vector<unsigned char> digest_vector(digest, digest + CSHA256::OUTPUT_SIZE);
-
-    std::string FileSHA256SUM = HexStr(digest_vector);
+    // The download hashes the bytes as they arrive, so the file need not be
+    // read again here.
+    const std::string FileSHA256SUM = DownloadStatus.GetSnapshotSHA256();
 
     if (ServerSHA256SUM == FileSHA256SUM)
     {
@@ -733,157 +709,248 @@ void Upgrade::CleanupBlockchainData(bool include_blockchain_data_files)
 
 void Upgrade::ExtractSnapshot()
 {
-    try
+    ExtractSnapshot(GetDataDir() / "snapshot.zip", GetDataDir());
+}
+
+void Upgrade::ExtractSnapshot(const fs::path& archive, const fs::path& destination)
+{
+    //!
+    //! \brief A file in the archive waiting for extraction.
+    //!
+    struct ZipEntry
     {
-        zip_error_t* err = new zip_error_t;
-        struct zip* ZipArchive;
+        zip_uint64_t index;
+        std::string name;
+        zip_uint64_t size;
+    };
 
-        std::string archive_file_string = (GetDataDir() / "snapshot.zip").string();
-        const char* archive_file = archive_file_string.c_str();
+    using ScopedZip = std::unique_ptr<zip_t, decltype(&zip_discard)>;
+    using ScopedZipFile = std::unique_ptr<zip_file_t, decltype(&zip_fclose)>;
 
-        int ze;
+    const std::string archive_file_string = archive.string();
 
-        ZipArchive = zip_open(archive_file, 0, &ze);
-        zip_error_init_with_code(err, ze);
+    const auto open_archive = [&]() {
+        int ze = 0;
+        ScopedZip zip_archive(zip_open(archive_file_string.c_str(), 0, &ze), &zip_discard);
 
-        if (ZipArchive == nullptr)
+        if (!zip_archive)
         {
-            ExtractStatus.SetSnapshotExtractFailed(true);
+            zip_error_t err;
+            zip_error_init_with_code(&err, ze);
+
+            error("ExtractSnapshot: Error opening snapshot.zip as zip archive: %s", zip_error_strerror(&err));
+
+            zip_error_fini(&err);
+        }
+
+        return zip_archive;
+    };
+
+    std::vector<ZipEntry> files;
+    int64_t totaluncompressedsize = 0;
+
+    try
+    {
+        ScopedZip zip_archive = open_archive();
 
-            error("%s: Error opening snapshot.zip as zip archive: %s", __func__, zip_error_strerror(err));
+        if (!zip_archive)
+        {
+            ExtractStatus.SetSnapshotExtractFailed(true);
 
             return;
         }
 
-        fs::path ExtractPath = GetDataDir();
         struct zip_stat ZipStat;
-        int64_t lastupdated = GetAdjustedTime();
-        long long totaluncompressedsize = 0;
-        long long currentuncompressedsize = 0;
-        uint64_t entries = (uint64_t) zip_get_num_entries(ZipArchive, 0);
+        uint64_t entries = (uint64_t) zip_get_num_entries(zip_archive.get(), 0);
 
-        // Let's scan for total size uncompressed so we can do a detailed progress for the watching user
-        for (u_int64_t j = 0; j < entries; ++j)
+        // Create the directories first so that the threads below only write
+        // files. Let's also scan for total size uncompressed so we can do a
+        // detailed progress for the watching user.
+        for (uint64_t i = 0; i < entries; ++i)
         {
-            if (zip_stat_index(ZipArchive, j, 0, &ZipStat) == 0)
+            if (zip_stat_index(zip_archive.get(), i, 0, &ZipStat) != 0)
+                continue;
+
+            const std::string name = ZipStat.name;
+
+            if (name.empty())
+                continue;
+
+            if (name.back() == '/')
             {
-                if (ZipStat.name[strlen(ZipStat.name) - 1] != '/')
-                    totaluncompressedsize += ZipStat.size;
+                fs::create_directories(destination / name);
+            }
+            else
+            {
+                fs::create_directories((destination / name).parent_path());
+
+                files.push_back({ i, name, ZipStat.size });
+                totaluncompressedsize += ZipStat.size;
             }
         }
+    }
 
-        // This protects against a divide by error below and properly returns false
-        // if the zip file has no entries.
-        if (!totaluncompressedsize)
-        {
-            ExtractStatus.SetSnapshotZipInvalid(true);
+    catch (std::exception& e)
+    {
+        error("%s: Error occurred during snapshot zip file extraction: %s", __func__, e.what());
 
-            error("%s: Error - snapshot.zip has no entries", __func__);
+        ExtractStatus.SetSnapshotExtractFailed(true);
 
-            return;
-        }
+        return;
+    }
+
+    // This protects against a divide by error below and properly returns false
+    // if the zip file has no entries.
+    if (!totaluncompressedsize)
+    {
+        ExtractStatus.SetSnapshotZipInvalid(true);
+
+        error("%s: Error - snapshot.zip has no entries", __func__);
+
+        return;
+    }
 
-        // Now extract
-        for (u_int64_t i = 0; i < entries; ++i)
+    // Start on the largest files so that one does not finish alone at the end:
+    std::sort(files.begin(), files.end(), [](const ZipEntry& a, const ZipEntry& b) {
+        return a.size > b.size;
+    });
+
+    std::atomic<size_t> next_file { 0 };
+    std::atomic<int64_t> currentuncompressedsize { 0 };
+    std::atomic<bool> failed { false };
+
+    // Each thread opens the archive itself because libzip archive handles are
+    // not thread-safe. The calling thread takes part so that it stays
+    // responsive to interruption by the snapshot worker.
+    const auto extract_files = [&](const bool interruptible) {
+        ScopedZip zip_archive = open_archive();
+
+        if (!zip_archive)
         {
-            if (zip_stat_index(ZipArchive, i, 0, &ZipStat) == 0)
-            {
-                // Does this require a directory
-                if (ZipStat.name[strlen(ZipStat.name) - 1] == '/')
-                {
-                    fs::create_directory(ExtractPath / ZipStat.name);
-                }
-                else
-                {
-                    struct zip_file* ZipFile;
+            failed = true;
 
-                    ZipFile = zip_fopen_index(ZipArchive, i, 0);
+            return;
+        }
 
-                    if (!ZipFile)
-                    {
-                        ExtractStatus.SetSnapshotExtractFailed(true);
+        int64_t lastupdated = GetAdjustedTime();
+        std::vector<char> Buf(256 * 1024);
 
-                        error("%s: Error opening file %s within snapshot.zip", __func__, ZipStat.name);
+        for (size_t i = next_file++; i < files.size() && !failed; i = next_file++)
+        {
+            const ZipEntry& entry = files[i];
 
-                        return;
-                    }
+            ScopedZipFile ZipFile(zip_fopen_index(zip_archive.get(), entry.index, 0), &zip_fclose);
 
+            if (!ZipFile)
+            {
+                failed = true;
 
-                    fs::path ExtractFileString = ExtractPath / ZipStat.name;
+                error("ExtractSnapshot: Error opening file %s within snapshot.zip", entry.name);
 
-                    CAutoFile ExtractFile(fsbridge::fopen(ExtractFileString, "wb"), SER_DISK, CLIENT_VERSION);
+                return;
+            }
 
-                    if (ExtractFile.IsNull())
-                    {
-                        ExtractStatus.SetSnapshotExtractFailed(true);
+            CAutoFile ExtractFile(fsbridge::fopen(destination / entry.name, "wb"), SER_DISK, CLIENT_VERSION);
 
-                        error("%s: Error opening file %s on filesystem", __func__, ZipStat.name);
+            if (ExtractFile.IsNull())
+            {
+                failed = true;
 
-                        return;
-                    }
+                error("ExtractSnapshot: Error opening file %s on filesystem", entry.name);
 
-                    int64_t sum = 0;
+                return;
+            }
 
-                    while ((uint64_t) sum < ZipStat.size)
-                    {
-                        int64_t len = 0;
-                        // Note that using a buffer larger than this risks crashes on macOS.
-                        char Buf[256*1024];
+            zip_uint64_t sum = 0;
 
-                        boost::this_thread::interruption_point();
+            while (sum < entry.size && !failed)
+            {
+                if (interruptible) boost::this_thread::interruption_point();
 
-                        len = zip_fread(ZipFile, &Buf, 256*1024);
+                const zip_int64_t len = zip_fread(ZipFile.get(), Buf.data(), Buf.size());
 
-                        if (len < 0)
-                        {
-                            ExtractStatus.SetSnapshotExtractFailed(true);
+                if (len <= 0)
+                {
+                    failed = true;
 
-                            error("%s: Failed to read zip buffer", __func__);
+                    error("ExtractSnapshot: Failed to read zip buffer");
 
-                            return;
-                        }
+                    return;
+                }
 
-                        fwrite(Buf, 1, (uint64_t) len, ExtractFile.Get());
+                if (fwrite(Buf.data(), 1, (size_t) len, ExtractFile.Get()) != (size_t) len)
+                {
+                    failed = true;
 
-                        sum += len;
-                        currentuncompressedsize += len;
+                    error("ExtractSnapshot: Failed to write %s", entry.name);
 
-                        // Update Progress every 1 second
-                        if (GetAdjustedTime() > lastupdated)
-                        {
-                            lastupdated = GetAdjustedTime();
+                    return;
+                }
 
-                            ExtractStatus.SetSnapshotExtractProgress(currentuncompressedsize * 100
-                                                                     / totaluncompressedsize);
-                        }
-                    }
+                sum += len;
+                currentuncompressedsize += len;
 
-                    zip_fclose(ZipFile);
+                // Update Progress every 1 second
+                if (GetAdjustedTime() > lastupdated)
+                {
+                    lastupdated = GetAdjustedTime();
+
+                    ExtractStatus.SetSnapshotExtractProgress(currentuncompressedsize * 100
+                                                             / totaluncompressedsize);
                 }
             }
         }
+    };
 
-        if (zip_close(ZipArchive) == -1)
+    const auto extract_files_noexcept = [&]() {
+        try
         {
-            ExtractStatus.SetSnapshotExtractFailed(true);
+            extract_files(false);
+        }
 
-            error("%s: Failed to close snapshot.zip", __func__);
+        catch (std::exception& e)
+        {
+            error("ExtractSnapshot: Error occurred during snapshot zip file extraction: %s", e.what());
 
-            return;
+            failed = true;
         }
+    };
+
+    const size_t thread_count = std::min<size_t>(
+        std::clamp(std::thread::hardware_concurrency(), 1u, MAX_EXTRACT_THREADS),
+        files.size());
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        threads.emplace_back(extract_files_noexcept);
     }
 
-    catch (boost::thread_interrupted&)
+    try
     {
-        ExtractStatus.SetSnapshotExtractFailed(true);
+        extract_files(true);
+    }
 
-        return;
+    catch (boost::thread_interrupted&)
+    {
+        failed = true;
     }
 
     catch (std::exception& e)
     {
         error("%s: Error occurred during snapshot zip file extraction: %s", __func__, e.what());
 
+        failed = true;
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (failed)
+    {
         ExtractStatus.SetSnapshotExtractFailed(true);
 
         return;
@@ -175,6 +175,16 @@ public:
     //!
     static void ExtractSnapshot();
 
+    //!
+    //! \brief Extracts a zip archive with several threads.
+    //!
+    //! Reports progress and the result through ExtractStatus.
+    //!
+    //! \param archive     Path of the zip file.
+    //! \param destination Directory that receives the entries.
+    //!
+    static void ExtractSnapshot(const fs::path& archive, const fs::path& destination);
+
     //!
     //! \brief Snapshot main function that runs the full snapshot task
     //!
@@ -185,6 +195,8 @@ public:
     //!
     //! \brief Verify the SHA256SUM of snapshot.zip against snapshot.zip.sha256sum on gridcoin.us
     //!
+    //! Compares the digest computed while downloading the file.
+    //!
     //! \return Bool on the success of matching SHA256SUM
     //!
     static void VerifySHA256SUM();
@@ -0,0 +1,483 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "index/addressindex.h"
+
+#include "chainparams.h"
+#include "dbwrapper.h"
+#include "gridcoin/claim.h"
+#include "gridcoin/mrc.h"
+#include "gridcoin/support/block_finder.h"
+#include "main.h"
+#include "node/blockstorage.h"
+#include "util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+
+namespace {
+//!
+//! \brief Components enabled by the startup options.
+//!
+std::atomic<uint8_t> g_components{AddressIndex::NONE};
+
+//!
+//! \brief Number of blocks between progress messages of the background sync.
+//!
+constexpr int SYNC_LOG_INTERVAL = 10000;
+
+bool WriteState(CTxDB& txdb, const AddressIndex::State& state)
+{
+    std::string key = AddressIndex::STATE_KEY_TYPE;
+
+    return txdb.WriteGenericSerializable(key, state);
+}
+} // Anonymous namespace
+
+const std::string AddressIndex::ADDRESS_KEY_TYPE = "addressindex";
+const std::string AddressIndex::CPID_KEY_TYPE = "cpidindex";
+const std::string AddressIndex::STATE_KEY_TYPE = "addressindex_state";
+
+// -----------------------------------------------------------------------------
+// Class: AddressIndex
+// -----------------------------------------------------------------------------
+
+bool AddressIndex::Initialize(uint8_t components)
+{
+    LOCK(cs_main);
+
+    CTxDB txdb;
+    std::string state_key = STATE_KEY_TYPE;
+    State state;
+
+    const bool found = txdb.ReadGenericSerializable(state_key, state);
+
+    if (found && state.m_components != components) {
+        LogPrintf("INFO: %s: index components changed from %u to %u. Erasing index rows.",
+                  __func__, state.m_components, components);
+
+        std::string address_key_type = ADDRESS_KEY_TYPE;
+        AddressKey address_key_hint;
+        std::string cpid_key_type = CPID_KEY_TYPE;
+        CpidKey cpid_key_hint;
+
+        if (!txdb.EraseGenericSerializablesByKeyType(address_key_type, address_key_hint)
+            || !txdb.EraseGenericSerializablesByKeyType(cpid_key_type, cpid_key_hint)
+            || !txdb.EraseGenericSerializable(state_key))
+        {
+            return error("%s: failed to erase index rows", __func__);
+        }
+    }
+
+    if (components != NONE && (!found || state.m_components != components)) {
+        state = State();
+        state.m_components = components;
+
+        if (!WriteState(txdb, state)) {
+            return error("%s: failed to write index state", __func__);
+        }
+    }
+
+    g_components = components;
+
+    if (components != NONE) {
+        LogPrintf("INFO: %s: address index %s, CPID index %s, indexed up to height %d",
+                  __func__,
+                  (components & ADDRESSES) ? "enabled" : "disabled",
+                  (components & CPIDS) ? "enabled" : "disabled",
+                  state.m_height);
+    }
+
+    return true;
+}
+
+uint8_t AddressIndex::Components()
+{
+    return g_components;
+}
+
+AddressIndex::State AddressIndex::ReadState(CTxDB& txdb)
+{
+    std::string key = STATE_KEY_TYPE;
+    State state;
+
+    if (!txdb.ReadGenericSerializable(key, state)) {
+        return State();
+    }
+
+    return state;
+}
+
+bool AddressIndex::GetAddressKey(const CTxDestination& dest, AddressType& type, uint160& hash)
+{
+    if (const CKeyID* key_id = std::get_if<CKeyID>(&dest)) {
+        type = AddressType::KEY_HASH;
+        hash = *key_id;
+        return true;
+    }
+
+    if (const CScriptID* script_id = std::get_if<CScriptID>(&dest)) {
+        type = AddressType::SCRIPT_HASH;
+        std::copy(script_id->begin(), script_id->end(), hash.begin());
+        return true;
+    }
+
+    return false;
+}
+
+AddressIndex::BlockRows AddressIndex::BuildRows(
+    const CBlock& block,
+    const CBlockIndex* pindex,
+    const std::vector<std::vector<CTxOut>>& spent_outputs,
+    const uint8_t components)
+{
+    BlockRows rows;
+
+    if (components & ADDRESSES) {
+        assert(spent_outputs.size() == block.vtx.size());
+
+        for (uint32_t tx_position = 0; tx_position < block.vtx.size(); ++tx_position) {
+            const CTransaction& tx = block.vtx[tx_position];
+            const uint256 txid = tx.GetHash();
+
+            AddressRow row;
+            row.m_key.m_height = pindex->nHeight;
+            row.m_key.m_tx_position = tx_position;
+            row.m_key.m_txid = txid;
+
+            const std::vector<CTxOut>& spent = spent_outputs[tx_position];
+
+            for (uint32_t i = 0; i < spent.size(); ++i) {
+                CTxDestination dest;
+
+                if (!ExtractDestination(spent[i].scriptPubKey, dest)
+                    || !GetAddressKey(dest, row.m_key.m_type, row.m_key.m_hash))
+                {
+                    continue;
+                }
+
+                row.m_key.m_index = i;
+                row.m_key.m_spending = true;
+                row.m_delta = -spent[i].nValue;
+
+                rows.m_addresses.push_back(row);
+            }
+
+            for (uint32_t i = 0; i < tx.vout.size(); ++i) {
+                CTxDestination dest;
+
+                if (!ExtractDestination(tx.vout[i].scriptPubKey, dest)
+                    || !GetAddressKey(dest, row.m_key.m_type, row.m_key.m_hash))
+                {
+                    continue;
+                }
+
+                row.m_key.m_index = i;
+                row.m_key.m_spending = false;
+                row.m_delta = tx.vout[i].nValue;
+
+                rows.m_addresses.push_back(row);
+            }
+        }
+    }
+
+    if (components & CPIDS) {
+        // The research reward of the staker is paid by the coinstake:
+        if (pindex->m_researcher && pindex->m_researcher->m_research_subsidy > 0) {
+            const uint32_t tx_position = block.IsProofOfStake() ? 1 : 0;
+
+            CpidRow row;
+            row.m_key.m_cpid = pindex->m_researcher->m_cpid;
+            row.m_key.m_height = pindex->nHeight;
+            row.m_key.m_tx_position = tx_position;
+            row.m_key.m_txid = block.vtx[tx_position].GetHash();
+            row.m_key.m_reward_type = RewardType::CLAIM;
+            row.m_amount = pindex->m_researcher->m_research_subsidy;
+
+            rows.m_cpids.push_back(row);
+        }
+
+        // MRC requests are ordinary transactions. Only the requests listed in
+        // the claim were paid by the staker:
+        if (!pindex->m_mrc_researchers.empty()) {
+            std::set<uint256> paid_mrc_txids;
+
+            for (const auto& [_, mrc_txid] : block.GetClaim().m_mrc_tx_map) {
+                paid_mrc_txids.insert(mrc_txid);
+            }
+
+            for (uint32_t tx_position = 2; tx_position < block.vtx.size(); ++tx_position) {
+                const CTransaction& tx = block.vtx[tx_position];
+                const uint256 txid = tx.GetHash();
+
+                if (!paid_mrc_txids.count(txid)) {
+                    continue;
+                }
+
+                for (const auto& contract : tx.GetContracts()) {
+                    if (contract.m_type != GRC::ContractType::MRC) continue;
+
+                    const GRC::MRC mrc = contract.CopyPayloadAs<GRC::MRC>();
+
+                    if (const GRC::CpidOption cpid = mrc.m_mining_id.TryCpid()) {
+                        CpidRow row;
+                        row.m_key.m_cpid = *cpid;
+                        row.m_key.m_height = pindex->nHeight;
+                        row.m_key.m_tx_position = tx_position;
+                        row.m_key.m_txid = txid;
+                        row.m_key.m_reward_type = RewardType::MRC;
+                        row.m_amount = mrc.m_research_subsidy - mrc.m_fee;
+
+                        rows.m_cpids.push_back(row);
+                    }
+                }
+            }
+        }
+    }
+
+    return rows;
+}
+
+bool AddressIndex::ReadSpentOutputs(
+    const CBlock& block,
+    CTxDB& txdb,
+    std::vector<std::vector<CTxOut>>& spent_outputs)
+{
+    spent_outputs.clear();
+    spent_outputs.reserve(block.vtx.size());
+
+    for (const auto& tx : block.vtx) {
+        std::vector<CTxOut>& spent = spent_outputs.emplace_back();
+
+        if (tx.IsCoinBase()) {
+            continue;
+        }
+
+        spent.reserve(tx.vin.size());
+
+        for (const auto& txin : tx.vin) {
+            CTransaction prev_tx;
+
+            if (!txdb.ReadDiskTx(txin.prevout.hash, prev_tx) || txin.prevout.n >= prev_tx.vout.size()) {
+                return error("%s: failed to read output %s spent by %s",
+                             __func__,
+                             txin.prevout.ToString(),
+                             tx.GetHash().ToString());
+            }
+
+            spent.push_back(prev_tx.vout[txin.prevout.n]);
+        }
+    }
+
+    return true;
+}
+
+bool AddressIndex::ConnectBlock(
+    const CBlock& block,
+    const CBlockIndex* pindex,
+    CTxDB& txdb,
+    const std::vector<std::vector<CTxOut>>& spent_outputs)
+{
+    const uint8_t components = Components();
+
+    if (components == NONE) {
+        return true;
+    }
+
+    State state = ReadState(txdb);
+
+    // The background sync has not reached this block yet. It will index the
+    // block when it gets there:
+    if (state.m_height != pindex->nHeight - 1) {
+        return true;
+    }
+
+    if (!WriteRows(txdb, BuildRows(block, pindex, spent_outputs, components))) {
+        return error("%s: failed to write index rows for block %s", __func__, pindex->GetBlockHash().ToString());
+    }
+
+    state.m_height = pindex->nHeight;
+
+    return WriteState(txdb, state);
+}
+
+bool AddressIndex::DisconnectBlock(const CBlock& block, const CBlockIndex* pindex, CTxDB& txdb)
+{
+    const uint8_t components = Components();
+
+    if (components == NONE) {
+        return true;
+    }
+
+    State state = ReadState(txdb);
+
+    if (state.m_height < pindex->nHeight) {
+        return true;
+    }
+
+    std::vector<std::vector<CTxOut>> spent_outputs;
+
+    if ((components & ADDRESSES) && !ReadSpentOutputs(block, txdb, spent_outputs)) {
+        return false;
+    }
+
+    if (!EraseRows(txdb, BuildRows(block, pindex, spent_outputs, components))) {
+        return error("%s: failed to erase index rows for block %s", __func__, pindex->GetBlockHash().ToString());
+    }
+
+    state.m_height = pindex->nHeight - 1;
+
+    return WriteState(txdb, state);
+}
+
+void AddressIndex::ThreadSync()
+{
+    const uint8_t components = Components();
+
+    if (components == NONE) {
+        return;
+    }
+
+    int next_log_height = 0;
+
+    while (!fShutdown) {
+        LOCK(cs_main);
+
+        CTxDB txdb;
+        State state = ReadState(txdb);
+
+        if (state.m_height >= nBestHeight) {
+            LogPrintf("INFO: %s: index synced at height %d", __func__, state.m_height);
+            return;
+        }
+
+        CBlockIndex* pindex = GRC::BlockFinder::FindByHeight(state.m_height + 1);
+
+        if (!pindex || pindex->nHeight != state.m_height + 1) {
+            error("%s: failed to find block at height %d", __func__, state.m_height + 1);
+            return;
+        }
+
+        if (!txdb.TxnBegin()) {
+            error("%s: TxnBegin failed", __func__);
+            return;
+        }
+
+        for (int i = 0; pindex && i < SYNC_CHUNK_SIZE; ++i, pindex = pindex->pnext) {
+            CBlock block;
+            std::vector<std::vector<CTxOut>> spent_outputs;
+
+            if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus())
+                || ((components & ADDRESSES) && !ReadSpentOutputs(block, txdb, spent_outputs))
+                || !WriteRows(txdb, BuildRows(block, pindex, spent_outputs, components)))
+            {
+                txdb.TxnAbort();
+                error("%s: failed to index block at height %d", __func__, pindex->nHeight);
+                return;
+            }
+
+            state.m_height = pindex->nHeight;
+        }
+
+        if (!WriteState(txdb, state) || !txdb.TxnCommit()) {
+            error("%s: failed to commit index rows up to height %d", __func__, state.m_height);
+            return;
+        }
+
+        if (state.m_height >= next_log_height) {
+            LogPrintf("INFO: %s: indexed up to height %d of %d", __func__, state.m_height, nBestHeight);
+            next_log_height = state.m_height + SYNC_LOG_INTERVAL;
+        }
+    }
+}
+
+bool AddressIndex::ScanAddress(
+    CTxDB& txdb,
+    const AddressType type,
+    const uint160& hash,
+    const int max_height,
+    const std::function<bool(const AddressRow&)>& visitor)
+{
+    const auto prefix = std::make_pair(ADDRESS_KEY_TYPE, std::make_pair(static_cast<uint8_t>(type), hash));
+
+    return txdb.ScanGenericSerializablesByPrefix(prefix, [&](CDataStream& ssKey, CDataStream& ssValue) {
+        std::string key_type;
+        AddressRow row;
+
+        ssKey >> key_type >> row.m_key;
+        ssValue >> row.m_delta;
+
+        if (row.m_key.m_height > max_height) {
+            return false;
+        }
+
+        return visitor(row);
+    });
+}
+
+bool AddressIndex::ScanCpid(
+    CTxDB& txdb,
+    const GRC::Cpid& cpid,
+    const int max_height,
+    const std::function<bool(const CpidRow&)>& visitor)
+{
+    const auto prefix = std::make_pair(CPID_KEY_TYPE, cpid);
+
+    return txdb.ScanGenericSerializablesByPrefix(prefix, [&](CDataStream& ssKey, CDataStream& ssValue) {
+        std::string key_type;
+        CpidRow row;
+
+        ssKey >> key_type >> row.m_key;
+        ssValue >> row.m_amount;
+
+        if (row.m_key.m_height > max_height) {
+            return false;
+        }
+
+        return visitor(row);
+    });
+}
+
+bool AddressIndex::WriteRows(CTxDB& txdb, const BlockRows& rows)
+{
+    for (const auto& row : rows.m_addresses) {
+        auto key = std::make_pair(ADDRESS_KEY_TYPE, row.m_key);
+
+        if (!txdb.WriteGenericSerializable(key, row.m_delta)) {
+            return false;
+        }
+    }
+
+    for (const auto& row : rows.m_cpids) {
+        auto key = std::make_pair(CPID_KEY_TYPE, row.m_key);
+
+        if (!txdb.WriteGenericSerializable(key, row.m_amount)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool AddressIndex::EraseRows(CTxDB& txdb, const BlockRows& rows)
+{
+    for (const auto& row : rows.m_addresses) {
+        auto key = std::make_pair(ADDRESS_KEY_TYPE, row.m_key);
+
+        if (!txdb.EraseGenericSerializable(key)) {
+            return false;
+        }
+    }
+
+    for (const auto& row : rows.m_cpids) {
+        auto key = std::make_pair(CPID_KEY_TYPE, row.m_key);
+
+        if (!txdb.EraseGenericSerializable(key)) {
+            return false;
+        }
+    }
+
+    return true;
+}
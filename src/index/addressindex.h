@@ -0,0 +1,309 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_INDEX_ADDRESSINDEX_H
+#define GRIDCOIN_INDEX_ADDRESSINDEX_H
+
+#include "amount.h"
+#include "gridcoin/cpid.h"
+#include "script.h"
+#include "serialize.h"
+#include "uint256.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class CBlock;
+class CBlockIndex;
+class CTxDB;
+class CTxOut;
+
+//!
+//! \brief Optional explorer indexes of the transaction database.
+//!
+//! The address index records one row for every output that pays to a standard
+//! destination and one row for every input that spends such an output. The
+//! CPID index records one row for every research reward claimed in a coinstake
+//! and for every MRC paid in a block. Rows live in the transaction LevelDB and
+//! are written in the same batch as the block that creates them so that they
+//! stay consistent with the chain across reorganizations and unclean shutdown.
+//!
+//! A background thread builds the rows for blocks that were connected before
+//! the index was enabled. Blocks connected after the index caught up add their
+//! rows in \c ConnectBlock().
+//!
+class AddressIndex
+{
+public:
+    //!
+    //! \brief Parts of the index that a node maintains.
+    //!
+    enum Component : uint8_t
+    {
+        NONE      = 0,
+        ADDRESSES = 1 << 0, //!< Enabled by -addressindex.
+        CPIDS     = 1 << 1, //!< Enabled by -cpidindex.
+    };
+
+    //!
+    //! \brief Kind of destination that an address row refers to.
+    //!
+    enum class AddressType : uint8_t
+    {
+        KEY_HASH    = 1, //!< Pay-to-pubkey or pay-to-pubkey-hash.
+        SCRIPT_HASH = 2, //!< Pay-to-script-hash.
+    };
+
+    //!
+    //! \brief Kind of research reward that a CPID row refers to.
+    //!
+    enum class RewardType : uint8_t
+    {
+        CLAIM = 1, //!< Research reward claimed by the staker of the block.
+        MRC   = 2, //!< Manual reward claim paid by the staker of the block.
+    };
+
+    //!
+    //! \brief Database key of an address row.
+    //!
+    //! Heights and transaction positions serialize big-endian so that LevelDB
+    //! iterates the rows of one destination in chain order.
+    //!
+    struct AddressKey
+    {
+        AddressType m_type = AddressType::KEY_HASH;
+        uint160 m_hash;            //!< Key ID or script ID of the destination.
+        int m_height = 0;          //!< Height of the block with the transaction.
+        uint32_t m_tx_position = 0; //!< Position of the transaction in the block.
+        uint256 m_txid;            //!< Hash of the transaction.
+        uint32_t m_index = 0;      //!< Output index, or input index for a spend.
+        bool m_spending = false;   //!< Whether the row spends an output.
+
+        template <typename Stream>
+        void Serialize(Stream& s) const
+        {
+            ser_writedata8(s, static_cast<uint8_t>(m_type));
+            s << m_hash;
+            ser_writedata32be(s, static_cast<uint32_t>(m_height));
+            ser_writedata32be(s, m_tx_position);
+            s << m_txid;
+            ser_writedata32be(s, m_index);
+            ser_writedata8(s, m_spending);
+        }
+
+        template <typename Stream>
+        void Unserialize(Stream& s)
+        {
+            m_type = static_cast<AddressType>(ser_readdata8(s));
+            s >> m_hash;
+            m_height = static_cast<int>(ser_readdata32be(s));
+            m_tx_position = ser_readdata32be(s);
+            s >> m_txid;
+            m_index = ser_readdata32be(s);
+            m_spending = ser_readdata8(s) != 0;
+        }
+    };
+
+    //!
+    //! \brief Database key of a CPID row.
+    //!
+    struct CpidKey
+    {
+        GRC::Cpid m_cpid;
+        int m_height = 0;           //!< Height of the block that paid the reward.
+        uint32_t m_tx_position = 0; //!< Position of the claim or MRC transaction.
+        uint256 m_txid;             //!< Coinstake hash or MRC request hash.
+        RewardType m_reward_type = RewardType::CLAIM;
+
+        template <typename Stream>
+        void Serialize(Stream& s) const
+        {
+            s << m_cpid;
+            ser_writedata32be(s, static_cast<uint32_t>(m_height));
+            ser_writedata32be(s, m_tx_position);
+            s << m_txid;
+            ser_writedata8(s, static_cast<uint8_t>(m_reward_type));
+        }
+
+        template <typename Stream>
+        void Unserialize(Stream& s)
+        {
+            s >> m_cpid;
+            m_height = static_cast<int>(ser_readdata32be(s));
+            m_tx_position = ser_readdata32be(s);
+            s >> m_txid;
+            m_reward_type = static_cast<RewardType>(ser_readdata8(s));
+        }
+    };
+
+    //!
+    //! \brief An address row with its balance change.
+    //!
+    struct AddressRow
+    {
+        AddressKey m_key;
+        CAmount m_delta = 0; //!< Positive for outputs, negative for spends.
+    };
+
+    //!
+    //! \brief A CPID row with the amount paid to the researcher.
+    //!
+    struct CpidRow
+    {
+        CpidKey m_key;
+        CAmount m_amount = 0; //!< Research reward less any MRC fee.
+    };
+
+    //!
+    //! \brief Rows of one block for both parts of the index.
+    //!
+    struct BlockRows
+    {
+        std::vector<AddressRow> m_addresses;
+        std::vector<CpidRow> m_cpids;
+    };
+
+    //!
+    //! \brief Persisted progress of the index.
+    //!
+    struct State
+    {
+        uint8_t m_components = NONE; //!< Components that the rows contain.
+        int m_height = -1;           //!< Height of the last indexed block.
+
+        SERIALIZE_METHODS(State, obj)
+        {
+            READWRITE(obj.m_components, obj.m_height);
+        }
+    };
+
+    //!
+    //! \brief Set the enabled components and reconcile the stored rows.
+    //!
+    //! When the stored rows were built for a different set of components, the
+    //! rows are erased and the index rebuilds from the genesis block.
+    //!
+    //! \param components Bitmask of \c Component values.
+    //!
+    //! \return \c false if the database could not be updated.
+    //!
+    static bool Initialize(uint8_t components);
+
+    //!
+    //! \brief Get the enabled components.
+    //!
+    static uint8_t Components();
+
+    //!
+    //! \brief Read the persisted progress of the index.
+    //!
+    static State ReadState(CTxDB& txdb);
+
+    //!
+    //! \brief Map a destination to the key parts of its address rows.
+    //!
+    //! \return \c false for a destination that the index does not record.
+    //!
+    static bool GetAddressKey(const CTxDestination& dest, AddressType& type, uint160& hash);
+
+    //!
+    //! \brief Produce the rows for a block.
+    //!
+    //! \param block         Block to index.
+    //! \param pindex        Index entry of the block.
+    //! \param spent_outputs Outputs spent by each transaction in the block, in
+    //! input order. Empty for a coinbase transaction.
+    //! \param components    Components to produce rows for.
+    //!
+    static BlockRows BuildRows(
+        const CBlock& block,
+        const CBlockIndex* pindex,
+        const std::vector<std::vector<CTxOut>>& spent_outputs,
+        const uint8_t components);
+
+    //!
+    //! \brief Read the outputs spent by each transaction in a block from the
+    //! transaction database.
+    //!
+    static bool ReadSpentOutputs(
+        const CBlock& block,
+        CTxDB& txdb,
+        std::vector<std::vector<CTxOut>>& spent_outputs);
+
+    //!
+    //! \brief Add the rows of a connected block when the index is synced up to
+    //! its parent.
+    //!
+    //! \param spent_outputs Outputs spent by each transaction in the block as
+    //! collected during validation. Only needed for the address component.
+    //!
+    static bool ConnectBlock(
+        const CBlock& block,
+        const CBlockIndex* pindex,
+        CTxDB& txdb,
+        const std::vector<std::vector<CTxOut>>& spent_outputs);
+
+    //!
+    //! \brief Remove the rows of a disconnected block if the index contains
+    //! them. Call before the block's transactions leave the transaction index.
+    //!
+    static bool DisconnectBlock(const CBlock& block, const CBlockIndex* pindex, CTxDB& txdb);
+
+    //!
+    //! \brief Build the rows of blocks connected before the index caught up.
+    //!
+    //! Runs in a background thread and returns when the index reaches the tip
+    //! or when shutdown is requested. Holds \c cs_main for one chunk of blocks
+    //! at a time.
+    //!
+    static void ThreadSync();
+
+    //!
+    //! \brief Visit the address rows of a destination in chain order.
+    //!
+    //! \param max_height Skip rows above this height. Rows of a block that is
+    //! connected during the scan are not reported until the next query.
+    //! \param visitor    Called for each row. Return \c false to stop.
+    //!
+    //! \return \c false if a row could not be read.
+    //!
+    static bool ScanAddress(
+        CTxDB& txdb,
+        const AddressType type,
+        const uint160& hash,
+        const int max_height,
+        const std::function<bool(const AddressRow&)>& visitor);
+
+    //!
+    //! \brief Visit the CPID rows of a researcher in chain order.
+    //!
+    //! \param max_height Skip rows above this height.
+    //! \param visitor    Called for each row. Return \c false to stop.
+    //!
+    //! \return \c false if a row could not be read.
+    //!
+    static bool ScanCpid(
+        CTxDB& txdb,
+        const GRC::Cpid& cpid,
+        const int max_height,
+        const std::function<bool(const CpidRow&)>& visitor);
+
+    static const std::string ADDRESS_KEY_TYPE; //!< LevelDB key prefix of address rows.
+    static const std::string CPID_KEY_TYPE;    //!< LevelDB key prefix of CPID rows.
+    static const std::string STATE_KEY_TYPE;   //!< LevelDB key of the persisted state.
+
+    //!
+    //! \brief Number of blocks that the background sync indexes per database
+    //! batch and \c cs_main acquisition.
+    //!
+    static constexpr int SYNC_CHUNK_SIZE = 100;
+
+private:
+    static bool WriteRows(CTxDB& txdb, const BlockRows& rows);
+    static bool EraseRows(CTxDB& txdb, const BlockRows& rows);
+};
+
+#endif // GRIDCOIN_INDEX_ADDRESSINDEX_H
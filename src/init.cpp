@@ -20,8 +20,12 @@
 #include "gridcoin/gridcoin.h"
 #include "gridcoin/upgrade.h"
 #include "gridcoin/contract/registry.h"
+#include "gridcoin/scraper/part_store.h"
+#include "gridcoin/scraper/scraper.h"
+#include "index/addressindex.h"
 #include "miner.h"
 #include "node/blockstorage.h"
+#include "node/chaintip.h"
 #include <util/syserror.h>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -176,6 +180,10 @@ void Shutdown(void* parg)
         // step because of a write lock on accrual/registry.dat.
         GRC::CloseResearcherRegistryFile();
 
+        // Keep the scraper manifests destroyed at exit from removing the part
+        // files one by one.
+        GetScraperPartStore().Close();
+
         fs::remove(GetPidFile(gArgs));
         UnregisterWallet(pwalletMain);
         delete pwalletMain;
@@ -186,6 +194,15 @@ void Shutdown(void* parg)
         ECC_Stop();
         UninterruptibleSleep(std::chrono::milliseconds{50});
         LogPrintf("Gridcoin exited");
+
+        // Write out any queued log lines. Later messages go straight to file.
+        FlushScraperLog();
+        LogInstance().StopBackgroundWriter();
+
+        if (const uint64_t dropped = LogInstance().DroppedLines()) {
+            LogPrintf("WARNING: Logger: dropped %u log lines in total because the log queue was full.", dropped);
+        }
+
         fExit = true;
     }
     else
@@ -195,6 +212,23 @@ void Shutdown(void* parg)
     }
 }
 
+//! Record wait and hold times of the most contended locks for getperfstats.
+//! The wallet lock is enabled when the wallet loads.
+static void EnableLockProfiling()
+{
+    cs_main.EnableProfiling("cs_main");
+    mempool.cs.EnableProfiling("mempool.cs");
+    cs_vNodes.EnableProfiling("cs_vNodes");
+
+    cs_Scraper.EnableProfiling("cs_Scraper");
+    cs_ScraperGlobals.EnableProfiling("cs_ScraperGlobals");
+    cs_StructScraperFileManifest.EnableProfiling("cs_StructScraperFileManifest");
+    cs_ConvergedStats.EnableProfiling("cs_ConvergedStats");
+    cs_ConvergedScraperStatsCache.EnableProfiling("cs_ConvergedScraperStatsCache");
+    cs_TeamIDMap.EnableProfiling("cs_TeamIDMap");
+    cs_VerifiedBeacons.EnableProfiling("cs_VerifiedBeacons");
+}
+
 #ifndef WIN32
 static void HandleSIGTERM(int)
 {
@@ -281,6 +315,14 @@ void AddLoggingArgs(ArgsManager& argsman)
     argsman.AddArg("-logtimemicros", strprintf("Add microsecond precision to debug timestamps (default: %u)",
                                                DEFAULT_LOGTIMEMICROS),
                    ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logasync", strprintf("Write debug output from a dedicated thread instead of the thread that logs."
+                                          " Lines are dropped when the queue of -logqueuesize lines is full"
+                                          " (default: %u)", DEFAULT_LOGASYNC),
+                   ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logqueuesize=<n>", strprintf("Maximum number of debug output lines waiting for the log writer thread."
+                                                  " Lines are dropped when the queue is full, and the log reports how many (default: %u)",
+                                                  DEFAULT_LOG_QUEUE_SIZE),
+                   ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-printtoconsole", "Send trace/debug info to console (default: 0) )",
                    ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-printtodebugger", "Send trace/debug info to debugger (default: 0)",
@@ -344,6 +386,12 @@ void SetupServerArgs()
                    ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-dblogsize=<n>", "Set database disk log size in megabytes (default: 100)",
                    ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-addressindex", "Maintain an index of the outputs and spends of every address for the "
+                                    "getaddresshistory and getaddressbalance RPCs (default: 0)",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-cpidindex", "Maintain an index of the research rewards and MRCs paid to every CPID for the "
+                                 "getcpidhistory RPC (default: 0)",
+                   ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-synctime", "Sync time with other nodes. Disable if time on your system is precise e.g. syncing with"
                                 " NTP (default: 1)",
                    ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
@@ -466,6 +514,10 @@ void SetupServerArgs()
     argsman.AddArg("-scraperkey=<address>", "Manually specify scraper public key in address form. This is not necessary "
                                             "and will not work if the private key is not present in the scraper wallet file.",
                    ArgsManager::ALLOW_ANY, OptionsCategory::SCRAPER);
+    argsman.AddArg("-scraperpartcache=<n>", strprintf("Maximum size in MiB of the scraper manifest parts held in memory. "
+                                                      "The other parts are read from disk when needed (default: %u)",
+                                                      ScraperPartStore::DEFAULT_CACHE_SIZE),
+                   ArgsManager::ALLOW_ANY, OptionsCategory::SCRAPER);
 
     // Researcher
     argsman.AddArg("-email=<email>", "Email address to use for CPID detection. Must match your BOINC account email",
@@ -603,7 +655,20 @@ void SetupServerArgs()
                    ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcconnect=<ip>", "Send commands to node running on <ip> (default: 127.0.0.1)",
                    ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
-    argsman.AddArg("-rpcthreads=<n>", "Set the number of threads to service RPC calls (default: 4)",
+    argsman.AddArg("-rpcthreads=<n>", strprintf("Set the number of threads to service RPC calls (default: %d)",
+                                                DEFAULT_RPC_THREADS),
+                   ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-rpcworkqueue=<n>", strprintf("Set the depth of the work queue to service RPC calls. Connections "
+                                                  "beyond it are rejected with HTTP 503 (default: %d)",
+                                                  DEFAULT_RPC_WORK_QUEUE),
+                   ArgsManager::ALLOW_INT, OptionsCategory::RPC);
+    argsman.AddArg("-rpcservertimeout=<n>", strprintf("Timeout in seconds to close idle keep-alive RPC connections "
+                                                      "and to read an RPC request (default: %d)", DEFAULT_RPC_SERVER_TIMEOUT),
+                   ArgsManager::ALLOW_INT, OptionsCategory::RPC);
+    argsman.AddArg("-rpcmethodlimit=<method>:<n>", "Limit the number of concurrent calls of an RPC method. Calls over the "
+                                                   "limit fail with HTTP 503. 0 removes the limit. Slow methods such as "
+                                                   "getpollresults and beaconaudit default to half of -rpcthreads. Can be "
+                                                   "specified multiple times",
                    ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcssl", "Use OpenSSL (https) for JSON-RPC connections", ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcsslcertificatechainfile=<file.cert>", "Server certificate file (default: server.cert)",
@@ -881,6 +946,14 @@ bool AppInit2(ThreadHandlerPtr threads)
     SetConsoleCtrlHandler(consoleCtrlHandler, true);
 #endif
 
+    EnableLockProfiling();
+
+    // Start the log writer thread here rather than in InitLogging() because the
+    // daemon forks between the two and the child would not inherit the thread.
+    if (gArgs.GetBoolArg("-logasync", DEFAULT_LOGASYNC)) {
+        LogInstance().StartBackgroundWriter(std::max<int64_t>(1, gArgs.GetArg("-logqueuesize", DEFAULT_LOG_QUEUE_SIZE)));
+    }
+
     // ********************************************************* Step 2: parameter interactions
 
 
@@ -1335,6 +1408,7 @@ bool AppInit2(ThreadHandlerPtr threads)
     LogPrintf("Loading wallet...");
     bool fFirstRun = true;
     pwalletMain = new CWallet(walletFileName.string());
+    pwalletMain->cs_wallet.EnableProfiling("cs_wallet");
     DBErrors nLoadWalletRet = pwalletMain->LoadWallet(fFirstRun);
     if (nLoadWalletRet != DB_LOAD_OK)
     {
@@ -1474,6 +1548,27 @@ bool AppInit2(ThreadHandlerPtr threads)
     // ProcessBlock works properly. If the GRC code fails to initialize, return false (bail).
     if (!GRC::Initialize(threads, pindexBest)) return false;
 
+    // Read-only RPCs see the loaded tip and current superblock from here on:
+    WITH_LOCK(cs_main, PublishChainTip());
+
+    // Reconcile the optional address and CPID indexes with the options before
+    // any block connects. The background sync catches up on blocks connected
+    // while the indexes were disabled.
+    {
+        uint8_t index_components = AddressIndex::NONE;
+
+        if (gArgs.GetBoolArg("-addressindex", false)) index_components |= AddressIndex::ADDRESSES;
+        if (gArgs.GetBoolArg("-cpidindex", false)) index_components |= AddressIndex::CPIDS;
+
+        if (!AddressIndex::Initialize(index_components)) {
+            return InitError(_("Error initializing the address index"));
+        }
+
+        if (index_components != AddressIndex::NONE) {
+            threadGroup.create_thread(std::bind(&TraceThread<void (*)()>, "grc-addridx", &AddressIndex::ThreadSync));
+        }
+    }
+
     // ********************************************************* Step 10: import blocks
 
     fs::path pathBootstrap = GetDataDir() / "bootstrap.dat";
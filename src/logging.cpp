@@ -4,6 +4,7 @@
 // file COPYING or https://opensource.org/licenses/mit-license.php.
 
 #include <logging.h>
+#include <logging/writer.h>
 #include <util/threadnames.h>
 #include "util/time.h"
 #include "util/system.h"
@@ -91,6 +92,8 @@ bool BCLog::Logger::StartLogging()
 
 void BCLog::Logger::DisconnectTestLogger()
 {
+    StopBackgroundWriter();
+
     std::lock_guard<std::mutex> scoped_lock(m_cs);
     m_buffering = true;
     if (m_fileout != nullptr) fclose(m_fileout);
@@ -225,14 +228,14 @@ std::vector<CLogCategoryActive> ListActiveLogCategories()
     return ret;
 }
 
-std::string BCLog::Logger::LogTimestampStr(const std::string& str)
+std::string BCLog::Logger::LogTimestampStr(const std::string& str, bool started_new_line)
 {
     std::string strStamped;
 
     if (!m_log_timestamps)
         return str;
 
-    if (m_started_new_line) {
+    if (started_new_line) {
         int64_t nTimeMicros = GetTimeMicros();
         strStamped = FormatISO8601DateTime(nTimeMicros/1000000);
         if (m_log_time_micros) {
@@ -274,18 +277,34 @@ namespace BCLog {
 
 void BCLog::Logger::LogPrintStr(const std::string& str)
 {
-    std::lock_guard<std::mutex> scoped_lock(m_cs);
+    // Format on the calling thread. The exchange keeps the timestamp decision
+    // consistent when several threads log partial lines at once:
+    const bool started_new_line = m_started_new_line.exchange(!str.empty() && str[str.size()-1] == '\n');
+
     std::string str_prefixed = LogEscapeMessage(str);
 
-    if (m_log_threadnames && m_started_new_line) {
+    if (m_log_threadnames && started_new_line) {
         const auto threadname = util::ThreadGetInternalName();
         str_prefixed.insert(0, "[" + (threadname.empty() ? "unknown" : threadname) + "] ");
     }
 
-    str_prefixed = LogTimestampStr(str_prefixed);
+    str_prefixed = LogTimestampStr(str_prefixed, started_new_line);
+
+    // Submit() only fails after the writer stopped. Fall back to writing the
+    // line here so that messages logged late in shutdown still reach the file:
+    if (BackgroundWriter* writer = m_writer.load(std::memory_order_acquire)) {
+        if (writer->Submit(std::move(str_prefixed))) {
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(m_cs);
 
-    m_started_new_line = !str.empty() && str[str.size()-1] == '\n';
+    WriteStr(str_prefixed);
+}
 
+void BCLog::Logger::WriteStr(const std::string& str_prefixed)
+{
     if (m_buffering) {
         // buffer if we haven't started logging yet
         m_msgs_before_open.push_back(str_prefixed);
@@ -303,18 +322,101 @@ void BCLog::Logger::LogPrintStr(const std::string& str)
     if (m_print_to_file) {
         assert(m_fileout != nullptr);
 
-        // reopen the log file, if requested
-        if (m_reopen_file) {
-            m_reopen_file = false;
-            FILE* new_fileout = fsbridge::fopen(m_file_path, "a");
-            if (new_fileout) {
-                setbuf(new_fileout, nullptr); // unbuffered
-                fclose(m_fileout);
-                m_fileout = new_fileout;
+        ReopenFileIfRequested();
+        FileWriteStr(str_prefixed, m_fileout);
+    }
+}
+
+void BCLog::Logger::WriteBatch(const std::vector<std::string>& lines, uint64_t dropped)
+{
+    std::string contents;
+
+    if (dropped > 0) {
+        contents = LogTimestampStr(strprintf("WARNING: Logger: dropped %u log lines because the log queue was full. "
+                                             "Consider raising -logqueuesize.\n", dropped), true);
+    }
+
+    for (const auto& line : lines) {
+        contents += line;
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(m_cs);
+
+    if (m_buffering) {
+        m_msgs_before_open.push_back(std::move(contents));
+        return;
+    }
+
+    if (m_print_to_console) {
+        fwrite(contents.data(), 1, contents.size(), stdout);
+        fflush(stdout);
+    }
+    if (!m_print_callbacks.empty()) {
+        for (const auto& line : lines) {
+            for (const auto& cb : m_print_callbacks) {
+                cb(line);
             }
         }
-        FileWriteStr(str_prefixed, m_fileout);
     }
+    if (m_print_to_file) {
+        assert(m_fileout != nullptr);
+
+        // One write per batch instead of one per line:
+        ReopenFileIfRequested();
+        FileWriteStr(contents, m_fileout);
+    }
+}
+
+void BCLog::Logger::ReopenFileIfRequested()
+{
+    // reopen the log file, if requested
+    if (m_reopen_file) {
+        m_reopen_file = false;
+        FILE* new_fileout = fsbridge::fopen(m_file_path, "a");
+        if (new_fileout) {
+            setbuf(new_fileout, nullptr); // unbuffered
+            fclose(m_fileout);
+            m_fileout = new_fileout;
+        }
+    }
+}
+
+void BCLog::Logger::StartBackgroundWriter(size_t queue_size)
+{
+    if (m_writer.load() != nullptr) {
+        return;
+    }
+
+    m_writer.store(new BackgroundWriter(
+        queue_size,
+        [this](const std::vector<std::string>& lines, uint64_t dropped) { WriteBatch(lines, dropped); },
+        "grc-logger"),
+        std::memory_order_release);
+}
+
+void BCLog::Logger::StopBackgroundWriter()
+{
+    // The writer object stays allocated because other threads may still hold
+    // the pointer. Once stopped, it rejects lines and LogPrintStr() writes them.
+    if (BackgroundWriter* writer = m_writer.load(std::memory_order_acquire)) {
+        writer->Stop();
+    }
+}
+
+void BCLog::Logger::FlushBackgroundWriter()
+{
+    if (BackgroundWriter* writer = m_writer.load(std::memory_order_acquire)) {
+        writer->Flush();
+    }
+}
+
+uint64_t BCLog::Logger::DroppedLines() const
+{
+    if (const BackgroundWriter* writer = m_writer.load(std::memory_order_acquire)) {
+        return writer->Dropped();
+    }
+
+    return 0;
 }
 
 void BCLog::Logger::ShrinkDebugFile()
@@ -394,6 +496,9 @@ bool BCLog::Logger::archive(bool fImmediate, fs::path pfile_out)
     {
         std::string rename_error_msg;
 
+        // Lines logged before the rotation belong in the archived file:
+        FlushBackgroundWriter();
+
         {
             std::lock_guard<std::mutex> scoped_lock(m_cs);
 
@@ -24,6 +24,8 @@ static const bool DEFAULT_LOGTIMEMICROS = false;
 static const bool DEFAULT_LOGIPS        = false;
 static const bool DEFAULT_LOGTIMESTAMPS = true;
 static const bool DEFAULT_LOGTHREADNAMES = false;
+static const bool DEFAULT_LOGASYNC = false;
+static const unsigned int DEFAULT_LOG_QUEUE_SIZE = 16384;
 extern const char* const DEFAULT_DEBUGLOGFILE;
 
 extern bool fLogIPs;
@@ -46,6 +48,8 @@ struct CLogCategoryActive
 };
 
 namespace BCLog {
+    class BackgroundWriter;
+
     enum LogFlags : uint32_t {
         NONE        = 0,
         NET         = (1 <<  0),
@@ -101,7 +105,22 @@ namespace BCLog {
         /** Log categories bitfield. */
         std::atomic<uint32_t> m_categories{0};
 
-        std::string LogTimestampStr(const std::string& str);
+        /**
+         * Queues formatted lines for the log writer thread when asynchronous
+         * logging is enabled. Leaked with the logger; see LogInstance().
+         */
+        std::atomic<BackgroundWriter*> m_writer{nullptr};
+
+        std::string LogTimestampStr(const std::string& str, bool started_new_line);
+
+        /** Write a formatted line to every output. Requires m_cs. */
+        void WriteStr(const std::string& str_prefixed);
+
+        /** Write a batch of formatted lines from the writer thread. */
+        void WriteBatch(const std::vector<std::string>& lines, uint64_t dropped);
+
+        /** Reopen the log file if requested. Requires m_cs. */
+        void ReopenFileIfRequested();
 
         /** Slots that connect to the print signal */
         std::list<std::function<void(const std::string&)>> m_print_callbacks /* GUARDED_BY(m_cs) */ {};
@@ -148,6 +167,19 @@ namespace BCLog {
         /** Only for testing */
         void DisconnectTestLogger();
 
+        /**
+         * Move log output to a dedicated writer thread. LogPrintStr() then
+         * formats a line on the calling thread and queues it. When the queue
+         * of queue_size lines is full, lines are dropped and counted.
+         */
+        void StartBackgroundWriter(size_t queue_size);
+        /** Write all queued lines and return to writing on the calling thread. */
+        void StopBackgroundWriter();
+        /** Wait until every line logged before the call is written. */
+        void FlushBackgroundWriter();
+        /** Number of lines dropped because the writer queue was full. */
+        uint64_t DroppedLines() const;
+
         void ShrinkDebugFile();
 
         bool archive(bool fImmediate, fs::path pfile_out);
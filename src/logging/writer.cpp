@@ -0,0 +1,220 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include <logging/writer.h>
+#include <util/threadnames.h>
+
+#include <chrono>
+
+using namespace BCLog;
+
+namespace {
+//!
+//! \brief How long the writer sleeps before it checks the queue again when no
+//! producer wakes it.
+//!
+constexpr std::chrono::milliseconds WRITER_POLL_INTERVAL{100};
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 2;
+
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+} // Anonymous namespace
+
+// -----------------------------------------------------------------------------
+// Class: LogRing
+// -----------------------------------------------------------------------------
+
+LogRing::LogRing(size_t capacity)
+    : m_cells(new Cell[RoundUpToPowerOfTwo(capacity)])
+    , m_mask(RoundUpToPowerOfTwo(capacity) - 1)
+{
+    for (size_t i = 0; i <= m_mask; ++i) {
+        m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool LogRing::TryPush(std::string&& line)
+{
+    size_t pos = m_push_pos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Cell& cell = m_cells[pos & m_mask];
+        const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (m_push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.m_line = std::move(line);
+                cell.m_sequence.store(pos + 1, std::memory_order_release);
+
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // The consumer did not drain this cell yet: full.
+        } else {
+            pos = m_push_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool LogRing::TryPop(std::string& line)
+{
+    size_t pos = m_pop_pos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Cell& cell = m_cells[pos & m_mask];
+        const size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0) {
+            if (m_pop_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                line = std::move(cell.m_line);
+                cell.m_line.clear();
+                cell.m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // No producer filled this cell yet: empty.
+        } else {
+            pos = m_pop_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Class: BackgroundWriter
+// -----------------------------------------------------------------------------
+
+BackgroundWriter::BackgroundWriter(size_t capacity, Sink sink, std::string thread_name)
+    : m_ring(capacity)
+    , m_sink(std::move(sink))
+    , m_thread_name(std::move(thread_name))
+{
+    m_thread = std::thread(&BackgroundWriter::ThreadWriter, this);
+}
+
+BackgroundWriter::~BackgroundWriter()
+{
+    Stop();
+}
+
+bool BackgroundWriter::Submit(std::string&& line)
+{
+    // Stop() waits for the in-flight count to reach zero after it sets the
+    // stopping flag, so a line queued here is always drained before it joins:
+    m_producers.fetch_add(1);
+
+    if (m_stopping.load()) {
+        m_producers.fetch_sub(1);
+        return false;
+    }
+
+    if (m_ring.TryPush(std::move(line))) {
+        m_submitted.fetch_add(1);
+
+        if (m_waiting.load()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake.notify_one();
+        }
+    } else {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_producers.fetch_sub(1);
+
+    return true;
+}
+
+void BackgroundWriter::Flush()
+{
+    const uint64_t target = m_submitted.load();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_wake.notify_one();
+    m_drained.wait(lock, [&] { return m_written.load() >= target || m_stopping.load(); });
+}
+
+void BackgroundWriter::Stop()
+{
+    if (m_stopping.exchange(true)) {
+        return;
+    }
+
+    while (m_producers.load() > 0) {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_wake.notify_one();
+        m_drained.notify_all();
+    }
+
+    m_thread.join();
+
+    // Write whatever the producers queued while the thread shut down:
+    std::vector<std::string> batch;
+    while (WriteBatch(batch));
+}
+
+bool BackgroundWriter::WriteBatch(std::vector<std::string>& batch)
+{
+    batch.clear();
+
+    std::string line;
+    while (batch.size() < MAX_BATCH_SIZE && m_ring.TryPop(line)) {
+        batch.emplace_back(std::move(line));
+    }
+
+    const uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+
+    if (batch.empty() && dropped == m_dropped_reported) {
+        return false;
+    }
+
+    m_sink(batch, dropped - m_dropped_reported);
+    m_dropped_reported = dropped;
+
+    m_written.fetch_add(batch.size());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_drained.notify_all();
+    }
+
+    return true;
+}
+
+void BackgroundWriter::ThreadWriter()
+{
+    util::ThreadRename(std::string(m_thread_name));
+
+    std::vector<std::string> batch;
+    batch.reserve(MAX_BATCH_SIZE);
+
+    while (!m_stopping.load()) {
+        if (WriteBatch(batch)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // A producer that queues a line after this store observes the flag and
+        // notifies. One that queued a line before it bumped m_submitted first:
+        m_waiting.store(true);
+        m_wake.wait_for(lock, WRITER_POLL_INTERVAL, [&] {
+            return m_stopping.load() || m_submitted.load() > m_written.load();
+        });
+        m_waiting.store(false);
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_LOGGING_WRITER_H
+#define BITCOIN_LOGGING_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BCLog {
+//!
+//! \brief Bounded multi-producer queue of formatted log lines.
+//!
+//! Each cell carries a sequence number that tells producers and the consumer
+//! whether the cell is free or filled for the current lap of the ring, so that
+//! neither side takes a lock. The capacity rounds up to a power of two.
+//!
+class LogRing
+{
+public:
+    explicit LogRing(size_t capacity);
+
+    //!
+    //! \brief Append a line to the queue.
+    //!
+    //! \param line Moved from only when the line is queued.
+    //!
+    //! \return \c false when the queue is full.
+    //!
+    bool TryPush(std::string&& line);
+
+    //!
+    //! \brief Remove the oldest line from the queue.
+    //!
+    //! \return \c false when the queue is empty.
+    //!
+    bool TryPop(std::string& line);
+
+    //!
+    //! \brief Get the number of lines that the queue holds when full.
+    //!
+    size_t Capacity() const { return m_mask + 1; }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> m_sequence;
+        std::string m_line;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    const size_t m_mask;
+
+    alignas(64) std::atomic<size_t> m_push_pos{0}; //!< Next cell to fill.
+    alignas(64) std::atomic<size_t> m_pop_pos{0};  //!< Next cell to drain.
+};
+
+//!
+//! \brief Writes queued log lines to their destination on a dedicated thread.
+//!
+//! Callers format a line and submit it without blocking on I/O. When the queue
+//! is full, the line is dropped and counted; the writer reports the number of
+//! dropped lines with the next batch that it writes. \c Stop() drains every
+//! queued line before it returns so that no accepted line is lost at shutdown.
+//!
+class BackgroundWriter
+{
+public:
+    //!
+    //! \brief Writes one batch of lines.
+    //!
+    //! Receives the lines in submission order and the number of lines dropped
+    //! since the previous batch. Must not submit lines to the same writer.
+    //!
+    using Sink = std::function<void(const std::vector<std::string>& lines, uint64_t dropped)>;
+
+    //!
+    //! \brief Start the writer thread.
+    //!
+    //! \param capacity    Number of lines that the queue holds.
+    //! \param sink        Writes batches of lines.
+    //! \param thread_name Name of the writer thread.
+    //!
+    BackgroundWriter(size_t capacity, Sink sink, std::string thread_name);
+
+    ~BackgroundWriter();
+
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+
+    //!
+    //! \brief Queue a line for the writer thread.
+    //!
+    //! \param line Moved from only when the line is queued.
+    //!
+    //! \return \c false when the writer stopped. The caller must write the
+    //! line itself. A line dropped because the queue is full returns \c true.
+    //!
+    bool Submit(std::string&& line);
+
+    //!
+    //! \brief Wait until the writer wrote every line submitted before the call.
+    //!
+    void Flush();
+
+    //!
+    //! \brief Write the remaining lines and join the writer thread.
+    //!
+    //! After this returns, \c Submit() returns \c false. Safe to call more than
+    //! once.
+    //!
+    void Stop();
+
+    //!
+    //! \brief Get the number of lines dropped because the queue was full.
+    //!
+    uint64_t Dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    //!
+    //! \brief Number of lines that the writer passes to the sink at most at once.
+    //!
+    static constexpr size_t MAX_BATCH_SIZE = 1024;
+
+private:
+    LogRing m_ring;
+    Sink m_sink;
+    std::string m_thread_name;
+
+    std::atomic<bool> m_stopping{false};
+    std::atomic<int> m_producers{0};      //!< Submit() calls in progress.
+    std::atomic<uint64_t> m_submitted{0}; //!< Lines queued.
+    std::atomic<uint64_t> m_written{0};   //!< Lines passed to the sink.
+    std::atomic<uint64_t> m_dropped{0};   //!< Lines dropped when full.
+    std::atomic<bool> m_waiting{false};   //!< Writer sleeps on m_wake.
+    uint64_t m_dropped_reported = 0;      //!< Drops already passed to the sink.
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_drained;
+    std::thread m_thread;
+
+    void ThreadWriter();
+
+    //!
+    //! \brief Pass one batch of queued lines to the sink.
+    //!
+    //! \return \c false if the queue was empty.
+    //!
+    bool WriteBatch(std::vector<std::string>& batch);
+};
+} // namespace BCLog
+
+#endif // BITCOIN_LOGGING_WRITER_H
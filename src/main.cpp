@@ -36,10 +36,13 @@
 #include "gridcoin/tally.h"
 #include "gridcoin/tx_message.h"
 #include "node/blockstorage.h"
+#include "node/chaintip.h"
 #include "node/orphan_blocks.h"
+#include "node/orphan_txs.h"
 #include "policy/fees.h"
 #include "policy/policy.h"
 #include "random.h"
+#include "util/perfstats.h"
 #include "validation.h"
 
 #include <boost/algorithm/string/replace.hpp>
@@ -68,6 +71,10 @@ CCriticalSection cs_tx_val_commit_to_disk;
 
 CTxMemPool mempool;
 
+// Latency histograms reported by getperfstats:
+static LatencyHistogram g_latency_accept_to_memory_pool("AcceptToMemoryPool");
+static LatencyHistogram g_latency_process_block("ProcessBlock");
+
 ///////////////////////MINOR VERSION////////////////////////////////
 
 extern int64_t GetCoinYearReward(int64_t nTime);
@@ -99,9 +106,7 @@ CMedianFilter<int> cPeerBlockCounts(5, 0); // Amount of blocks that other nodes
 
 
 // Orphan block storage managed by g_orphan_blocks (node/orphan_blocks.h)
-
-map<uint256, CTransaction> mapOrphanTransactions;
-map<uint256, set<uint256> > mapOrphanTransactionsByPrev;
+// Orphan transaction storage managed by g_orphan_txs (node/orphan_txs.h)
 
 // Constant stuff for coinbase transactions we create:
 CScript COINBASE_FLAGS;
@@ -254,71 +259,6 @@ double CoinToDouble(double surrogate)
     return coin;
 }
 
-//////////////////////////////////////////////////////////////////////////////
-//
-// mapOrphanTransactions
-//
-
-bool AddOrphanTx(const CTransaction& tx)
-{
-    uint256 hash = tx.GetHash();
-    if (mapOrphanTransactions.count(hash))
-        return false;
-
-    // Ignore big transactions, to avoid a
-    // send-big-orphans memory exhaustion attack. If a peer has a legitimate
-    // large transaction with a missing parent then we assume
-    // it will rebroadcast it later, after the parent transaction(s)
-    // have been mined or received.
-    // 10,000 orphans, each of which is at most 5,000 bytes big is
-    // at most 500 megabytes of orphans:
-
-    size_t nSize = GetSerializeSize(tx, SER_NETWORK, CTransaction::CURRENT_VERSION);
-
-    if (nSize > 5000)
-    {
-        LogPrint(BCLog::LogFlags::MEMPOOL, "ignoring large orphan tx (size: %" PRIszu ", hash: %s)", nSize, hash.ToString().substr(0,10));
-        return false;
-    }
-
-    mapOrphanTransactions[hash] = tx;
-    for (auto const& txin : tx.vin)
-        mapOrphanTransactionsByPrev[txin.prevout.hash].insert(hash);
-
-    LogPrint(BCLog::LogFlags::MEMPOOL, "stored orphan tx %s (mapsz %" PRIszu ")", hash.ToString().substr(0,10), mapOrphanTransactions.size());
-    return true;
-}
-
-void static EraseOrphanTx(uint256 hash)
-{
-    if (!mapOrphanTransactions.count(hash))
-        return;
-    const CTransaction& tx = mapOrphanTransactions[hash];
-    for (auto const& txin : tx.vin)
-    {
-        mapOrphanTransactionsByPrev[txin.prevout.hash].erase(hash);
-        if (mapOrphanTransactionsByPrev[txin.prevout.hash].empty())
-            mapOrphanTransactionsByPrev.erase(txin.prevout.hash);
-    }
-    mapOrphanTransactions.erase(hash);
-}
-
-unsigned int LimitOrphanTxSize(unsigned int nMaxOrphans)
-{
-    unsigned int nEvicted = 0;
-    while (mapOrphanTransactions.size() > nMaxOrphans)
-    {
-        // Evict a random orphan:
-        uint256 randomhash = GetRandHash();
-        map<uint256, CTransaction>::iterator it = mapOrphanTransactions.lower_bound(randomhash);
-        if (it == mapOrphanTransactions.end())
-            it = mapOrphanTransactions.begin();
-        EraseOrphanTx(it->first);
-        ++nEvicted;
-    }
-    return nEvicted;
-}
-
 //////////////////////////////////////////////////////////////////////////////
 //
 // CTransaction and CTxIndex
@@ -369,6 +309,7 @@ int CMerkleTx::SetMerkleBranch(const CBlock* pblock) EXCLUSIVE_LOCKS_REQUIRED(cs
 bool AcceptToMemoryPool(CTxMemPool& pool, CTransaction &tx, bool* pfMissingInputs) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    ScopedLatency latency(g_latency_accept_to_memory_pool);
     if (pfMissingInputs)
         *pfMissingInputs = false;
 
@@ -904,6 +845,9 @@ bool ForceReorganizeToHash(uint256 NewHash)
     // want the flag to be set.
     success = ReorganizeChain(txdb, cnt_dis, cnt_con, blockNew, pindexNew);
 
+    // Publish the tip even on failure: the reorganization may have moved it.
+    PublishChainTip();
+
     if (g_chain_trust.Best() < previous_chain_trust) {
         LogPrintf("WARN: %s: Chain trust is now less than before!", __func__);
     }
@@ -1303,6 +1247,9 @@ bool SetBestChain(CTxDB& txdb, CBlock &blockNew, CBlockIndex* pindexNew) EXCLUSI
         success = ReorganizeChain(txdb, cnt_dis, cnt_con, origBlock, origBestIndex);
     }
 
+    // Publish the tip even on failure: the reorganization may have moved it.
+    PublishChainTip();
+
     if (!success) {
         return false;
     }
@@ -1461,6 +1408,7 @@ bool AskForOutstandingBlocks(uint256 hashStart)
 bool ProcessBlock(CNode* pfrom, CBlock* pblock, bool generated_by_me) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    ScopedLatency latency(g_latency_process_block);
 
     // Check for duplicate
     uint256 hash = pblock->GetHash(true);
@@ -1976,7 +1924,7 @@ bool static AlreadyHave(CTxDB& txdb, const CInv& inv)
         bool txInMap = false;
         txInMap = mempool.exists(inv.hash);
         return txInMap ||
-               mapOrphanTransactions.count(inv.hash) ||
+               g_orphan_txs.Contains(inv.hash) ||
                txdb.ContainsTx(inv.hash);
         }
 
@@ -2352,7 +2300,11 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
             LogPrint(BCLog::LogFlags::NET, "received getdata (%" PRIszu " invsz)", vInv.size());
         }
 
-        LOCK(cs_main);
+        // Scraper parts are sent after releasing cs_main, because a part may be sent as a delta that takes a while
+        // to build.
+        std::vector<uint256> vPartsRequested;
+
+        WAIT_LOCK(cs_main, lock);
         for (auto const& inv : vInv)
         {
             if (fShutdown)
@@ -2408,9 +2360,7 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
                     }
                 }
                 else if(!pushed && inv.type == MSG_PART) {
-                    LOCK(CSplitBlob::cs_mapParts);
-
-                    CSplitBlob::SendPartTo(pfrom, inv.hash);
+                    vPartsRequested.push_back(inv.hash);
                 }
                 else if(!pushed &&  inv.type == MSG_SCRAPERINDEX)
                 {
@@ -2467,6 +2417,16 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
             // Track requests for our stuff
             Inventory(inv.hash);
         }
+
+        if (!vPartsRequested.empty())
+        {
+            REVERSE_LOCK(lock);
+
+            for (const uint256& hash : vPartsRequested)
+            {
+                CSplitBlob::SendPartTo(pfrom, hash);
+            }
+        }
     }
 
     else if (strCommand == NetMsgType::GETBLOCKS)
@@ -2546,8 +2506,6 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     }
     else if (strCommand == NetMsgType::TX)
     {
-        vector<uint256> vWorkQueue;
-        vector<uint256> vEraseQueue;
         CTransaction tx;
         vRecv >> tx;
 
@@ -2561,48 +2519,30 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
         {
             RelayTransaction(tx, inv.hash);
             mapAlreadyAskedFor.erase(inv);
-            vWorkQueue.push_back(inv.hash);
-            vEraseQueue.push_back(inv.hash);
+            g_orphan_txs.Erase(inv.hash);
 
-            // Recursively process any orphan transactions that depended on this one
-            for (unsigned int i = 0; i < vWorkQueue.size(); i++)
-            {
-                uint256 hashPrev = vWorkQueue[i];
-                for (set<uint256>::iterator mi = mapOrphanTransactionsByPrev[hashPrev].begin();
-                     mi != mapOrphanTransactionsByPrev[hashPrev].end();
-                     ++mi)
-                {
-                    const uint256& orphanTxHash = *mi;
-                    CTransaction& orphanTx = mapOrphanTransactions[orphanTxHash];
-                    bool fMissingInputs2 = false;
+            // Process any orphan transactions that spend this one:
+            g_orphan_txs.ProcessQueue(inv.hash, [&](CTransaction& orphanTx, bool& fMissingInputs2) -> bool {
+                const uint256 orphanTxHash = orphanTx.GetHash();
 
-                    if (AcceptToMemoryPool(mempool, orphanTx, &fMissingInputs2))
-                    {
-                        LogPrintf("   accepted orphan tx %s", orphanTxHash.ToString().substr(0,10));
-                        RelayTransaction(orphanTx, orphanTxHash);
-                        mapAlreadyAskedFor.erase(CInv(MSG_TX, orphanTxHash));
-                        vWorkQueue.push_back(orphanTxHash);
-                        vEraseQueue.push_back(orphanTxHash);
-                        pfrom->nTrust++;
-                    }
-                    else if (!fMissingInputs2)
-                    {
-                        // invalid orphan
-                        vEraseQueue.push_back(orphanTxHash);
-                        LogPrintf("   removed invalid orphan tx %s", orphanTxHash.ToString().substr(0,10));
-                    }
+                if (!AcceptToMemoryPool(mempool, orphanTx, &fMissingInputs2)) {
+                    return false;
                 }
-            }
 
-            for (auto const& hash : vEraseQueue)
-                EraseOrphanTx(hash);
+                LogPrintf("   accepted orphan tx %s", orphanTxHash.ToString().substr(0,10));
+                RelayTransaction(orphanTx, orphanTxHash);
+                mapAlreadyAskedFor.erase(CInv(MSG_TX, orphanTxHash));
+                pfrom->nTrust++;
+
+                return true;
+            });
         }
         else if (fMissingInputs)
         {
-            AddOrphanTx(tx);
+            g_orphan_txs.Add(tx, pfrom->GetId(), GetTime());
 
-            // DoS prevention: do not allow mapOrphanTransactions to grow unbounded (see CVE-2012-3789)
-            unsigned int nEvicted = LimitOrphanTxSize(MAX_ORPHAN_TRANSACTIONS);
+            // DoS prevention: do not allow the orphan pool to grow unbounded (see CVE-2012-3789)
+            size_t nEvicted = g_orphan_txs.LimitSize(MAX_ORPHAN_TRANSACTIONS);
             if (nEvicted > 0)
                 LogPrintf("mapOrphan overflow, removed %u tx", nEvicted);
         }
@@ -2780,6 +2720,14 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     {
         CSplitBlob::RecvPart(pfrom, vRecv);
     }
+    else if (strCommand == NetMsgType::PARTBASE)
+    {
+        CSplitBlob::RecvPartBase(pfrom, vRecv);
+    }
+    else if (strCommand == NetMsgType::PARTDELTA)
+    {
+        CSplitBlob::RecvPartDelta(pfrom, vRecv);
+    }
 
 
     else
@@ -27,6 +27,7 @@
 #include "policy/fees.h"
 #include "random.h"
 #include "util.h"
+#include "util/perfstats.h"
 #include "validation.h"
 #include "wallet/wallet.h"
 
@@ -42,6 +43,8 @@ using namespace std;
 
 unsigned int nMinerSleep;
 
+static LatencyHistogram g_latency_create_coin_stake("CreateCoinStake"); //!< Reported by getperfstats.
+
 namespace {
 class COrphan
 {
@@ -684,6 +687,8 @@ bool CreateCoinStake(CBlock &blocknew, CKey &key,
     vector<const CWalletTx*> &StakeInputs,
     CWallet &wallet, CBlockIndex* pindexPrev) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
+    ScopedLatency latency(g_latency_create_coin_stake);
+
     std::string function = __func__;
     function += ": ";
 
@@ -743,6 +748,12 @@ bool CreateCoinStake(CBlock &blocknew, CKey &key,
                                     "pindex->nStakeModifier = %" PRId64,
                                     nHeight_mod, StakeModifier);
 
+    const arith_uint256 BaseStakeTarget = arith_uint256().SetCompact(blocknew.nBits);
+
+    // Hash each candidate's kernel only when the loop reaches it, so that the
+    // search stops at the first kernel that meets the target. The kernel is a
+    // 52-byte message, so the multi-way SHA256D64() paths, which hash 64-byte
+    // inputs, cannot evaluate several kernels at once:
     for (const auto& pcoin : CoinsToStake)
     {
         const CWalletTx &CoinTx = *pcoin.first; //transaction that produced this coin
@@ -758,7 +769,7 @@ bool CreateCoinStake(CBlock &blocknew, CKey &key,
 
         StakeKernelHash = UintToArith256(GRC::CalculateStakeHashV8(block_time, CoinTx, CoinTxN, txnew.nTime, StakeModifier));
 
-        arith_uint320 StakeTarget = arith_uint256().SetCompact(blocknew.nBits);
+        arith_uint320 StakeTarget = BaseStakeTarget;
         StakeTarget *= arith_uint320(CoinWeight);
         StakeWeightSum += CoinWeight;
         StakeWeightMin = std::min(StakeWeightMin, CoinWeight);
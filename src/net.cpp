@@ -11,6 +11,7 @@
 #include "banman.h"
 #include "net.h"
 #include "init.h"
+#include "node/orphan_txs.h"
 #include "node/ui_interface.h"
 #include "random.h"
 #include "util.h"
@@ -59,7 +60,7 @@ void StakeMiner(CWallet *pwallet);
 //
 bool fDiscover = true;
 bool fUseUPnP = false;
-ServiceFlags nLocalServices = NODE_NETWORK;
+ServiceFlags nLocalServices = ServiceFlags(NODE_NETWORK | NODE_PART_DELTA);
 CCriticalSection cs_mapLocalHost;
 std::map<CNetAddr, LocalServiceInfo> mapLocalHost;
 static bool vfLimited[NET_MAX] GUARDED_BY(cs_mapLocalHost) = {};
@@ -809,6 +810,7 @@ void ThreadSocketHandler2(void* parg)
 {
     LogPrint(BCLog::LogFlags::NET, "ThreadSocketHandler started");
     list<CNode*> vNodesDisconnected;
+    vector<NodeId> vOrphanPeers;
     unsigned int nPrevNodeCount = 0;
 
     while (true)
@@ -838,6 +840,7 @@ void ThreadSocketHandler2(void* parg)
                     if (pnode->fNetworkNode || pnode->fInbound)
                         pnode->Release();
                     vNodesDisconnected.push_back(pnode);
+                    vOrphanPeers.push_back(pnode->GetId());
                 }
             }
 
@@ -871,6 +874,19 @@ void ThreadSocketHandler2(void* parg)
             }
         }
 
+        // Drop orphan transactions received from disconnected peers. Never
+        // wait on cs_main here: retry on the next pass if it is busy.
+        if (!vOrphanPeers.empty())
+        {
+            TRY_LOCK(cs_main, lockMain);
+            if (lockMain)
+            {
+                for (const auto& id : vOrphanPeers)
+                    g_orphan_txs.EraseForPeer(id);
+                vOrphanPeers.clear();
+            }
+        }
+
         size_t vNodesSize;
         {
             LOCK(cs_vNodes);
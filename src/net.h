@@ -257,6 +257,14 @@ public:
     CCriticalSection cs_inventory;
     std::multimap<int64_t, CInv> mapAskFor;
 
+    // scraper manifest parts: requested part hash -> base part that the peer holds
+    std::map<uint256, uint256> mapPartBases;
+    // scraper manifest parts: part hash -> base part named to the peer, so that only requested deltas are accepted
+    std::map<uint256, uint256> mapPartBasesNamed;
+    // scraper manifest part deltas built for the peer in the current rate limit window
+    int64_t nPartDeltaWindowStart;
+    unsigned int nPartDeltasBuilt;
+
     // Ping time measurement:
     // The pong reply we're expecting, or 0 if no pong expected.
     uint64_t nPingNonceSent;
@@ -305,6 +313,8 @@ public:
 		nTrust = 0;
         hashCheckpointKnown.SetNull();
         setInventoryKnown.max_size(SendBufferSize() / 1000);
+        nPartDeltaWindowStart = 0;
+        nPartDeltasBuilt = 0;
         nPingNonceSent = 0;
         nPingUsecStart = 0;
         fPingQueued = false;
@@ -0,0 +1,40 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "node/chaintip.h"
+
+#include "main.h"
+#include "gridcoin/quorum.h"
+#include "gridcoin/staking/difficulty.h"
+
+namespace {
+//!
+//! \brief The published snapshot. Only read and written with the atomic
+//! shared_ptr functions.
+//!
+std::shared_ptr<const ChainTip> g_chain_tip = std::make_shared<const ChainTip>();
+} // Anonymous namespace
+
+std::shared_ptr<const ChainTip> GetChainTip()
+{
+    return std::atomic_load(&g_chain_tip);
+}
+
+void PublishChainTip()
+{
+    AssertLockHeld(cs_main);
+
+    auto tip = std::make_shared<ChainTip>();
+
+    if (pindexBest) {
+        tip->m_index = pindexBest;
+        tip->m_hash = pindexBest->GetBlockHash();
+        tip->m_height = pindexBest->nHeight;
+        tip->m_difficulty = GRC::GetCurrentDifficulty();
+        tip->m_target_difficulty = GRC::GetTargetDifficulty();
+        tip->m_superblock = GRC::Quorum::CurrentSuperblock();
+    }
+
+    std::atomic_store(&g_chain_tip, std::shared_ptr<const ChainTip>(std::move(tip)));
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_NODE_CHAINTIP_H
+#define GRIDCOIN_NODE_CHAINTIP_H
+
+#include "gridcoin/superblock.h"
+#include "uint256.h"
+
+#include <memory>
+
+class CBlockIndex;
+
+//!
+//! \brief Immutable view of the best chain published after each change of the
+//! tip.
+//!
+//! Read-only RPCs fetch the current snapshot without cs_main and keep using it
+//! while blocks connect. The node never frees block index entries and never
+//! changes the \c pprev link of an entry, so a reader may walk back from
+//! \c m_index without a lock. It must not follow \c pnext or search
+//! mapBlockIndex without cs_main: those change when the chain reorganizes.
+//!
+struct ChainTip
+{
+    CBlockIndex* m_index = nullptr;  //!< Best block, or nullptr before load.
+    uint256 m_hash;                  //!< Hash of the best block.
+    int m_height = 0;                //!< Height of the best block.
+    double m_difficulty = 0;         //!< Difficulty of the last proof-of-stake block.
+    double m_target_difficulty = 0;  //!< Difficulty required of the next block.
+    GRC::SuperblockPtr m_superblock; //!< Most recent superblock applied by the tally.
+};
+
+//!
+//! \brief Get the most recently published snapshot of the best chain.
+//!
+//! Does not lock cs_main. Never returns nullptr.
+//!
+std::shared_ptr<const ChainTip> GetChainTip();
+
+//!
+//! \brief Replace the published snapshot with the current state of the best
+//! chain.
+//!
+//! Callers invoke this after the tip changes: once the block index loads and
+//! after each reorganization, whether it succeeded or not. The caller must
+//! hold cs_main.
+//!
+void PublishChainTip();
+
+#endif // GRIDCOIN_NODE_CHAINTIP_H
@@ -0,0 +1,279 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "node/orphan_txs.h"
+
+#include "random.h"
+#include "serialize.h"
+#include "util.h"
+
+OrphanTxManager g_orphan_txs;
+
+bool OrphanTxManager::Add(const CTransaction& tx, NodeId peer, int64_t now)
+{
+    const uint256 hash = tx.GetHash();
+
+    // Reject duplicates.
+    if (m_orphans.count(hash)) {
+        return false;
+    }
+
+    const size_t size = GetSerializeSize(tx, SER_NETWORK, CTransaction::CURRENT_VERSION);
+
+    if (size > MAX_ORPHAN_TX_SIZE) {
+        LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: ignoring large orphan tx (size: %u, hash: %s)",
+                 size, hash.ToString());
+        ++m_stats.rejected;
+        return false;
+    }
+
+    // Expire stale orphans first. The caller limits the pool size after
+    // adding so that it controls the eviction bounds.
+    EraseExpired(now);
+
+    OrphanEntry entry;
+    entry.tx = tx;
+    entry.from_peer = peer;
+    entry.time_received = now;
+    entry.size = size;
+    entry.list_position = m_orphan_list.size();
+
+    for (const auto& txin : tx.vin) {
+        m_by_prevout[txin.prevout].insert(hash);
+    }
+
+    m_orphans.emplace(hash, std::move(entry));
+    m_orphan_list.push_back(hash);
+    m_by_time.emplace(now, hash);
+    m_by_peer[peer].insert(hash);
+    m_stats.bytes += size;
+    ++m_stats.added;
+
+    LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: stored orphan tx %s (peer=%d, map size %u, %u bytes)",
+             hash.ToString(), peer, m_orphans.size(), m_stats.bytes);
+
+    return true;
+}
+
+size_t OrphanTxManager::ProcessQueue(
+    const uint256& accepted_hash,
+    std::function<bool(CTransaction&, bool&)> accept_fn)
+{
+    std::vector<uint256> work_queue;
+    work_queue.push_back(accepted_hash);
+
+    size_t accepted_count = 0;
+
+    for (size_t i = 0; i < work_queue.size(); ++i) {
+        // Collect first because EraseInternal modifies m_by_prevout.
+        for (const uint256& orphan_hash : FindChildren(work_queue[i])) {
+            auto it = m_orphans.find(orphan_hash);
+            if (it == m_orphans.end()) {
+                continue;
+            }
+
+            bool missing_inputs = false;
+
+            if (accept_fn(it->second.tx, missing_inputs)) {
+                work_queue.push_back(orphan_hash);
+                ++accepted_count;
+                ++m_stats.accepted;
+            } else if (missing_inputs) {
+                // Still waiting on another parent.
+                continue;
+            } else {
+                LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: removed invalid orphan tx %s",
+                         orphan_hash.ToString());
+                ++m_stats.invalid;
+            }
+
+            EraseInternal(orphan_hash);
+        }
+    }
+
+    return accepted_count;
+}
+
+bool OrphanTxManager::Contains(const uint256& hash) const
+{
+    return m_orphans.count(hash) > 0;
+}
+
+const CTransaction* OrphanTxManager::Get(const uint256& hash) const
+{
+    auto it = m_orphans.find(hash);
+    if (it == m_orphans.end()) {
+        return nullptr;
+    }
+
+    return &it->second.tx;
+}
+
+bool OrphanTxManager::Erase(const uint256& hash)
+{
+    return EraseInternal(hash);
+}
+
+size_t OrphanTxManager::EraseForPeer(NodeId peer)
+{
+    const auto peer_it = m_by_peer.find(peer);
+
+    if (peer_it == m_by_peer.end()) {
+        return 0;
+    }
+
+    // Copy because EraseInternal removes the peer's entry from the index:
+    const std::set<uint256> hashes = peer_it->second;
+
+    for (const uint256& hash : hashes) {
+        EraseInternal(hash);
+    }
+
+    m_stats.peer_erased += hashes.size();
+
+    LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: erased %u orphans from peer=%d",
+             hashes.size(), peer);
+
+    return hashes.size();
+}
+
+size_t OrphanTxManager::EraseExpired(int64_t now)
+{
+    size_t count = 0;
+
+    while (!m_by_time.empty() && now - m_by_time.begin()->first > MAX_ORPHAN_AGE_SECONDS) {
+        // Copy because EraseInternal removes the entry from the time index:
+        const uint256 hash = m_by_time.begin()->second;
+        EraseInternal(hash);
+        ++count;
+    }
+
+    m_stats.expired += count;
+
+    if (count > 0) {
+        LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: expired %u orphans, %u remaining",
+                 count, m_orphans.size());
+    }
+
+    return count;
+}
+
+size_t OrphanTxManager::LimitSize(size_t max_count, size_t max_bytes)
+{
+    size_t count = 0;
+
+    while (!m_orphans.empty() && (m_orphans.size() > max_count || m_stats.bytes > max_bytes)) {
+        EvictRandom();
+        ++count;
+    }
+
+    m_stats.evicted += count;
+
+    return count;
+}
+
+size_t OrphanTxManager::Size() const
+{
+    return m_orphans.size();
+}
+
+size_t OrphanTxManager::Bytes() const
+{
+    return m_stats.bytes;
+}
+
+OrphanTxManager::Stats OrphanTxManager::GetStats() const
+{
+    Stats stats = m_stats;
+    stats.count = m_orphans.size();
+
+    return stats;
+}
+
+void OrphanTxManager::Clear()
+{
+    m_orphans.clear();
+    m_by_prevout.clear();
+    m_orphan_list.clear();
+    m_by_time.clear();
+    m_by_peer.clear();
+    m_stats.bytes = 0;
+}
+
+bool OrphanTxManager::EraseInternal(const uint256& hash)
+{
+    auto it = m_orphans.find(hash);
+    if (it == m_orphans.end()) {
+        return false;
+    }
+
+    const OrphanEntry& entry = it->second;
+
+    for (const auto& txin : entry.tx.vin) {
+        auto prevout_it = m_by_prevout.find(txin.prevout);
+        if (prevout_it == m_by_prevout.end()) {
+            continue;
+        }
+
+        prevout_it->second.erase(hash);
+
+        if (prevout_it->second.empty()) {
+            m_by_prevout.erase(prevout_it);
+        }
+    }
+
+    m_by_time.erase({entry.time_received, hash});
+
+    auto peer_it = m_by_peer.find(entry.from_peer);
+    if (peer_it != m_by_peer.end()) {
+        peer_it->second.erase(hash);
+
+        if (peer_it->second.empty()) {
+            m_by_peer.erase(peer_it);
+        }
+    }
+
+    // Swap the last hash into the erased slot to keep the list dense.
+    const size_t position = entry.list_position;
+    if (position + 1 != m_orphan_list.size()) {
+        const uint256& last_hash = m_orphan_list.back();
+        m_orphans.find(last_hash)->second.list_position = position;
+        m_orphan_list[position] = last_hash;
+    }
+    m_orphan_list.pop_back();
+
+    m_stats.bytes -= entry.size;
+    m_orphans.erase(it);
+
+    return true;
+}
+
+void OrphanTxManager::EvictRandom()
+{
+    if (m_orphan_list.empty()) {
+        return;
+    }
+
+    const uint256 hash = m_orphan_list[GetRand<size_t>(m_orphan_list.size())];
+
+    LogPrint(BCLog::LogFlags::MEMPOOL, "OrphanTxManager: evicting orphan tx %s", hash.ToString());
+
+    EraseInternal(hash);
+}
+
+std::vector<uint256> OrphanTxManager::FindChildren(const uint256& parent_hash) const
+{
+    std::set<uint256> children;
+
+    // The outpoint index sorts by transaction hash first, so every output of
+    // the parent forms one contiguous range:
+    for (auto it = m_by_prevout.lower_bound(COutPoint(parent_hash, 0));
+         it != m_by_prevout.end() && it->first.hash == parent_hash;
+         ++it)
+    {
+        children.insert(it->second.begin(), it->second.end());
+    }
+
+    return std::vector<uint256>(children.begin(), children.end());
+}
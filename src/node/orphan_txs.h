@@ -0,0 +1,150 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_NODE_ORPHAN_TXS_H
+#define GRIDCOIN_NODE_ORPHAN_TXS_H
+
+#include "main.h"
+#include "net.h"
+#include "primitives/transaction.h"
+#include "uint256.h"
+
+#include <functional>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//!
+//! \brief Manages orphan transactions — transactions received before the
+//! transactions that they spend.
+//!
+//! Replaces the legacy global mapOrphanTransactions /
+//! mapOrphanTransactionsByPrev. Entries are bounded by count and by total
+//! serialized size, expire by age, and are dropped when the peer that sent
+//! them disconnects. An outpoint index finds the orphans that spend a newly
+//! accepted transaction, and time and peer indices find the orphans to expire
+//! or to drop for a peer, without scanning the pool.
+//!
+class OrphanTxManager
+{
+public:
+    //! Maximum serialized size of a single orphan. Ignoring big orphans avoids
+    //! a send-big-orphans memory exhaustion attack. A peer with a legitimate
+    //! large transaction will rebroadcast it after its parents confirm.
+    static constexpr size_t MAX_ORPHAN_TX_SIZE = 5000;
+
+    //! Maximum total serialized size of all stored orphans.
+    static constexpr size_t MAX_ORPHAN_TOTAL_SIZE = 5 * 1000 * 1000;
+
+    //! Maximum age in seconds before an orphan is eligible for eviction.
+    static constexpr int64_t MAX_ORPHAN_AGE_SECONDS = 20 * 60;
+
+    //!
+    //! \brief Lifetime counters reported by getnetworkinfo.
+    //!
+    struct Stats
+    {
+        size_t count = 0;         //!< Orphans currently stored.
+        size_t bytes = 0;         //!< Serialized size of the stored orphans.
+        uint64_t added = 0;       //!< Orphans stored since startup.
+        uint64_t rejected = 0;    //!< Orphans ignored because they were too large.
+        uint64_t accepted = 0;    //!< Orphans accepted after a parent arrived.
+        uint64_t invalid = 0;     //!< Orphans removed because they failed validation.
+        uint64_t expired = 0;     //!< Orphans removed by age.
+        uint64_t evicted = 0;     //!< Orphans removed to make room.
+        uint64_t peer_erased = 0; //!< Orphans removed when their peer disconnected.
+    };
+
+    //! Add an orphan transaction received from \p peer. Returns false if the
+    //! transaction is a duplicate or larger than MAX_ORPHAN_TX_SIZE.
+    //! The caller must hold cs_main.
+    bool Add(const CTransaction& tx, NodeId peer, int64_t now);
+
+    //! Process the orphans that spend outputs of \p accepted_hash, breadth-first.
+    //! For each one, calls \p accept_fn. When it returns true, the orphan is
+    //! removed and the orphans spending its outputs are queued. When it returns
+    //! false and sets its second argument (missing inputs), the orphan stays in
+    //! the pool. Otherwise the orphan is invalid and is removed.
+    //! Returns the count of orphans for which accept_fn returned true.
+    size_t ProcessQueue(
+        const uint256& accepted_hash,
+        std::function<bool(CTransaction&, bool&)> accept_fn);
+
+    //! Returns true if \p hash is a known orphan.
+    bool Contains(const uint256& hash) const;
+
+    //! Returns the orphan with hash \p hash or nullptr if it is not stored.
+    const CTransaction* Get(const uint256& hash) const;
+
+    //! Remove the orphan with hash \p hash. Returns false if it is not stored.
+    bool Erase(const uint256& hash);
+
+    //! Remove every orphan received from \p peer. Returns the number removed.
+    size_t EraseForPeer(NodeId peer);
+
+    //! Evict orphans older than MAX_ORPHAN_AGE_SECONDS relative to \p now.
+    //! Walks the time index from the oldest entry, so it only visits the
+    //! orphans that it evicts. Returns the number evicted.
+    size_t EraseExpired(int64_t now);
+
+    //! Evict random orphans until at most \p max_count remain and their total
+    //! serialized size does not exceed \p max_bytes. Returns the number evicted.
+    size_t LimitSize(size_t max_count, size_t max_bytes = MAX_ORPHAN_TOTAL_SIZE);
+
+    //! Current number of stored orphans.
+    size_t Size() const;
+
+    //! Current serialized size of the stored orphans.
+    size_t Bytes() const;
+
+    //! Current and lifetime counters.
+    Stats GetStats() const;
+
+    //! Remove all orphans. Lifetime counters are kept.
+    void Clear();
+
+private:
+    struct OrphanEntry
+    {
+        CTransaction tx;
+        NodeId from_peer;
+        int64_t time_received;
+        size_t size;
+        size_t list_position; //!< Index of this entry's hash in m_orphan_list.
+    };
+
+    //! Primary storage: orphan transaction hash -> entry.
+    std::unordered_map<uint256, OrphanEntry, BlockHasher> m_orphans;
+
+    //! Outpoint index: spent outpoint -> orphans that spend it.
+    std::map<COutPoint, std::set<uint256>> m_by_prevout;
+
+    //! Hashes of all orphans for constant-time random eviction.
+    std::vector<uint256> m_orphan_list;
+
+    //! Time index: (time received, hash) of every orphan, oldest first.
+    std::set<std::pair<int64_t, uint256>> m_by_time;
+
+    //! Peer index: peer -> orphans received from it.
+    std::map<NodeId, std::set<uint256>> m_by_peer;
+
+    Stats m_stats;
+
+    //! Remove an orphan from all internal indices. Returns false if it is not
+    //! stored.
+    bool EraseInternal(const uint256& hash);
+
+    //! Evict one random orphan to make room. Calls EraseInternal.
+    void EvictRandom();
+
+    //! Collect the orphans that spend outputs of the transaction \p parent_hash.
+    std::vector<uint256> FindChildren(const uint256& parent_hash) const;
+};
+
+//! Global orphan transaction manager instance. Requires cs_main for all access.
+extern OrphanTxManager g_orphan_txs;
+
+#endif // GRIDCOIN_NODE_ORPHAN_TXS_H
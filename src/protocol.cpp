@@ -37,6 +37,8 @@ namespace NetMsgType {
     // Gridcoin specific
     const char *SCRAPERINDEX="scraperindex";
     const char *PART="part";
+    const char *PARTBASE="partbase";
+    const char *PARTDELTA="partdelta";
 }
 
 static const char* ppszTypeName[] =
@@ -76,6 +78,8 @@ const static std::string allNetMessageTypes[] = {
     // Gridcoin specific
     NetMsgType::SCRAPERINDEX,
     NetMsgType::PART,
+    NetMsgType::PARTBASE,
+    NetMsgType::PARTDELTA,
 };
 
 const static std::vector<std::string> allNetMessageTypesVec(std::begin(allNetMessageTypes), std::end(allNetMessageTypes));
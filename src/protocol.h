@@ -64,6 +64,13 @@ enum ServiceFlags : uint64_t {
     NODE_NONE = 0,
     // NODE_NETWORK means that the node is capable of serving the complete block chain.
     NODE_NETWORK = (1 << 0),
+    // Bits 1 through 11 carry service flags in Bitcoin (NODE_GETUTXO, NODE_BLOOM,
+    // NODE_WITNESS and others). Gridcoin leaves them unused so that their meaning
+    // never conflicts, and takes its own flags from bit 24 upward.
+
+    // NODE_PART_DELTA means that the node understands the partbase and partdelta
+    // messages, so scraper manifest parts can be sent to it as deltas.
+    NODE_PART_DELTA = (1 << 24),
 };
 
 /** A CService with information about it as peer */
@@ -253,6 +260,18 @@ namespace NetMsgType {
     */
     extern const char *PART;
 
+    /**
+    * Gridcoin specific message. Names a part that the sender holds and that
+    * the receiver may use as the base of a delta for a part requested next.
+    */
+    extern const char *PARTBASE;
+
+    /**
+    * Gridcoin specific message. Carries a part as a delta against a part
+    * named by an earlier partbase message.
+    */
+    extern const char *PARTDELTA;
+
     /**
     * Gridcoin alias for version message (will be removed)
     */
@@ -142,9 +142,8 @@ QString formatServicesStr(quint64 mask)
 {
     QStringList strList;
 
-    // Just scan the last 8 bits for now.
-    for (int i = 0; i < 8; i++) {
-        uint64_t check = 1 << i;
+    for (int i = 0; i < 64; i++) {
+        uint64_t check = uint64_t{1} << i;
         if (mask & check)
         {
             switch (check)
@@ -152,6 +151,9 @@ QString formatServicesStr(quint64 mask)
             case NODE_NETWORK:
                 strList.append("NETWORK");
                 break;
+            case NODE_PART_DELTA:
+                strList.append("PART_DELTA");
+                break;
             // These are for Bitcoin and are unused right now.
             //case NODE_GETUTXO:
             //    strList.append("GETUTXO");
@@ -11,19 +11,32 @@
 #include "gridcoin/scraper/scraper_registry.h"
 #include "gridcoin/sidestake.h"
 #include "node/blockstorage.h"
+#include "node/chaintip.h"
 #include <util/string.h>
 #include "gridcoin/mrc.h"
 #include "gridcoin/support/block_finder.h"
 #include "gridcoin/support/xml.h"
+#include "index/addressindex.h"
+#include "key_io.h"
 
 #include <univalue.h>
+#include <atomic>
 #include <stdexcept>
+#include <thread>
 
 extern CCriticalSection cs_ConvergedScraperStatsCache;
 extern ConvergedScraperStats ConvergedScraperStatsCache;
 
 using namespace std;
 
+namespace {
+//! Number of blocks that exportblocks reads and writes per step.
+constexpr size_t EXPORT_CHUNK_SIZE = 256;
+
+//! Upper bound for the threads that exportblocks reads blocks with.
+constexpr unsigned int MAX_EXPORT_THREADS = 8;
+} // Anonymous namespace
+
 bool AskForOutstandingBlocks(uint256 hashStart);
 bool ForceReorganizeToHash(uint256 NewHash);
 extern UniValue MagnitudeReport(const GRC::Cpid cpid);
@@ -185,18 +198,60 @@ UniValue SuperblockToJson(const GRC::SuperblockPtr& superblock)
     return SuperblockToJson(*superblock);
 }
 
-UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTransactionDetail)
+//!
+//! \brief Parts of the JSON representation of a block that read the chain
+//! state and therefore require a lock on cs_main.
+//!
+struct BlockStateJson
+{
+    GRC::MintSummary m_mint;  //!< Reads the spent outputs from the txdb.
+    GRC::MRCFees m_mrc_fees;  //!< Zero before block version 12.
+    UniValue m_claim;         //!< Reads the tally for the magnitude unit.
+};
+
+static BlockStateJson GetBlockStateJson(const CBlock& block, CBlockIndex* const blockindex) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+
+    BlockStateJson state;
+
+    state.m_mint = block.GetMint();
+
+    if (block.nVersion >= 12) {
+        state.m_mrc_fees = block.GetMRCFees();
+    }
+
+    state.m_claim = ClaimToJson(block.GetClaim(), blockindex);
+
+    return state;
+}
+
+//!
+//! \brief Build the JSON representation of a block for getblock,
+//! getblocksbatch and exportblocks.
+//!
+//! This does not read the chain state, so it needs no lock on cs_main.
+//!
+//! \param pindex_next   Successor of the block in the chain that the caller
+//! observes, or \c nullptr.
+//! \param confirmations Depth of the block in that chain.
+//! \param state         Parts of the representation taken under cs_main.
+//!
+static UniValue BlockToJsonImpl(
+    const CBlock& block,
+    CBlockIndex* blockindex,
+    const CBlockIndex* pindex_next,
+    const int confirmations,
+    const bool fPrintTransactionDetail,
+    BlockStateJson state)
 {
     UniValue result(UniValue::VOBJ);
 
     result.pushKV("hash", block.GetHash().GetHex());
 
-    const GRC::MintSummary mint = block.GetMint();
-
-    CMerkleTx txGen(block.vtx[0]);
-    txGen.SetMerkleBranch(&block);
+    const GRC::MintSummary& mint = state.m_mint;
 
-    result.pushKV("confirmations", txGen.GetDepthInMainChain());
+    result.pushKV("confirmations", confirmations);
     result.pushKV("size", (int)::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION));
     result.pushKV("height", blockindex->nHeight);
     result.pushKV("version", block.nVersion);
@@ -212,8 +267,8 @@ UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTr
 
     if (blockindex->pprev)
         result.pushKV("previousblockhash", blockindex->pprev->GetBlockHash().GetHex());
-    if (blockindex->pnext)
-        result.pushKV("nextblockhash", blockindex->pnext->GetBlockHash().GetHex());
+    if (pindex_next)
+        result.pushKV("nextblockhash", pindex_next->GetBlockHash().GetHex());
 
     const GRC::Claim& claim = block.GetClaim();
 
@@ -252,7 +307,7 @@ UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTr
     if (block.IsProofOfStake())
         result.pushKV("signature", HexStr(block.vchBlockSig));
 
-    result.pushKV("claim", ClaimToJson(block.GetClaim(), blockindex));
+    result.pushKV("claim", std::move(state.m_claim));
 
     if (LogInstance().WillLogCategory(BCLog::LogFlags::NET)) result.pushKV("BoincHash",block.vtx[0].hashBoinc);
 
@@ -263,10 +318,8 @@ UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTr
     result.pushKV("fees_collected", ValueFromAmount(mint.m_fees));
 
     if (block.nVersion >= 12) {
-        GRC::MRCFees mrc_fees = block.GetMRCFees();
-
-        result.pushKV("mrc_foundation_fees", ValueFromAmount(mrc_fees.m_mrc_foundation_fees));
-        result.pushKV("mrc_staker_fees", ValueFromAmount(mrc_fees.m_mrc_staker_fees));
+        result.pushKV("mrc_foundation_fees", ValueFromAmount(state.m_mrc_fees.m_mrc_foundation_fees));
+        result.pushKV("mrc_staker_fees", ValueFromAmount(state.m_mrc_fees.m_mrc_staker_fees));
     }
 
     result.pushKV("IsSuperBlock", blockindex->IsSuperblock());
@@ -275,6 +328,128 @@ UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTr
     return result;
 }
 
+UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTransactionDetail)
+{
+    CMerkleTx txGen(block.vtx[0]);
+    txGen.SetMerkleBranch(&block);
+
+    return BlockToJsonImpl(
+        block,
+        blockindex,
+        blockindex->pnext,
+        txGen.GetDepthInMainChain(),
+        fPrintTransactionDetail,
+        GetBlockStateJson(block, blockindex));
+}
+
+UniValue blockToJSON(
+    const CBlock& block,
+    CBlockIndex* blockindex,
+    const CBlockIndex* pindex_next,
+    const int confirmations,
+    const bool fPrintTransactionDetail)
+{
+    BlockStateJson state;
+
+    {
+        LOCK(cs_main);
+        state = GetBlockStateJson(block, blockindex);
+    }
+
+    return BlockToJsonImpl(
+        block,
+        blockindex,
+        pindex_next,
+        confirmations,
+        fPrintTransactionDetail,
+        std::move(state));
+}
+
+//!
+//! \brief Position of a block relative to the best chain.
+//!
+struct BlockChainPosition
+{
+    const CBlockIndex* m_next = nullptr; //!< Successor in the best chain.
+    int m_confirmations = -1;            //!< -1 when not in the best chain.
+};
+
+static BlockChainPosition GetBlockChainPosition(const CBlockIndex* const pindex) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+
+    if (!pindex->IsInMainChain()) {
+        return {};
+    }
+
+    return { pindex->pnext, nBestHeight - pindex->nHeight + 1 };
+}
+
+//!
+//! \brief Read a block from disk and build its getblock representation.
+//!
+//! The caller resolves the position of the block under cs_main and releases
+//! the lock before the call. This reads and converts the block without the lock
+//! and takes it again only for the parts that read the chain state.
+//!
+static UniValue ReadBlockToJson(
+    CBlockIndex* const pindex,
+    const BlockChainPosition& position,
+    const bool fPrintTransactionDetail)
+{
+    CBlock block;
+    ReadBlockFromDisk(block, pindex, Params().GetConsensus());
+
+    return blockToJSON(
+        block,
+        pindex,
+        position.m_next,
+        position.m_confirmations,
+        fPrintTransactionDetail);
+}
+
+//!
+//! \brief Call a function for each index in [0, count) on several threads.
+//!
+//! \throws The first exception thrown by a call, after all threads finish.
+//!
+template <typename Func>
+static void ParallelFor(const size_t count, const unsigned int thread_count, Func&& func)
+{
+    std::atomic<size_t> next_index { 0 };
+    std::exception_ptr error;
+    Mutex error_mutex;
+
+    const auto worker = [&]() {
+        for (size_t i = next_index++; i < count; i = next_index++) {
+            try {
+                func(i);
+            } catch (...) {
+                LOCK(error_mutex);
+                if (!error) error = std::current_exception();
+                next_index = count;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const size_t extra_threads = std::min<size_t>(thread_count, count) - 1;
+
+    for (size_t i = 0; i < extra_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 UniValue dumpcontracts(const UniValue& params, bool fHelp)
 {
     if (fHelp || params.size() < 2 || params.size() > 5) {
@@ -494,6 +669,405 @@ UniValue dumpcontracts(const UniValue& params, bool fHelp)
     return report;
 }
 
+UniValue exportblocks(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() < 1 || params.size() > 4)
+        throw runtime_error(
+                "exportblocks <file> [low height] [high height] [bool:txinfo]\n"
+                "\n"
+                "<file>          Output file.\n"
+                "[low height]    Optional low height. (If not specified then from genesis.)\n"
+                "[high height]   Optional high height. (If not specified then current head.)\n"
+                "[bool:txinfo]   Optional to export detailed tx info.\n"
+                "\n"
+                "Export blocks with their claims and transactions to a file as newline-\n"
+                "delimited JSON, one block per line in the format of getblock. The export\n"
+                "reads the chain as of the time of the call. It does not hold the chain\n"
+                "lock for the whole range, so it can export the full chain in one pass.\n");
+
+    fs::path path = fs::path(params[0].get_str());
+    if (path.empty()) throw runtime_error("Invalid path.");
+
+    // If provided filename does not have a path, then append parent path, otherwise leave alone.
+    if (path.parent_path().empty())
+        path = GetDataDir() / path;
+
+    if (fs::exists(path))
+    {
+        throw runtime_error("File already exists at location. Please delete or rename old file first.");
+    }
+
+    int low_height = 0;
+    int high_height = 0;
+    bool transaction_details = false;
+
+    if (params.size() > 1) low_height = params[1].get_int();
+    if (params.size() > 2) high_height = params[2].get_int();
+    if (params.size() > 3) transaction_details = params[3].get_bool();
+
+    if (low_height < 0 || high_height < 0)
+    {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Heights must not be negative.");
+    }
+
+    // Take a snapshot of the block index entries in the range. Each entry links
+    // to its ancestors through pprev, which never changes, so the export stays
+    // consistent even if the chain reorganizes while it runs.
+    std::vector<CBlockIndex*> snapshot;
+    CBlockIndex* pindex_after = nullptr;
+    uint256 snapshot_hash;
+    int snapshot_height = 0;
+
+    {
+        LOCK(cs_main);
+
+        if (!pindexBest) throw JSONRPCError(RPC_IN_WARMUP, "Block index not loaded.");
+
+        snapshot_hash = pindexBest->GetBlockHash();
+        snapshot_height = pindexBest->nHeight;
+
+        if (!high_height || high_height > snapshot_height) high_height = snapshot_height;
+
+        if (low_height > high_height)
+        {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Low height must not exceed the high height.");
+        }
+
+        snapshot.resize(high_height - low_height + 1);
+
+        for (CBlockIndex* pindex = pindexBest; pindex && pindex->nHeight >= low_height; pindex = pindex->pprev)
+        {
+            if (pindex->nHeight <= high_height) {
+                snapshot[pindex->nHeight - low_height] = pindex;
+            } else if (pindex->nHeight == high_height + 1) {
+                pindex_after = pindex;
+            }
+        }
+    }
+
+    fsbridge::ofstream file(path, std::ios_base::out | std::ios_base::trunc);
+
+    if (!file)
+    {
+        throw runtime_error("Failed to open " + path.string() + " for writing.");
+    }
+
+    const Consensus::Params& consensus = Params().GetConsensus();
+    const unsigned int thread_count = std::clamp(std::thread::hardware_concurrency(), 1u, MAX_EXPORT_THREADS);
+
+    size_t blocks_exported = 0;
+    uint64_t bytes_written = 0;
+
+    for (size_t begin = 0; begin < snapshot.size() && !fShutdown; begin += EXPORT_CHUNK_SIZE)
+    {
+        const size_t chunk_size = std::min(EXPORT_CHUNK_SIZE, snapshot.size() - begin);
+
+        std::vector<CBlock> blocks(chunk_size);
+        std::vector<BlockStateJson> states(chunk_size);
+
+        // Reading blocks does not need cs_main:
+        ParallelFor(chunk_size, thread_count, [&](const size_t i) {
+            const CBlockIndex* const pindex = snapshot[begin + i];
+
+            if (!ReadBlockFromDisk(blocks[i], pindex, consensus)) {
+                throw JSONRPCError(RPC_DATABASE_ERROR, strprintf("Failed to read block at height %d.", pindex->nHeight));
+            }
+        });
+
+        // The mint, MRC fees and claims read the chain state, which needs the
+        // lock. Take it once per chunk:
+        {
+            LOCK(cs_main);
+
+            for (size_t i = 0; i < chunk_size; ++i) {
+                states[i] = GetBlockStateJson(blocks[i], snapshot[begin + i]);
+            }
+        }
+
+        std::vector<std::string> lines(chunk_size);
+
+        ParallelFor(chunk_size, thread_count, [&](const size_t i) {
+            CBlockIndex* const pindex = snapshot[begin + i];
+            const CBlockIndex* const pindex_next = begin + i + 1 < snapshot.size()
+                ? snapshot[begin + i + 1]
+                : pindex_after;
+
+            lines[i] = BlockToJsonImpl(
+                blocks[i],
+                pindex,
+                pindex_next,
+                snapshot_height - pindex->nHeight + 1,
+                transaction_details,
+                std::move(states[i])).write();
+        });
+
+        for (const auto& line : lines) {
+            file << line << '\n';
+            bytes_written += line.size() + 1;
+        }
+
+        if (!file)
+        {
+            throw runtime_error("Failed to write to " + path.string() + ".");
+        }
+
+        blocks_exported += chunk_size;
+    }
+
+    file.close();
+
+    UniValue report(UniValue::VOBJ);
+
+    report.pushKV("snapshot_hash", snapshot_hash.GetHex());
+    report.pushKV("snapshot_height", snapshot_height);
+    report.pushKV("low_height", low_height);
+    report.pushKV("high_height", high_height);
+    report.pushKV("blocks_exported", (uint64_t)blocks_exported);
+    report.pushKV("bytes_written", bytes_written);
+    report.pushKV("complete", blocks_exported == snapshot.size());
+    report.pushKV("exported_to_file", path.string());
+
+    return report;
+}
+
+namespace {
+//! Default and maximum number of rows returned by one history page.
+constexpr int DEFAULT_INDEX_PAGE_SIZE = 100;
+constexpr int MAX_INDEX_PAGE_SIZE = 1000;
+
+//!
+//! \brief Get the height that the address and CPID indexes reached, and throw
+//! if the requested component is disabled.
+//!
+int GetIndexedHeight(CTxDB& txdb, const uint8_t component, const std::string& option)
+{
+    if (!(AddressIndex::Components() & component)) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Index is disabled. Restart with " + option + " to build it.");
+    }
+
+    return AddressIndex::ReadState(txdb).m_height;
+}
+
+void ParseIndexDestination(const std::string& address, AddressIndex::AddressType& type, uint160& hash)
+{
+    const CTxDestination dest = DecodeDestination(address);
+
+    if (!IsValidDestination(dest) || !AddressIndex::GetAddressKey(dest, type, hash)) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid Gridcoin address.");
+    }
+}
+
+void ParseIndexPage(const UniValue& params, const size_t first, int& skip, int& count)
+{
+    skip = 0;
+    count = DEFAULT_INDEX_PAGE_SIZE;
+
+    if (params.size() > first) skip = params[first].get_int();
+    if (params.size() > first + 1) count = params[first + 1].get_int();
+
+    if (skip < 0 || count < 1 || count > MAX_INDEX_PAGE_SIZE) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER,
+                           strprintf("Skip must not be negative and count must be between 1 and %d.",
+                                     MAX_INDEX_PAGE_SIZE));
+    }
+}
+
+void PushIndexStatus(UniValue& result, const int indexed_height)
+{
+    int best_height = 0;
+
+    {
+        LOCK(cs_main);
+        best_height = nBestHeight;
+    }
+
+    result.pushKV("indexed_height", indexed_height);
+    result.pushKV("synced", indexed_height >= best_height);
+}
+} // Anonymous namespace
+
+UniValue getaddresshistory(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() < 1 || params.size() > 3)
+        throw runtime_error(
+                "getaddresshistory <address> [skip] [count]\n"
+                "\n"
+                "<address>   Gridcoin address.\n"
+                "[skip]      Optional number of rows to skip. (Default 0.)\n"
+                "[count]     Optional number of rows to return. (Default 100, maximum 1000.)\n"
+                "\n"
+                "Requires -addressindex. Lists the outputs that pay to the address and the\n"
+                "inputs that spend them in chain order. Each row carries the balance change\n"
+                "of the address. Page through the history with skip and count.\n");
+
+    AddressIndex::AddressType type;
+    uint160 hash;
+    int skip;
+    int count;
+
+    ParseIndexDestination(params[0].get_str(), type, hash);
+    ParseIndexPage(params, 1, skip, count);
+
+    CTxDB txdb("r");
+    const int indexed_height = GetIndexedHeight(txdb, AddressIndex::ADDRESSES, "-addressindex");
+
+    UniValue history(UniValue::VARR);
+    bool has_more = false;
+    int skipped = 0;
+
+    const bool ok = AddressIndex::ScanAddress(txdb, type, hash, indexed_height, [&](const AddressIndex::AddressRow& row) {
+        if (skipped < skip) {
+            ++skipped;
+            return true;
+        }
+
+        if ((int)history.size() == count) {
+            has_more = true;
+            return false;
+        }
+
+        UniValue entry(UniValue::VOBJ);
+
+        entry.pushKV("height", row.m_key.m_height);
+        entry.pushKV("txid", row.m_key.m_txid.GetHex());
+        entry.pushKV(row.m_key.m_spending ? "vin" : "vout", (uint64_t)row.m_key.m_index);
+        entry.pushKV("amount", ValueFromAmount(row.m_delta));
+
+        history.push_back(entry);
+
+        return true;
+    });
+
+    if (!ok) throw JSONRPCError(RPC_DATABASE_ERROR, "Failed to read the address index.");
+
+    UniValue result(UniValue::VOBJ);
+
+    result.pushKV("address", params[0].get_str());
+    PushIndexStatus(result, indexed_height);
+    result.pushKV("skip", skip);
+    result.pushKV("has_more", has_more);
+    result.pushKV("history", history);
+
+    return result;
+}
+
+UniValue getaddressbalance(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw runtime_error(
+                "getaddressbalance <address>\n"
+                "\n"
+                "<address>   Gridcoin address.\n"
+                "\n"
+                "Requires -addressindex. Sums the balance changes of the address over the\n"
+                "indexed chain.\n");
+
+    AddressIndex::AddressType type;
+    uint160 hash;
+
+    ParseIndexDestination(params[0].get_str(), type, hash);
+
+    CTxDB txdb("r");
+    const int indexed_height = GetIndexedHeight(txdb, AddressIndex::ADDRESSES, "-addressindex");
+
+    CAmount received = 0;
+    CAmount sent = 0;
+    uint64_t rows = 0;
+
+    const bool ok = AddressIndex::ScanAddress(txdb, type, hash, indexed_height, [&](const AddressIndex::AddressRow& row) {
+        if (row.m_key.m_spending) {
+            sent -= row.m_delta;
+        } else {
+            received += row.m_delta;
+        }
+
+        ++rows;
+
+        return true;
+    });
+
+    if (!ok) throw JSONRPCError(RPC_DATABASE_ERROR, "Failed to read the address index.");
+
+    UniValue result(UniValue::VOBJ);
+
+    result.pushKV("address", params[0].get_str());
+    PushIndexStatus(result, indexed_height);
+    result.pushKV("balance", ValueFromAmount(received - sent));
+    result.pushKV("received", ValueFromAmount(received));
+    result.pushKV("sent", ValueFromAmount(sent));
+    result.pushKV("rows", rows);
+
+    return result;
+}
+
+UniValue getcpidhistory(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() < 1 || params.size() > 3)
+        throw runtime_error(
+                "getcpidhistory <cpid> [skip] [count]\n"
+                "\n"
+                "<cpid>      CPID of the researcher.\n"
+                "[skip]      Optional number of rows to skip. (Default 0.)\n"
+                "[count]     Optional number of rows to return. (Default 100, maximum 1000.)\n"
+                "\n"
+                "Requires -cpidindex. Lists the research rewards claimed in coinstakes and\n"
+                "the MRCs paid to the CPID in chain order. MRC amounts exclude the fee.\n");
+
+    const GRC::MiningId mining_id = GRC::MiningId::Parse(params[0].get_str());
+    const GRC::CpidOption cpid = mining_id.TryCpid();
+
+    if (!cpid) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid CPID.");
+    }
+
+    int skip;
+    int count;
+
+    ParseIndexPage(params, 1, skip, count);
+
+    CTxDB txdb("r");
+    const int indexed_height = GetIndexedHeight(txdb, AddressIndex::CPIDS, "-cpidindex");
+
+    UniValue history(UniValue::VARR);
+    bool has_more = false;
+    int skipped = 0;
+
+    const bool ok = AddressIndex::ScanCpid(txdb, *cpid, indexed_height, [&](const AddressIndex::CpidRow& row) {
+        if (skipped < skip) {
+            ++skipped;
+            return true;
+        }
+
+        if ((int)history.size() == count) {
+            has_more = true;
+            return false;
+        }
+
+        UniValue entry(UniValue::VOBJ);
+
+        entry.pushKV("height", row.m_key.m_height);
+        entry.pushKV("txid", row.m_key.m_txid.GetHex());
+        entry.pushKV("type", row.m_key.m_reward_type == AddressIndex::RewardType::MRC ? "mrc" : "claim");
+        entry.pushKV("amount", ValueFromAmount(row.m_amount));
+
+        history.push_back(entry);
+
+        return true;
+    });
+
+    if (!ok) throw JSONRPCError(RPC_DATABASE_ERROR, "Failed to read the CPID index.");
+
+    UniValue result(UniValue::VOBJ);
+
+    result.pushKV("cpid", cpid->ToString());
+    PushIndexStatus(result, indexed_height);
+    result.pushKV("skip", skip);
+    result.pushKV("has_more", has_more);
+    result.pushKV("history", history);
+
+    return result;
+}
+
 UniValue getmrcinfo(const UniValue& params, bool fHelp)
 {
     if (fHelp || params.size() > 4)
@@ -780,18 +1354,24 @@ UniValue showblock(const UniValue& params, bool fHelp)
                 "Returns all information about the block at <index>\n");
 
     int nHeight = params[0].get_int();
-    if (nHeight < 0 || nHeight > nBestHeight)
+    if (nHeight < 0 || nHeight > GetChainTip()->m_height)
         throw runtime_error("Block number out of range\n");
 
-    LOCK(cs_main);
+    CBlockIndex* pblockindex = nullptr;
+    BlockChainPosition position;
 
-    CBlockIndex* pblockindex = GRC::BlockFinder::FindByHeight(nHeight);
+    {
+        LOCK(cs_main);
 
-    if (pblockindex == nullptr)
-        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
-    CBlock block;
-    ReadBlockFromDisk(block, pblockindex, Params().GetConsensus());
-    return blockToJSON(block, pblockindex, false);
+        pblockindex = GRC::BlockFinder::FindByHeight(nHeight);
+
+        if (pblockindex == nullptr)
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
+
+        position = GetBlockChainPosition(pblockindex);
+    }
+
+    return ReadBlockToJson(pblockindex, position, false);
 }
 
 UniValue getbestblockhash(const UniValue& params, bool fHelp)
@@ -802,9 +1382,7 @@ UniValue getbestblockhash(const UniValue& params, bool fHelp)
                 "\n"
                 "Returns the hash of the best block in the longest block chain\n");
 
-    LOCK(cs_main);
-
-    return hashBestChain.GetHex();
+    return GetChainTip()->m_hash.GetHex();
 }
 
 UniValue getblockcount(const UniValue& params, bool fHelp)
@@ -815,9 +1393,7 @@ UniValue getblockcount(const UniValue& params, bool fHelp)
                 "\n"
                 "Returns the number of blocks in the longest block chain\n");
 
-    LOCK(cs_main);
-
-    return nBestHeight;
+    return GetChainTip()->m_height;
 }
 
 UniValue getdifficulty(const UniValue& params, bool fHelp)
@@ -828,11 +1404,11 @@ UniValue getdifficulty(const UniValue& params, bool fHelp)
                 "\n"
                 "Returns the difficulty as a multiple of the minimum difficulty\n");
 
-    LOCK(cs_main);
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
 
     UniValue obj(UniValue::VOBJ);
-    obj.pushKV("current", GRC::GetCurrentDifficulty());
-    obj.pushKV("target", GRC::GetTargetDifficulty());
+    obj.pushKV("current", tip->m_difficulty);
+    obj.pushKV("target", tip->m_target_difficulty);
 
     return obj;
 }
@@ -894,7 +1470,7 @@ UniValue getblockhash(const UniValue& params, bool fHelp)
                 "Returns hash of block in best-block-chain at <index>\n");
 
     int nHeight = params[0].get_int();
-    if (nHeight < 0 || nHeight > nBestHeight)
+    if (nHeight < 0 || nHeight > GetChainTip()->m_height)
         throw runtime_error("Block number out of range.");
 
     LogPrint(BCLog::LogFlags::NOISY, "Getblockhash %d", nHeight);
@@ -919,16 +1495,22 @@ UniValue getblock(const UniValue& params, bool fHelp)
     std::string strHash = params[0].get_str();
     uint256 hash = uint256S(strHash);
 
-    if (mapBlockIndex.count(hash) == 0)
-        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
+    CBlockIndex* pblockindex = nullptr;
+    BlockChainPosition position;
 
-    LOCK(cs_main);
+    {
+        LOCK(cs_main);
 
-    CBlock block;
-    CBlockIndex* pblockindex = mapBlockIndex[hash];
-    ReadBlockFromDisk(block, pblockindex, Params().GetConsensus());
+        const auto iter = mapBlockIndex.find(hash);
 
-    return blockToJSON(block, pblockindex, params.size() > 1 ? params[1].get_bool() : false);
+        if (iter == mapBlockIndex.end())
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
+
+        pblockindex = iter->second;
+        position = GetBlockChainPosition(pblockindex);
+    }
+
+    return ReadBlockToJson(pblockindex, position, params.size() > 1 ? params[1].get_bool() : false);
 }
 
 UniValue getblockbynumber(const UniValue& params, bool fHelp)
@@ -942,17 +1524,20 @@ UniValue getblockbynumber(const UniValue& params, bool fHelp)
                 "Returns details of a block with given block-number\n");
 
     int nHeight = params[0].get_int();
-    if (nHeight < 0 || nHeight > nBestHeight)
+    if (nHeight < 0 || nHeight > GetChainTip()->m_height)
         throw runtime_error("Block number out of range");
 
-    LOCK(cs_main);
+    CBlockIndex* pblockindex = nullptr;
+    BlockChainPosition position;
 
-    CBlock block;
+    {
+        LOCK(cs_main);
 
-    CBlockIndex* pblockindex = GRC::BlockFinder::FindByHeight(nHeight);
-    ReadBlockFromDisk(block, pblockindex, Params().GetConsensus());
+        pblockindex = GRC::BlockFinder::FindByHeight(nHeight);
+        position = GetBlockChainPosition(pblockindex);
+    }
 
-    return blockToJSON(block, pblockindex, params.size() > 1 ? params[1].get_bool() : false);
+    return ReadBlockToJson(pblockindex, position, params.size() > 1 ? params[1].get_bool() : false);
 }
 
 UniValue getblockbymintime(const UniValue& params, bool fHelp)
@@ -966,18 +1551,22 @@ UniValue getblockbymintime(const UniValue& params, bool fHelp)
                 "Returns details of the block at or just after the given timestamp\n");
 
     int64_t nTimestamp = params[0].get_int64();
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
 
-    if (nTimestamp < pindexGenesisBlock->nTime || nTimestamp > pindexBest->nTime)
+    if (!tip->m_index || nTimestamp < pindexGenesisBlock->nTime || nTimestamp > tip->m_index->nTime)
         throw runtime_error("Timestamp out of range. Cannot be below the time of the genesis block or above the time of the latest block");
 
-    LOCK(cs_main);
+    CBlockIndex* pblockindex = nullptr;
+    BlockChainPosition position;
 
-    CBlock block;
+    {
+        LOCK(cs_main);
 
-    CBlockIndex* pblockindex = GRC::BlockFinder::FindByMinTime(nTimestamp);
-    ReadBlockFromDisk(block, pblockindex, Params().GetConsensus());
+        pblockindex = GRC::BlockFinder::FindByMinTime(nTimestamp);
+        position = GetBlockChainPosition(pblockindex);
+    }
 
-    return blockToJSON(block, pblockindex, params.size() > 1 ? params[1].get_bool() : false);
+    return ReadBlockToJson(pblockindex, position, params.size() > 1 ? params[1].get_bool() : false);
 }
 
 UniValue getblocksbatch(const UniValue& params, bool fHelp)
@@ -1171,7 +1760,7 @@ UniValue rainbymagnitude(const UniValue& params, bool fHelp)
         LOCK(cs_ConvergedScraperStatsCache);
 
         // Make a local copy of the cached stats in the convergence and release the lock.
-        mScraperConvergedStats = ConvergedScraperStatsCache.mScraperConvergedStats.mScraperStats;
+        mScraperConvergedStats = ConvergedScraperStatsCache.mScraperConvergedStats.mScraperStats.ToMap();
     }
 
     LogPrint(BCLog::LogFlags::VERBOSE, "rainbymagnitude: mScraperConvergedStats size = %u", mScraperConvergedStats.size());
@@ -2358,7 +2947,7 @@ UniValue superblockage(const UniValue& params, bool fHelp)
 
     UniValue res(UniValue::VOBJ);
 
-    const GRC::SuperblockPtr superblock = GRC::Quorum::CurrentSuperblock();
+    const GRC::SuperblockPtr superblock = GetChainTip()->m_superblock;
 
     res.pushKV("Superblock Age", superblock.Age(GetAdjustedTime()));
     res.pushKV("Superblock Timestamp", TimestampToHRDate(superblock.m_timestamp));
@@ -2404,8 +2993,6 @@ UniValue superblocks(const UniValue& params, bool fHelp)
         LogPrint(BCLog::LogFlags::VERBOSE, "INFO: superblocks: CPID %s", cpid);
     }
 
-    LOCK(cs_main);
-
     res = SuperblockReport(lookback, displaycontract, cpid);
 
     return res;
@@ -3461,15 +4048,17 @@ UniValue getblockchaininfo(const UniValue& params, bool fHelp)
                 "\n"
                 "Displays data on current blockchain\n");
 
-    LOCK(cs_main);
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
+
+    if (!tip->m_index) throw JSONRPCError(RPC_IN_WARMUP, "Block index not loaded.");
 
     UniValue res(UniValue::VOBJ), diff(UniValue::VOBJ);
 
-    res.pushKV("blocks", nBestHeight);
+    res.pushKV("blocks", tip->m_height);
     res.pushKV("in_sync", !OutOfSyncByAge());
-    res.pushKV("moneysupply", ValueFromAmount(pindexBest->nMoneySupply));
-    diff.pushKV("current", GRC::GetCurrentDifficulty());
-    diff.pushKV("target", GRC::GetTargetDifficulty());
+    res.pushKV("moneysupply", ValueFromAmount(tip->m_index->nMoneySupply));
+    diff.pushKV("current", tip->m_difficulty);
+    diff.pushKV("target", tip->m_target_difficulty);
     res.pushKV("difficulty", diff);
     res.pushKV("testnet", fTestNet);
     res.pushKV("errors", GetWarnings("statusbar"));
@@ -3513,16 +4102,22 @@ UniValue SuperblockReport(int lookback, bool displaycontract, std::string cpid)
 {
     UniValue results(UniValue::VARR);
 
-    CBlockIndex* pblockindex = pindexBest;
+    // Every block reached through pprev from the published tip is in the best
+    // chain as of the snapshot, so the report needs no lock on cs_main:
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
+
+    const CBlockIndex* pblockindex = tip->m_index;
     if (!pblockindex) return results;
 
     const GRC::CpidOption cpid_parsed = GRC::MiningId::Parse(cpid).TryCpid();
 
     for (int i = 0; i < lookback; )
     {
-        if (pblockindex->IsInMainChain() && pblockindex->IsSuperblock())
+        CBlock block;
+
+        if (pblockindex->IsSuperblock() && ReadBlockFromDisk(block, pblockindex, Params().GetConsensus()))
         {
-            const GRC::ClaimOption claim = GetClaimByIndex(pblockindex);
+            const GRC::ClaimOption claim = block.PullClaim();
 
             if (claim && claim->ContainsSuperblock())
             {
@@ -30,6 +30,25 @@
 
 #include <stdexcept>
 
+//!
+//! \brief Build the getblock representation of a block in the best chain.
+//!
+UniValue blockToJSON(const CBlock& block, CBlockIndex* blockindex, bool fPrintTransactionDetail)
+    EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+
+//!
+//! \brief Build the getblock representation of a block at the specified
+//! position in a chain that the caller observes.
+//!
+//! Takes the lock on cs_main only for the parts that read the chain state.
+//!
+UniValue blockToJSON(
+    const CBlock& block,
+    CBlockIndex* blockindex,
+    const CBlockIndex* pindex_next,
+    int confirmations,
+    bool fPrintTransactionDetail);
+
 namespace GRC
 {
 class MockBlockIndex : CDiskBlockIndex
@@ -210,6 +210,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "dumpcontracts"          , 2 },
     { "dumpcontracts"          , 3 },
     { "dumpcontracts"          , 4 },
+    { "exportblocks"           , 1 },
+    { "exportblocks"           , 2 },
+    { "exportblocks"           , 3 },
     { "getblockstats"          , 0 },
     { "getblockstats"          , 1 },
     { "getblockstats"          , 2 },
@@ -232,6 +235,8 @@ static const CRPCConvertParam vRPCConvertParams[] =
 
     // Network
     { "getaddednodeinfo"       , 0 },
+    { "getaddresshistory"      , 1 },
+    { "getaddresshistory"      , 2 },
     { "getnodeaddresses"       , 0 },
     { "getblock"               , 1 },
     { "getblockbynumber"       , 0 },
@@ -241,6 +246,10 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "getblocksbatch"         , 1 },
     { "getblocksbatch"         , 2 },
     { "getblockhash"           , 0 },
+    { "getcpidhistory"         , 1 },
+    { "getcpidhistory"         , 2 },
+    { "getperfstats"           , 0 },
+    { "getperfstats"           , 1 },
     { "setban"                 , 2 },
     { "setban"                 , 3 },
     { "showblock"              , 0 },
@@ -6,6 +6,7 @@
 #include "init.h"
 #include "main.h"
 #include "miner.h"
+#include "node/chaintip.h"
 #include "gridcoin/accrual/snapshot.h"
 #include "gridcoin/quorum.h"
 #include "gridcoin/researcher.h"
@@ -42,21 +43,19 @@ UniValue getstakinginfo(const UniValue& params, bool fHelp)
     int64_t nTime = GetAdjustedTime();
     uint64_t nWeight = 0;
     double nNetworkWeight = 0;
-    double nCurrentDiff = 0;
-    double nTargetDiff = 0;
     uint64_t nExpectedTime = 0;
     {
         LOCK2(cs_main, pwalletMain->cs_wallet);
         nWeight = GRC::GetStakeWeight(*pwalletMain);
         nNetworkWeight = GRC::GetEstimatedNetworkWeight();
-        nCurrentDiff = GRC::GetCurrentDifficulty();
-        nTargetDiff = GRC::GetTargetDifficulty();
         nExpectedTime = GRC::GetEstimatedTimetoStake();
     }
 
-    obj.pushKV("blocks", nBestHeight);
-    diff.pushKV("current", nCurrentDiff);
-    diff.pushKV("target", nTargetDiff);
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
+
+    obj.pushKV("blocks", tip->m_height);
+    diff.pushKV("current", tip->m_difficulty);
+    diff.pushKV("target", tip->m_target_difficulty);
 
     const MinerStatus::SearchReport search = g_miner_status.GetSearchReport();
     diff.pushKV("last-search-interval", search.m_timestamp);
@@ -657,7 +656,10 @@ UniValue listresearcheraccounts(const UniValue& params, bool fHelp)
     UniValue result(UniValue::VOBJ);
     UniValue entries(UniValue::VARR);
 
+    LOCK(cs_main);
+
     const int64_t now = GetAdjustedTime();
+    const std::map<GRC::Cpid, CAmount> accruals = GRC::Tally::GetAccruals(now, pindexBest);
 
     for (const auto& iter : GRC::Tally::Accounts())
     {
@@ -665,7 +667,7 @@ UniValue listresearcheraccounts(const UniValue& params, bool fHelp)
 
         const GRC::Cpid& cpid = iter.first;
         const GRC::ResearchAccount& account = iter.second;
-        const int64_t accrual = GRC::Tally::GetAccrual(cpid, now, pindexBest);
+        const int64_t accrual = accruals.at(cpid);
 
         entry.pushKV("cpid", cpid.ToString());
         entry.pushKV("accrual_as_of_last_superblock", account.m_accrual);
@@ -674,7 +676,11 @@ UniValue listresearcheraccounts(const UniValue& params, bool fHelp)
         entries.push_back(entry);
     }
 
-    result.pushKV("number_of_accounts", (int) GRC::Tally::Accounts().size());
+    const GRC::ResearchAccountRange accounts = GRC::Tally::Accounts();
+
+    result.pushKV("number_of_accounts", (int) accounts.size());
+    result.pushKV("total_accrual_as_of_last_superblock", accounts.TotalAccrual());
+    result.pushKV("total_research_subsidy", accounts.TotalResearchSubsidy());
     result.pushKV("details", entries);
 
     return result;
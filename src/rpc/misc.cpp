@@ -5,9 +5,13 @@
 
 #include "protocol.h"
 #include "util.h"
+#include "util/perfstats.h"
 
 #include <univalue.h>
+#include <algorithm>
+#include <map>
 #include <stdexcept>
+#include <tuple>
 
 using namespace std;
 
@@ -84,6 +88,135 @@ UniValue logging(const UniValue& params, bool fHelp)
 }
 
 
+namespace {
+double NanosToMillis(const uint64_t nanos)
+{
+    return nanos / 1000000.0;
+}
+
+//! Strip the build directory from a __FILE__ path.
+std::string SourcePath(const std::string& file)
+{
+    const size_t pos = file.rfind("/src/");
+
+    return pos == std::string::npos ? file : file.substr(pos + 5);
+}
+} // Anonymous namespace
+
+UniValue getperfstats(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() > 2)
+    {
+        throw runtime_error(
+                "getperfstats [reset] [limit]\n"
+                "\n"
+                "[reset] -> Clear the counters after reading them (default: false).\n"
+                "[limit] -> Number of lock call sites to list, most waited-for first (default: 50).\n"
+                "\n"
+                "Returns the time that call sites waited for and held the profiled locks\n"
+                "(cs_main, cs_wallet, mempool.cs, cs_vNodes and the scraper locks), the\n"
+                "per-lock totals, and latency histograms of block, transaction, staking\n"
+                "and superblock validation paths since startup or the last reset.\n");
+    }
+
+    const bool reset = params.size() > 0 && params[0].get_bool();
+    const int limit = params.size() > 1 ? params[1].get_int() : 50;
+
+    if (limit < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "limit must be non-negative");
+    }
+
+    // The same site can occupy several slots when the file name literal has a
+    // different address in different translation units:
+    std::map<std::tuple<std::string, std::string, int>, LockProfileSite::Snapshot> sites;
+    std::map<std::string, LockProfileSite::Snapshot> totals;
+
+    for (const auto& snapshot : LockProfileSite::GetSnapshots()) {
+        const std::string file = SourcePath(snapshot.m_file);
+
+        for (auto* merged : { &sites[{snapshot.m_lock, file, snapshot.m_line}], &totals[snapshot.m_lock] }) {
+            merged->m_count += snapshot.m_count;
+            merged->m_contended += snapshot.m_contended;
+            merged->m_wait_ns += snapshot.m_wait_ns;
+            merged->m_max_wait_ns = std::max(merged->m_max_wait_ns, snapshot.m_max_wait_ns);
+            merged->m_hold_ns += snapshot.m_hold_ns;
+            merged->m_max_hold_ns = std::max(merged->m_max_hold_ns, snapshot.m_max_hold_ns);
+        }
+    }
+
+    std::vector<std::pair<std::string, LockProfileSite::Snapshot>> sorted_sites;
+    sorted_sites.reserve(sites.size());
+
+    for (const auto& [key, snapshot] : sites) {
+        sorted_sites.emplace_back(std::get<0>(key) + " " + std::get<1>(key) + ":" + ToString(std::get<2>(key)), snapshot);
+        sorted_sites.back().second.m_lock = std::get<0>(key);
+    }
+
+    std::sort(sorted_sites.begin(), sorted_sites.end(), [](const auto& a, const auto& b) {
+        return std::tie(a.second.m_wait_ns, a.second.m_hold_ns) > std::tie(b.second.m_wait_ns, b.second.m_hold_ns);
+    });
+
+    const auto lock_json = [](const LockProfileSite::Snapshot& snapshot) {
+        UniValue entry(UniValue::VOBJ);
+
+        entry.pushKV("acquisitions", snapshot.m_count);
+        entry.pushKV("contended", snapshot.m_contended);
+        entry.pushKV("wait_total_ms", NanosToMillis(snapshot.m_wait_ns));
+        entry.pushKV("wait_max_ms", NanosToMillis(snapshot.m_max_wait_ns));
+        entry.pushKV("hold_total_ms", NanosToMillis(snapshot.m_hold_ns));
+        entry.pushKV("hold_max_ms", NanosToMillis(snapshot.m_max_hold_ns));
+
+        return entry;
+    };
+
+    UniValue locks(UniValue::VARR);
+
+    for (size_t i = 0; i < sorted_sites.size() && i < static_cast<size_t>(limit); ++i) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("site", sorted_sites[i].first);
+        entry.pushKV("lock", sorted_sites[i].second.m_lock);
+        entry.pushKVs(lock_json(sorted_sites[i].second));
+
+        locks.push_back(entry);
+    }
+
+    UniValue lock_totals(UniValue::VOBJ);
+
+    for (const auto& [lock, snapshot] : totals) {
+        lock_totals.pushKV(lock, lock_json(snapshot));
+    }
+
+    UniValue latency(UniValue::VOBJ);
+
+    for (const auto& snapshot : LatencyHistogram::GetSnapshots()) {
+        UniValue entry(UniValue::VOBJ);
+
+        entry.pushKV("count", snapshot.m_count);
+        entry.pushKV("mean_ms", snapshot.m_count ? NanosToMillis(snapshot.m_total_ns) / snapshot.m_count : 0.0);
+        entry.pushKV("p50_ms", NanosToMillis(snapshot.Percentile(50)));
+        entry.pushKV("p90_ms", NanosToMillis(snapshot.Percentile(90)));
+        entry.pushKV("p99_ms", NanosToMillis(snapshot.Percentile(99)));
+        entry.pushKV("max_ms", NanosToMillis(snapshot.m_max_ns));
+
+        latency.pushKV(snapshot.m_name, entry);
+    }
+
+    UniValue result(UniValue::VOBJ);
+
+    result.pushKV("lock_sites", locks);
+    result.pushKV("lock_sites_total", (uint64_t)sorted_sites.size());
+    result.pushKV("locks", lock_totals);
+    result.pushKV("latency", latency);
+    result.pushKV("log_dropped_lines", LogInstance().DroppedLines());
+
+    if (reset) {
+        LockProfileSite::ResetAll();
+        LatencyHistogram::ResetAll();
+    }
+
+    return result;
+}
+
 UniValue listsettings(const UniValue& params, bool fHelp)
 {
     if (fHelp || params.size())
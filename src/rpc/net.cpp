@@ -14,6 +14,7 @@
 #include "net.h"
 #include "banman.h"
 #include "logging.h"
+#include "node/orphan_txs.h"
 
 using namespace std;
 
@@ -660,6 +661,21 @@ UniValue getnetworkinfo(const UniValue& params, bool fHelp)
     }
 
     res.pushKV("localaddresses", localAddresses);
+
+    const OrphanTxManager::Stats orphan_stats = g_orphan_txs.GetStats();
+
+    UniValue orphans(UniValue::VOBJ);
+    orphans.pushKV("count", (uint64_t)orphan_stats.count);
+    orphans.pushKV("bytes", (uint64_t)orphan_stats.bytes);
+    orphans.pushKV("added", orphan_stats.added);
+    orphans.pushKV("rejected", orphan_stats.rejected);
+    orphans.pushKV("accepted", orphan_stats.accepted);
+    orphans.pushKV("invalid", orphan_stats.invalid);
+    orphans.pushKV("expired", orphan_stats.expired);
+    orphans.pushKV("evicted", orphan_stats.evicted);
+    orphans.pushKV("peer_erased", orphan_stats.peer_erased);
+
+    res.pushKV("orphantransactions", orphans);
     res.pushKV("errors",          GetWarnings("statusbar"));
 
     return res;
@@ -6,8 +6,12 @@
 #ifndef BITCOIN_RPC_PROTOCOL_H
 #define BITCOIN_RPC_PROTOCOL_H
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <boost/iostreams/concepts.hpp>
@@ -38,6 +42,7 @@ enum HTTPStatusCode
     HTTP_FORBIDDEN             = 403,
     HTTP_NOT_FOUND             = 404,
     HTTP_INTERNAL_SERVER_ERROR = 500,
+    HTTP_SERVICE_UNAVAILABLE   = 503,
 };
 
 //! Gridcoin RPC error codes
@@ -69,6 +74,7 @@ enum RPCErrorCode
     RPC_VERIFY_ALREADY_IN_CHAIN     = -27, //!< Transaction already in chain
     RPC_IN_WARMUP                   = -28, //!< Client still warming up
     RPC_METHOD_DEPRECATED           = -32, //!< RPC method is deprecated
+    RPC_SERVER_BUSY                 = -37, //!< Concurrency limit of the method reached, retry later
 
     //! Aliases for backward compatibility
     RPC_TRANSACTION_ERROR           = RPC_VERIFY_ERROR,
@@ -163,7 +169,7 @@ private:
     boost::asio::ssl::stream<typename Protocol::socket>& stream;
 };
 
-class AcceptedConnection
+class AcceptedConnection : public std::enable_shared_from_this<AcceptedConnection>
 {
 public:
     virtual ~AcceptedConnection() {}
@@ -171,6 +177,57 @@ public:
     virtual std::iostream& stream() = 0;
     virtual std::string peer_address_to_string() const = 0;
     virtual void close() = 0;
+
+    //!
+    //! \brief Determine whether the stream already holds input from a
+    //! pipelined request so that reading it does not wait on the socket.
+    //!
+    virtual bool has_buffered_input() = 0;
+
+    //!
+    //! \brief Wait on the I/O context for the peer to send data without
+    //! blocking a thread.
+    //!
+    //! Any thread may call this. The wait starts on the I/O thread, which runs
+    //! all the asynchronous operations of the connection.
+    //!
+    //! \param timeout Close the wait when the peer stays idle this long.
+    //! \param handler Called on the I/O thread with \c true when data is ready
+    //! to read or with \c false when the wait timed out or failed.
+    //!
+    virtual void async_wait_readable(
+        std::chrono::seconds timeout,
+        std::function<void(bool)> handler) = 0;
+
+    //!
+    //! \brief Send a reply without blocking the I/O thread and close the
+    //! connection when the write completes or fails.
+    //!
+    //! The data bypasses SSL. Call this on the I/O thread for connections that
+    //! do not use SSL only.
+    //!
+    virtual void async_write_and_close(std::string data) = 0;
+
+    //!
+    //! \brief Limit the time that a worker thread may spend reading the next
+    //! request from the peer.
+    //!
+    //! The worker reads a request with blocking calls. Without a deadline, a
+    //! client that sends a partial request holds the worker indefinitely. When
+    //! the deadline expires, the I/O thread shuts down the receive side of the
+    //! socket so that the blocked read returns.
+    //!
+    //! \param timeout Time allowed to read the whole request.
+    //!
+    virtual void start_read_deadline(std::chrono::seconds timeout) = 0;
+
+    //!
+    //! \brief Disarm the deadline set by start_read_deadline().
+    //!
+    //! \return \c false when the deadline expired before the call. The request
+    //! read since start_read_deadline() is then incomplete.
+    //!
+    virtual bool stop_read_deadline() = 0;
 };
 
 template <typename Protocol>
@@ -183,7 +240,10 @@ public:
             bool fUseSSL) :
         sslStream(io_context, context),
         _d(sslStream, fUseSSL),
-        _stream(_d)
+        _stream(_d),
+        m_use_ssl(fUseSSL),
+        m_idle_timer(io_context),
+        m_read_timer(io_context)
     {
     }
 
@@ -202,12 +262,144 @@ public:
         _stream.close();
     }
 
+    virtual bool has_buffered_input()
+    {
+        if (_stream.rdbuf()->in_avail() > 0) return true;
+
+        return m_use_ssl && SSL_pending(sslStream.native_handle()) > 0;
+    }
+
+    virtual void async_wait_readable(std::chrono::seconds timeout, std::function<void(bool)> handler)
+    {
+        std::shared_ptr<AcceptedConnection> self = shared_from_this();
+
+        // Worker threads return connections here while the I/O thread runs the
+        // handlers of other waits. Arm the socket and timer on the I/O thread:
+        post_to_io_thread([this, self, timeout, handler = std::move(handler)]() mutable {
+            arm_wait_readable(timeout, std::move(handler));
+        });
+    }
+
+    virtual void async_write_and_close(std::string data)
+    {
+        std::shared_ptr<AcceptedConnection> self = shared_from_this();
+        auto buffer = std::make_shared<std::string>(std::move(data));
+
+        boost::asio::async_write(
+            sslStream.next_layer(),
+            boost::asio::buffer(*buffer),
+            [this, self, buffer](const boost::system::error_code&, std::size_t) {
+                close();
+
+                // The stream device does not own the socket. Close it here so
+                // that the peer sees the end of the reply at once:
+                boost::system::error_code ignored;
+                sslStream.lowest_layer().close(ignored);
+            });
+    }
+
+    virtual void start_read_deadline(std::chrono::seconds timeout)
+    {
+        std::shared_ptr<AcceptedConnection> self = shared_from_this();
+        const uint64_t deadline_id = ++m_read_deadline_next_id;
+
+        m_read_deadline_id = deadline_id;
+
+        post_to_io_thread([this, self, timeout, deadline_id]() {
+#if BOOST_VERSION >= 107000
+            m_read_timer.expires_after(timeout);
+#else
+            m_read_timer.expires_from_now(timeout);
+#endif
+            m_read_timer.async_wait([this, self, deadline_id](const boost::system::error_code& error) {
+                uint64_t expected = deadline_id;
+
+                // Only expire the deadline if the worker did not disarm it:
+                if (error || !m_read_deadline_id.compare_exchange_strong(expected, 0)) {
+                    return;
+                }
+
+                boost::system::error_code ignored;
+                sslStream.lowest_layer().shutdown(boost::asio::socket_base::shutdown_receive, ignored);
+            });
+        });
+    }
+
+    virtual bool stop_read_deadline()
+    {
+        std::shared_ptr<AcceptedConnection> self = shared_from_this();
+        uint64_t expected = m_read_deadline_next_id;
+
+        const bool disarmed = m_read_deadline_id.compare_exchange_strong(expected, 0);
+
+        post_to_io_thread([this, self]() { m_read_timer.cancel(); });
+
+        return disarmed;
+    }
+
     typename Protocol::endpoint peer;
     boost::asio::ssl::stream<typename Protocol::socket> sslStream;
 
 private:
+    //!
+    //! \brief Run a function on the I/O thread, which owns the timers and the
+    //! asynchronous operations of the connection.
+    //!
+    template <typename F>
+    void post_to_io_thread(F&& func)
+    {
+#if BOOST_VERSION >= 107000
+        boost::asio::post(m_idle_timer.get_executor(), std::forward<F>(func));
+#else
+        m_idle_timer.get_io_service().post(std::forward<F>(func));
+#endif
+    }
+
+    void arm_wait_readable(std::chrono::seconds timeout, std::function<void(bool)> handler)
+    {
+        std::shared_ptr<AcceptedConnection> self = shared_from_this();
+        const uint64_t wait_id = ++m_wait_id;
+
+        m_waiting = true;
+
+#if BOOST_VERSION >= 107000
+        m_idle_timer.expires_after(timeout);
+#else
+        m_idle_timer.expires_from_now(timeout);
+#endif
+        m_idle_timer.async_wait([this, self, wait_id](const boost::system::error_code& error) {
+            // A timer from an earlier wait may still fire after the connection
+            // returned to the I/O context. Only cancel the wait that it guards:
+            if (!error && m_waiting && m_wait_id == wait_id) {
+                boost::system::error_code ignored;
+                sslStream.lowest_layer().cancel(ignored);
+            }
+        });
+
+        auto on_readable = [this, self, handler](const boost::system::error_code& error) {
+            m_waiting = false;
+            m_idle_timer.cancel();
+            handler(!error);
+        };
+
+#if BOOST_VERSION >= 107000
+        sslStream.lowest_layer().async_wait(boost::asio::socket_base::wait_read, on_readable);
+#else
+        sslStream.lowest_layer().async_read_some(
+            boost::asio::null_buffers(),
+            [on_readable](const boost::system::error_code& error, std::size_t) { on_readable(error); });
+#endif
+    }
+
     SSLIOStreamDevice<Protocol> _d;
     boost::iostreams::stream< SSLIOStreamDevice<Protocol> > _stream;
+    bool m_use_ssl;
+    boost::asio::steady_timer m_idle_timer;
+    uint64_t m_wait_id = 0;   //!< Accessed on the I/O thread only.
+    bool m_waiting = false;   //!< Accessed on the I/O thread only.
+    boost::asio::steady_timer m_read_timer;
+    uint64_t m_read_deadline_next_id = 0;        //!< Accessed by the worker that serves the connection only.
+    std::atomic<uint64_t> m_read_deadline_id{0}; //!< ID of the armed read deadline, or zero.
 };
 
 std::string HTTPPost(const std::string& strMsg, const std::map<std::string,std::string>& mapRequestHeaders);
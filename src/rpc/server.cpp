@@ -7,12 +7,14 @@
 #include "amount.h"
 #include <base58.h>
 #include "init.h"
+#include "main.h"
 #include "sync.h"
 #include <key_io.h>
 #include "node/ui_interface.h"
 #include "server.h"
 #include "client.h"
 #include "protocol.h"
+#include "work_queue.h"
 #include "random.h"
 #include "wallet/db.h"
 #include "util.h"
@@ -29,7 +31,14 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace std;
 using namespace boost;
@@ -46,6 +55,182 @@ static boost::thread_group* rpc_worker_group = nullptr;
 
 const UniValue emptyobj(UniValue::VOBJ);
 
+namespace {
+using ConnectionPtr = std::shared_ptr<AcceptedConnection>;
+
+//!
+//! \brief Methods that only read chain and transaction state.
+//!
+//! Consecutive batch elements that call these run in parallel. Elements that
+//! call any other method run alone and in order so that a batch which changes
+//! state observes its own changes.
+//!
+constexpr const char* PARALLEL_RPCS[] {
+    "getbestblockhash",
+    "getblock",
+    "getblockbynumber",
+    "getblockcount",
+    "getblockhash",
+    "getdifficulty",
+    "getrawtransaction",
+    "gettransaction",
+};
+
+//! Runs of parallel batch elements use one more thread for every this many
+//! elements.
+constexpr size_t MIN_CALLS_PER_BATCH_THREAD = 4;
+
+//! Upper bound for the threads that execute one batch.
+constexpr unsigned int MAX_BATCH_THREADS = 8;
+
+//!
+//! \brief Fixed set of threads that execute the elements of batch requests
+//! and serialize their replies.
+//!
+//! The RPC worker threads share the pool, which starts on first use. A batch
+//! runs on the calling thread and on any pool threads that are idle, so it
+//! never waits for the pool to finish serving another batch.
+//!
+class BatchPool
+{
+public:
+    static BatchPool& Get()
+    {
+        static BatchPool pool(std::clamp(std::thread::hardware_concurrency(), 1u, MAX_BATCH_THREADS) - 1);
+
+        return pool;
+    }
+
+    ~BatchPool()
+    {
+        {
+            LOCK(m_mutex);
+            m_stopping = true;
+        }
+
+        m_cond.notify_all();
+
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    //!
+    //! \brief Call a function for each index in [0, count) on the calling
+    //! thread and on up to \p helpers pool threads.
+    //!
+    template <typename Func>
+    void ForEach(const size_t count, const size_t helpers, Func&& func)
+    {
+        const auto job = std::make_shared<Job>(count, [&func](const size_t i) { func(i); });
+
+        {
+            LOCK(m_mutex);
+
+            for (size_t i = 0; i < std::min(helpers, m_threads.size()); ++i) {
+                m_jobs.push_back(job);
+            }
+        }
+
+        m_cond.notify_all();
+
+        job->Run();
+        job->Wait();
+    }
+
+private:
+    //!
+    //! \brief Indices of one batch shared by the threads that execute it.
+    //!
+    //! Pool threads may dequeue a job after the batch finished. They find no
+    //! index left and never call the function, which refers to the stack of
+    //! the thread that submitted the batch.
+    //!
+    class Job
+    {
+    public:
+        Job(const size_t count, std::function<void(size_t)> func)
+            : m_count(count), m_func(std::move(func))
+        {
+        }
+
+        void Run()
+        {
+            for (size_t i = m_next++; i < m_count; i = m_next++) {
+                m_func(i);
+
+                if (++m_done == m_count) {
+                    LOCK(m_mutex);
+                    m_cond.notify_all();
+                }
+            }
+        }
+
+        void Wait()
+        {
+            WAIT_LOCK(m_mutex, lock);
+            m_cond.wait(lock, [this]() { return m_done == m_count; });
+        }
+
+    private:
+        const size_t m_count;
+        const std::function<void(size_t)> m_func;
+        std::atomic<size_t> m_next { 0 };
+        std::atomic<size_t> m_done { 0 };
+        Mutex m_mutex;
+        std::condition_variable m_cond;
+    };
+
+    explicit BatchPool(const unsigned int thread_count)
+    {
+        for (unsigned int i = 0; i < thread_count; ++i) {
+            m_threads.emplace_back([this]() { ThreadMain(); });
+        }
+    }
+
+    void ThreadMain()
+    {
+        RenameThread("grc-rpc-batch");
+
+        while (true) {
+            std::shared_ptr<Job> job;
+
+            {
+                WAIT_LOCK(m_mutex, lock);
+
+                m_cond.wait(lock, [this]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_stopping || !m_jobs.empty(); });
+
+                if (m_stopping) {
+                    return;
+                }
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            job->Run();
+        }
+    }
+
+    Mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<std::shared_ptr<Job>> m_jobs GUARDED_BY(m_mutex);
+    bool m_stopping GUARDED_BY(m_mutex) = false;
+    std::vector<std::thread> m_threads;
+};
+
+RPCWorkQueue g_rpc_work_queue;
+RPCCallTracker g_rpc_calls;
+
+//! Number of keep-alive connections waiting on the I/O thread for a request.
+std::atomic<int> g_rpc_idle_connections{0};
+
+// Set by StartRPCThreads before the server threads start:
+std::chrono::seconds g_rpc_server_timeout{DEFAULT_RPC_SERVER_TIMEOUT};
+int g_rpc_threads = 0;
+bool g_rpc_use_ssl = false;
+} // Anonymous namespace
+
 int GetDefaultRPCPort()
 {
     return BaseParams().RPCPort();
@@ -272,6 +457,33 @@ UniValue stop(const UniValue& params, bool fHelp)
     return "Gridcoin server stopping";
 }
 
+UniValue getrpcstats(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() > 0)
+        throw runtime_error(
+                "getrpcstats\n"
+                "\n"
+                "Returns RPC server load: the work queue depth, the number of idle\n"
+                "keep-alive connections and the call count, latency and concurrency\n"
+                "limit of each method called since startup.\n");
+
+    const RPCWorkQueue::Stats queue_stats = g_rpc_work_queue.GetStats();
+
+    UniValue work_queue(UniValue::VOBJ);
+    work_queue.pushKV("depth", (uint64_t)queue_stats.m_depth);
+    work_queue.pushKV("max_depth", (uint64_t)queue_stats.m_max_depth);
+    work_queue.pushKV("peak_depth", (uint64_t)queue_stats.m_peak_depth);
+    work_queue.pushKV("dispatched", queue_stats.m_dispatched);
+    work_queue.pushKV("rejected", queue_stats.m_rejected);
+
+    UniValue result = g_rpc_calls.ToJson();
+    result.pushKV("threads", g_rpc_threads);
+    result.pushKV("idle_connections", g_rpc_idle_connections.load());
+    result.pushKV("work_queue", work_queue);
+
+    return result;
+}
+
 
 
 //
@@ -385,6 +597,7 @@ static const CRPCCommand vRPCCommands[] =
     { "currentcontractaverage",  &currentcontractaverage,  cat_developer     },
     { "debug",                   &debug,                   cat_developer     },
     { "dumpcontracts",           &dumpcontracts,           cat_developer     },
+    { "exportblocks",            &exportblocks,            cat_developer     },
     { "exportstats1",            &rpc_exportstats,         cat_developer     },
     { "getblockstats",           &rpc_getblockstats,       cat_developer     },
     { "getrecentblocks",         &rpc_getrecentblocks,     cat_developer     },
@@ -430,6 +643,8 @@ static const CRPCCommand vRPCCommands[] =
     { "clearbanned",             &clearbanned,             cat_network       },
     { "currenttime",             &currenttime,             cat_network       },
     { "getaddednodeinfo",        &getaddednodeinfo,        cat_network       },
+    { "getaddressbalance",       &getaddressbalance,       cat_network       },
+    { "getaddresshistory",       &getaddresshistory,       cat_network       },
     { "getnodeaddresses",        &getnodeaddresses,        cat_network       },
     { "getbestblockhash",        &getbestblockhash,        cat_network       },
     { "getblock",                &getblock,                cat_network       },
@@ -441,11 +656,14 @@ static const CRPCCommand vRPCCommands[] =
     { "getburnreport",           &getburnreport,           cat_network       },
     { "getcheckpoint",           &getcheckpoint,           cat_network       },
     { "getconnectioncount",      &getconnectioncount,      cat_network       },
+    { "getcpidhistory",          &getcpidhistory,          cat_network       },
     { "getdifficulty",           &getdifficulty,           cat_network       },
     { "getinfo",                 &getinfo,                 cat_network       },
     { "getnettotals",            &getnettotals,            cat_network       },
     { "getpeerinfo",             &getpeerinfo,             cat_network       },
+    { "getperfstats",            &getperfstats,            cat_network       },
     { "getrawmempool",           &getrawmempool,           cat_network       },
+    { "getrpcstats",             &getrpcstats,             cat_network       },
     { "listbanned",              &listbanned,              cat_network       },
     { "networktime",             &networktime,             cat_network       },
     { "ping",                    &ping,                    cat_network       },
@@ -501,6 +719,7 @@ void ErrorReply(std::ostream& stream, const UniValue& objError, const UniValue&
     int code = find_value(objError, "code").get_int();
     if (code == RPC_INVALID_REQUEST) nStatus = HTTP_BAD_REQUEST;
     else if (code == RPC_METHOD_NOT_FOUND) nStatus = HTTP_NOT_FOUND;
+    else if (code == RPC_SERVER_BUSY) nStatus = HTTP_SERVICE_UNAVAILABLE;
     string strReply = JSONRPCReply(NullUniValue, objError, id);
     stream << HTTPReply(nStatus, strReply, false) << std::flush;
 }
@@ -533,14 +752,63 @@ bool ClientAllowed(const boost::asio::ip::address& address)
     return false;
 }
 
-void ServiceConnection(AcceptedConnection *conn);
+static bool ServiceConnection(AcceptedConnection *conn);
+
+//!
+//! \brief Return a connection to the I/O thread until its client sends the
+//! next request, then queue it for an RPC worker thread.
+//!
+//! Idle keep-alive connections do not occupy a worker thread. They close when
+//! the client stays silent for longer than -rpcservertimeout.
+//!
+static void WaitForRequest(ConnectionPtr conn)
+{
+    ++g_rpc_idle_connections;
+
+    conn->async_wait_readable(g_rpc_server_timeout, [conn](const bool readable) {
+        --g_rpc_idle_connections;
+
+        if (!readable) {
+            conn->close();
+            return;
+        }
+
+        if (g_rpc_work_queue.Enqueue(conn)) {
+            return;
+        }
+
+        LogPrint(BCLog::LogFlags::RPC, "RPC work queue depth exceeded, rejecting connection from %s",
+                 conn->peer_address_to_string());
+
+        // Only send a 503 if we're not using SSL to prevent a DoS during the SSL handshake.
+        // A slow client must not stall the I/O thread, so write it asynchronously:
+        if (!g_rpc_use_ssl) {
+            conn->async_write_and_close(HTTPReply(HTTP_SERVICE_UNAVAILABLE, "", false));
+        } else {
+            conn->close();
+        }
+    });
+}
+
+static void RPCWorkerThread()
+{
+    RenameThread("grc-rpc");
+
+    while (ConnectionPtr conn = g_rpc_work_queue.Dequeue()) {
+        if (ServiceConnection(conn.get())) {
+            WaitForRequest(std::move(conn));
+        } else {
+            conn->close();
+        }
+    }
+}
 
 // Forward declaration required for RPCListen
 template <typename Protocol>
 static void RPCAcceptHandler(boost::shared_ptr< basic_socket_acceptor<Protocol> > acceptor,
                              ssl::context& context,
                              bool fUseSSL,
-                             AcceptedConnection* conn,
+                             ConnectionPtr conn,
                              const boost::system::error_code& error);
 
 /**
@@ -552,7 +820,7 @@ static void RPCListen(boost::shared_ptr< basic_socket_acceptor<Protocol> > accep
                       const bool fUseSSL)
 {
     // Accept connection
-    AcceptedConnectionImpl<Protocol>* conn = new AcceptedConnectionImpl<Protocol>(GetIOServiceFromPtr(acceptor), context, fUseSSL);
+    auto conn = std::make_shared<AcceptedConnectionImpl<Protocol>>(GetIOServiceFromPtr(acceptor), context, fUseSSL);
 
     acceptor->async_accept(
                 conn->sslStream.lowest_layer(),
@@ -561,7 +829,7 @@ static void RPCListen(boost::shared_ptr< basic_socket_acceptor<Protocol> > accep
                             acceptor,
                             boost::ref(context),
                             fUseSSL,
-                            conn,
+                            ConnectionPtr(conn),
                             boost::asio::placeholders::error));
 }
 
@@ -572,7 +840,7 @@ template <typename Protocol>
 static void RPCAcceptHandler(boost::shared_ptr< basic_socket_acceptor<Protocol> > acceptor,
                              ssl::context& context,
                              const bool fUseSSL,
-                             AcceptedConnection* conn,
+                             ConnectionPtr conn,
                              const boost::system::error_code& error)
 {
     // Immediately start accepting new connections, except when we're cancelled or our socket is closed.
@@ -585,20 +853,18 @@ static void RPCAcceptHandler(boost::shared_ptr< basic_socket_acceptor<Protocol>
         // Restrict callers by IP.  It is important to
         // do this before starting client thread, to filter out
         // certain DoS and misbehaving clients.
-        AcceptedConnectionImpl<ip::tcp>* tcp_conn = dynamic_cast< AcceptedConnectionImpl<ip::tcp>* >(conn);
+        AcceptedConnectionImpl<ip::tcp>* tcp_conn = dynamic_cast< AcceptedConnectionImpl<ip::tcp>* >(conn.get());
         if (tcp_conn && !ClientAllowed(tcp_conn->peer.address()))
         {
             // Only send a 403 if we're not using SSL to prevent a DoS during the SSL handshake.
             if (!fUseSSL)
-                conn->stream() << HTTPReply(HTTP_FORBIDDEN, "", false) << std::flush;
+                conn->async_write_and_close(HTTPReply(HTTP_FORBIDDEN, "", false));
+            else
+                conn->close();
         }
         else
-            ServiceConnection(conn);
-
-        conn->close();
+            WaitForRequest(std::move(conn));
     }
-
-    delete conn;
 }
 
 void StartRPCThreads()
@@ -635,6 +901,11 @@ void StartRPCThreads()
 
     const bool fUseSSL = gArgs.GetBoolArg("-rpcssl");
 
+    g_rpc_use_ssl = fUseSSL;
+    g_rpc_threads = std::max<int>(gArgs.GetArg("-rpcthreads", DEFAULT_RPC_THREADS), 1);
+    g_rpc_server_timeout = std::chrono::seconds(
+        std::max<int64_t>(gArgs.GetArg("-rpcservertimeout", DEFAULT_RPC_SERVER_TIMEOUT), 1));
+
     assert(rpc_io_service == nullptr);
     rpc_io_service = new ioContext();
     rpc_ssl_context = new ssl::context(ssl::context::sslv23);
@@ -717,9 +988,22 @@ void StartRPCThreads()
         return;
     }
 
+    const int work_queue_depth = std::max<int>(gArgs.GetArg("-rpcworkqueue", DEFAULT_RPC_WORK_QUEUE), 1);
+
+    g_rpc_work_queue.Start(work_queue_depth);
+    g_rpc_calls.Configure(g_rpc_threads, gArgs.GetArgs("-rpcmethodlimit"));
+
+    LogPrintf("RPC server: %d worker threads, work queue depth %d, timeout %ds",
+              g_rpc_threads,
+              work_queue_depth,
+              g_rpc_server_timeout.count());
+
+    // One thread accepts connections and waits for requests on idle keep-alive
+    // connections. The worker threads only execute requests:
     rpc_worker_group = new boost::thread_group();
-    for (int i = 0; i < gArgs.GetArg("-rpcthreads", 4); i++)
-        rpc_worker_group->create_thread(boost::bind(&ioContext::run, rpc_io_service));
+    rpc_worker_group->create_thread(boost::bind(&ioContext::run, rpc_io_service));
+    for (int i = 0; i < g_rpc_threads; i++)
+        rpc_worker_group->create_thread(&RPCWorkerThread);
 }
 
 void StopRPCThreads()
@@ -731,17 +1015,22 @@ void StopRPCThreads()
         return;
     }
 
+    g_rpc_work_queue.Interrupt();
     rpc_io_service->stop();
     if (rpc_worker_group != nullptr) {
         rpc_worker_group->join_all();
     }
 
+    g_rpc_work_queue.Clear();
+
     delete rpc_worker_group;
     rpc_worker_group = nullptr;
-    delete rpc_ssl_context;
-    rpc_ssl_context = nullptr;
+    // Destroying the I/O service releases the idle connections held by its
+    // pending handlers, so delete it before the SSL context they refer to:
     delete rpc_io_service;
     rpc_io_service = nullptr;
+    delete rpc_ssl_context;
+    rpc_ssl_context = nullptr;
 }
 
 class JSONRequest
@@ -810,41 +1099,130 @@ static UniValue JSONRPCExecOne(const UniValue& req)
     return rpc_result;
 }
 
-static string JSONRPCExecBatch(const UniValue& vReq)
+//!
+//! \brief Determine whether a batch element calls a method that may run in
+//! parallel with its neighbours.
+//!
+static bool IsParallelRequest(const UniValue& req)
 {
-    UniValue ret(UniValue::VARR);
-    for (unsigned int reqIdx = 0; reqIdx < vReq.size(); reqIdx++)
-        ret.push_back(JSONRPCExecOne(vReq[reqIdx]));
+    if (!req.isObject()) {
+        return false;
+    }
+
+    const UniValue& method = find_value(req.get_obj(), "method");
+
+    if (!method.isStr()) {
+        return false;
+    }
+
+    return std::any_of(std::begin(PARALLEL_RPCS), std::end(PARALLEL_RPCS), [&](const char* name) {
+        return method.get_str() == name;
+    });
+}
+
+//!
+//! \brief Join the serialized replies of a batch into one JSON array.
+//!
+static string JoinBatchReply(const std::vector<std::string>& parts)
+{
+    size_t size = parts.size() + 2;
 
-    return UniValue(ret).write() + "\n";
+    for (const auto& part : parts) {
+        size += part.size();
+    }
+
+    string reply;
+    reply.reserve(size);
+    reply += '[';
+
+    for (size_t i = 0; i < parts.size(); ++i) {
+        if (i > 0) {
+            reply += ',';
+        }
+
+        reply += parts[i];
+    }
+
+    reply += "]\n";
+
+    return reply;
 }
 
-void ServiceConnection(AcceptedConnection *conn)
+string JSONRPCExecBatch(const UniValue& vReq)
 {
-    bool fRun = true;
-    while (fRun && !fShutdown)
+    std::vector<std::string> parts(vReq.size());
+
+    // Block and transaction replies can add up to many megabytes of JSON, so
+    // the thread that executes an element also serializes its reply:
+    const auto exec_one = [&](const size_t i) {
+        parts[i] = JSONRPCExecOne(vReq[i]).write();
+    };
+
+    for (size_t i = 0; i < vReq.size();) {
+        if (!IsParallelRequest(vReq[i])) {
+            exec_one(i);
+            ++i;
+            continue;
+        }
+
+        const size_t begin = i;
+
+        while (i < vReq.size() && IsParallelRequest(vReq[i])) {
+            ++i;
+        }
+
+        const size_t count = i - begin;
+
+        BatchPool::Get().ForEach(count, count / MIN_CALLS_PER_BATCH_THREAD, [&](const size_t offset) {
+            exec_one(begin + offset);
+        });
+    }
+
+    return JoinBatchReply(parts);
+}
+
+//!
+//! \brief Serve the request that woke the connection and any pipelined
+//! requests that arrived with it.
+//!
+//! \return \c true when the connection stays open for the next request.
+//!
+static bool ServiceConnection(AcceptedConnection *conn)
+{
+    do
     {
         int nProto = 0;
         map<string, string> mapHeaders;
         string strRequest, strMethod, strURI;
 
+        // A client that stops sending in the middle of a request must not
+        // hold this worker, so the whole request shares one deadline:
+        conn->start_read_deadline(g_rpc_server_timeout);
+
         // Read HTTP request line
-        if (!ReadHTTPRequestLine(conn->stream(), nProto, strMethod, strURI))
-            break;
+        if (!ReadHTTPRequestLine(conn->stream(), nProto, strMethod, strURI)) {
+            conn->stop_read_deadline();
+            return false;
+        }
 
         // Read HTTP message headers and body
         ReadHTTPMessage(conn->stream(), mapHeaders, strRequest, nProto);
 
+        if (!conn->stop_read_deadline()) {
+            LogPrint(BCLog::LogFlags::RPC, "RPC request from %s timed out", conn->peer_address_to_string());
+            return false;
+        }
+
         if (strURI != "/") {
             conn->stream() << HTTPReply(HTTP_NOT_FOUND, "", false) << std::flush;
-            break;
+            return false;
         }
 
         // Check authorization
         if (mapHeaders.count("authorization") == 0)
         {
             conn->stream() << HTTPReply(HTTP_UNAUTHORIZED, "", false) << std::flush;
-            break;
+            return false;
         }
         if (!HTTPAuthorized(mapHeaders))
         {
@@ -856,10 +1234,10 @@ void ServiceConnection(AcceptedConnection *conn)
                 UninterruptibleSleep(std::chrono::milliseconds{250});
 
             conn->stream() << HTTPReply(HTTP_UNAUTHORIZED, "", false) << std::flush;
-            break;
+            return false;
         }
-        if (mapHeaders["connection"] == "close")
-            fRun = false;
+
+        const bool fRun = mapHeaders["connection"] != "close";
 
         JSONRequest jreq;
         try
@@ -891,14 +1269,22 @@ void ServiceConnection(AcceptedConnection *conn)
         catch (UniValue& objError)
         {
             ErrorReply(conn->stream(), objError, jreq.id);
-            break;
+            return false;
         }
         catch (std::exception& e)
         {
             ErrorReply(conn->stream(), JSONRPCError(RPC_PARSE_ERROR, e.what()), jreq.id);
-            break;
+            return false;
         }
-    }
+
+        if (!fRun || !conn->stream())
+            return false;
+
+    // Keep serving requests that the client pipelined behind this one. When
+    // nothing is buffered, the connection returns to the I/O thread:
+    } while (!fShutdown && conn->has_buffered_input());
+
+    return !fShutdown;
 }
 
 UniValue CRPCTable::execute(const std::string& strMethod, const UniValue& params) const
@@ -908,29 +1294,36 @@ UniValue CRPCTable::execute(const std::string& strMethod, const UniValue& params
     if (!pcmd)
         throw JSONRPCError(RPC_METHOD_NOT_FOUND, "Method not found");
 
-    // Let's add an optional display if BCLog::LogFlags::RPC is set to show how long it takes
-    // the rpc commands to be performed in milliseconds. We will do this only on successful
-    // calls not exceptions.
+    bool limited = false;
+
+    if (!g_rpc_calls.Begin(strMethod, limited))
+        throw JSONRPCError(RPC_SERVER_BUSY, strprintf("Too many concurrent %s calls, retry later", strMethod));
+
+    // Record the duration of every call for getrpcstats. Let's add an optional display
+    // if BCLog::LogFlags::RPC is set to show how long it takes the rpc commands to be
+    // performed in milliseconds. We will do this only on successful calls not exceptions.
+    const int64_t nRPCtimebegin = GetTimeMicros();
+
     try
     {
-        UniValue result(UniValue::VSTR);
+        UniValue result = pcmd->actor(params, false);
 
-        if (LogInstance().WillLogCategory(BCLog::LogFlags::RPC))
-        {
-            int64_t nRPCtimebegin;
-            int64_t nRPCtimetotal;
-            nRPCtimebegin = GetTimeMillis();
-            result = pcmd->actor(params, false);
-            nRPCtimetotal = GetTimeMillis() - nRPCtimebegin;
-            LogPrintf("RPCTime : Command %s -> Totaltime %" PRId64 "ms", strMethod, nRPCtimetotal);
-        }
-        else
-            result = pcmd->actor(params, false);
+        const int64_t nRPCtimetotal = GetTimeMicros() - nRPCtimebegin;
+        g_rpc_calls.End(strMethod, limited, nRPCtimetotal, false);
+
+        LogPrint(BCLog::LogFlags::RPC, "RPCTime : Command %s -> Totaltime %" PRId64 "ms",
+                 strMethod, nRPCtimetotal / 1000);
 
         return result;
     }
+    catch (UniValue& objError)
+    {
+        g_rpc_calls.End(strMethod, limited, GetTimeMicros() - nRPCtimebegin, true);
+        throw;
+    }
     catch (std::exception& e)
     {
+        g_rpc_calls.End(strMethod, limited, GetTimeMicros() - nRPCtimebegin, true);
         throw JSONRPCError(RPC_MISC_ERROR, e.what());
     }
 }
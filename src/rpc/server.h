@@ -16,10 +16,24 @@ class uint256;
 
 #include <univalue.h>
 
+//! Default number of threads that execute RPC requests.
+static const int DEFAULT_RPC_THREADS = 4;
+//! Default number of connections with a pending request that wait for a thread.
+static const int DEFAULT_RPC_WORK_QUEUE = 16;
+//! Default number of seconds that an idle keep-alive connection stays open.
+static const int DEFAULT_RPC_SERVER_TIMEOUT = 30;
+
 void StartRPCThreads();
 void StopRPCThreads();
 int CommandLineRPC(int argc, char *argv[]);
 
+/**
+ * Execute the elements of a JSON-RPC batch request.
+ * @param vReq  Array of request objects.
+ * @returns The serialized array of replies in request order.
+ */
+std::string JSONRPCExecBatch(const UniValue& vReq);
+
 /*
   Type-check arguments; throws JSONRPCError if wrong type given. Does not check that
   the right number of arguments are passed, just that any passed are the correct type.
@@ -197,6 +211,7 @@ extern UniValue beaconaudit(const UniValue& params, bool fHelp);
 extern UniValue currentcontractaverage(const UniValue& params, bool fHelp);
 extern UniValue debug(const UniValue& params, bool fHelp);
 extern UniValue dumpcontracts(const UniValue& params, bool fHelp);
+extern UniValue exportblocks(const UniValue& params, bool fHelp);
 extern UniValue rpc_getblockstats(const UniValue& params, bool fHelp);
 extern UniValue inspectaccrualsnapshot(const UniValue& params, bool fHelp);
 extern UniValue listalerts(const UniValue& params, bool fHelp);
@@ -240,6 +255,8 @@ extern UniValue changesettings(const UniValue& params, bool fHelp);
 extern UniValue clearbanned(const UniValue& params, bool fHelp);
 extern UniValue currenttime(const UniValue& params, bool fHelp);
 extern UniValue getaddednodeinfo(const UniValue& params, bool fHelp);
+extern UniValue getaddressbalance(const UniValue& params, bool fHelp);
+extern UniValue getaddresshistory(const UniValue& params, bool fHelp);
 extern UniValue getnodeaddresses(const UniValue& params, bool fHelp);
 extern UniValue getbestblockhash(const UniValue& params, bool fHelp);
 extern UniValue getblock(const UniValue& params, bool fHelp);
@@ -252,12 +269,15 @@ extern UniValue getblockhash(const UniValue& params, bool fHelp);
 extern UniValue getburnreport(const UniValue& params, bool fHelp);
 extern UniValue getcheckpoint(const UniValue& params, bool fHelp);
 extern UniValue getconnectioncount(const UniValue& params, bool fHelp);
+extern UniValue getcpidhistory(const UniValue& params, bool fHelp);
 extern UniValue getdifficulty(const UniValue& params, bool fHelp);
 extern UniValue getinfo(const UniValue& params, bool fHelp); // To Be Deprecated --> getblockchaininfo getnetworkinfo getwalletinfo
 extern UniValue getnettotals(const UniValue& params, bool fHelp);
 extern UniValue getnetworkinfo(const UniValue& params, bool fHelp);
 extern UniValue getpeerinfo(const UniValue& params, bool fHelp);
 extern UniValue getrawmempool(const UniValue& params, bool fHelp);
+extern UniValue getperfstats(const UniValue& params, bool fHelp);
+extern UniValue getrpcstats(const UniValue& params, bool fHelp);
 extern UniValue listbanned(const UniValue& params, bool fHelp);
 extern UniValue networktime(const UniValue& params, bool fHelp);
 extern UniValue ping(const UniValue& params, bool fHelp);
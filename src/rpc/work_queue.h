@@ -0,0 +1,297 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef GRIDCOIN_RPC_WORK_QUEUE_H
+#define GRIDCOIN_RPC_WORK_QUEUE_H
+
+#include "logging.h"
+#include "rpc/protocol.h"
+#include "rpc/server.h"
+#include "sync.h"
+#include "util/strencodings.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <univalue.h>
+
+//!
+//! \brief Methods that may run for a long time. Each of these shares a capped
+//! number of RPC threads so that they cannot starve short calls.
+//!
+inline constexpr const char* SLOW_RPC_METHODS[] {
+    "auditsnapshotaccrual",
+    "auditsnapshotaccruals",
+    "beaconaudit",
+    "dumpwallet",
+    "exportblocks",
+    "exportstats1",
+    "getaddressbalance",
+    "getaddresshistory",
+    "getblockstats",
+    "getblocksbatch",
+    "getcpidhistory",
+    "getpollresults",
+    "listpolls",
+    "scanforunspent",
+    "superblocks",
+    "votedetails",
+};
+
+//!
+//! \brief Bounded queue of connections that have a request ready to read.
+//!
+//! The I/O thread pushes a connection when its client sends a request. The
+//! RPC worker threads pop connections and execute the requests. When the
+//! queue is full, the server rejects the connection with HTTP 503 instead of
+//! letting requests pile up.
+//!
+class RPCWorkQueue
+{
+public:
+    struct Stats
+    {
+        size_t m_depth = 0;       //!< Connections waiting for a thread.
+        size_t m_max_depth = 0;   //!< Configured capacity.
+        size_t m_peak_depth = 0;  //!< Highest depth observed.
+        uint64_t m_dispatched = 0; //!< Connections handed to a thread.
+        uint64_t m_rejected = 0;   //!< Connections refused because the queue was full.
+    };
+
+    void Start(size_t max_depth)
+    {
+        LOCK(m_mutex);
+        m_max_depth = max_depth;
+        m_running = true;
+    }
+
+    //!
+    //! \brief Add a connection for the next idle thread.
+    //!
+    //! \return \c false when the queue is full or stopped.
+    //!
+    bool Enqueue(std::shared_ptr<AcceptedConnection> conn)
+    {
+        {
+            LOCK(m_mutex);
+
+            if (!m_running || m_queue.size() >= m_max_depth) {
+                ++m_stats.m_rejected;
+                return false;
+            }
+
+            m_queue.push_back(std::move(conn));
+            m_stats.m_peak_depth = std::max(m_stats.m_peak_depth, m_queue.size());
+        }
+
+        m_cond.notify_one();
+
+        return true;
+    }
+
+    //!
+    //! \brief Wait for the next connection.
+    //!
+    //! \return The connection, or \c nullptr after \c Interrupt().
+    //!
+    std::shared_ptr<AcceptedConnection> Dequeue()
+    {
+        WAIT_LOCK(m_mutex, lock);
+
+        m_cond.wait(lock, [this]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return !m_running || !m_queue.empty(); });
+
+        if (!m_running) {
+            return nullptr;
+        }
+
+        std::shared_ptr<AcceptedConnection> conn = std::move(m_queue.front());
+        m_queue.pop_front();
+        ++m_stats.m_dispatched;
+
+        return conn;
+    }
+
+    void Interrupt()
+    {
+        {
+            LOCK(m_mutex);
+            m_running = false;
+        }
+
+        m_cond.notify_all();
+    }
+
+    void Clear()
+    {
+        LOCK(m_mutex);
+        m_queue.clear();
+    }
+
+    Stats GetStats() const
+    {
+        LOCK(m_mutex);
+
+        Stats stats = m_stats;
+        stats.m_depth = m_queue.size();
+        stats.m_max_depth = m_max_depth;
+
+        return stats;
+    }
+
+private:
+    mutable Mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<std::shared_ptr<AcceptedConnection>> m_queue GUARDED_BY(m_mutex);
+    size_t m_max_depth GUARDED_BY(m_mutex) = DEFAULT_RPC_WORK_QUEUE;
+    bool m_running GUARDED_BY(m_mutex) = false;
+    Stats m_stats GUARDED_BY(m_mutex);
+};
+
+//!
+//! \brief Records per-method call statistics and enforces the concurrency
+//! limits of slow methods.
+//!
+class RPCCallTracker
+{
+public:
+    struct MethodStats
+    {
+        uint64_t m_calls = 0;    //!< Completed calls.
+        uint64_t m_errors = 0;   //!< Completed calls that returned an error.
+        uint64_t m_rejected = 0; //!< Calls refused at the concurrency limit.
+        int m_active = 0;        //!< Calls in progress.
+        int m_limit = 0;         //!< Maximum concurrent calls or 0 for no limit.
+        int64_t m_total_us = 0;  //!< Sum of the call durations.
+        int64_t m_max_us = 0;    //!< Longest call duration.
+    };
+
+    //!
+    //! \brief Set the concurrency limits for the configured thread count.
+    //!
+    //! Each slow method may use half of the threads, and all limited methods
+    //! together may use all but one thread.
+    //!
+    //! \param threads   Number of RPC worker threads.
+    //! \param overrides Entries of the form \c <method>:<n> from -rpcmethodlimit.
+    //! A limit of zero removes the limit of a method.
+    //!
+    void Configure(const int threads, const std::vector<std::string>& overrides)
+    {
+        LOCK(m_mutex);
+
+        m_limited_capacity = std::max(1, threads - 1);
+
+        for (const auto& method : SLOW_RPC_METHODS) {
+            if (tableRPC[method]) {
+                m_methods[method].m_limit = std::max(1, threads / 2);
+            }
+        }
+
+        for (const auto& entry : overrides) {
+            const size_t separator = entry.rfind(':');
+            int limit = 0;
+
+            if (separator == std::string::npos
+                || !ParseInt32(entry.substr(separator + 1), &limit)
+                || limit < 0
+                || !tableRPC[entry.substr(0, separator)])
+            {
+                LogPrintf("WARNING: %s: ignoring invalid -rpcmethodlimit=%s", __func__, entry);
+                continue;
+            }
+
+            m_methods[entry.substr(0, separator)].m_limit = limit;
+        }
+    }
+
+    //!
+    //! \brief Register the start of a call.
+    //!
+    //! \param method  Name of a registered method.
+    //! \param limited Set to \c true when the call counts against the shared
+    //! capacity of the limited methods. Pass the value to \c End().
+    //!
+    //! \return \c false when the method reached its concurrency limit.
+    //!
+    bool Begin(const std::string& method, bool& limited)
+    {
+        LOCK(m_mutex);
+
+        MethodStats& stats = m_methods[method];
+        limited = stats.m_limit > 0;
+
+        if (limited) {
+            if (stats.m_active >= stats.m_limit || m_limited_active >= m_limited_capacity) {
+                ++stats.m_rejected;
+                return false;
+            }
+
+            ++m_limited_active;
+        }
+
+        ++stats.m_active;
+
+        return true;
+    }
+
+    void End(const std::string& method, const bool limited, const int64_t elapsed_us, const bool error)
+    {
+        LOCK(m_mutex);
+
+        MethodStats& stats = m_methods[method];
+
+        --stats.m_active;
+        ++stats.m_calls;
+        stats.m_errors += error;
+        stats.m_total_us += elapsed_us;
+        stats.m_max_us = std::max(stats.m_max_us, elapsed_us);
+
+        if (limited) {
+            --m_limited_active;
+        }
+    }
+
+    UniValue ToJson() const
+    {
+        LOCK(m_mutex);
+
+        UniValue json(UniValue::VOBJ);
+        UniValue methods(UniValue::VOBJ);
+
+        for (const auto& [name, stats] : m_methods) {
+            UniValue method(UniValue::VOBJ);
+
+            method.pushKV("calls", stats.m_calls);
+            method.pushKV("errors", stats.m_errors);
+            method.pushKV("rejected", stats.m_rejected);
+            method.pushKV("active", stats.m_active);
+            method.pushKV("limit", stats.m_limit);
+            method.pushKV("total_ms", stats.m_total_us / 1000.0);
+            method.pushKV("avg_ms", stats.m_calls > 0 ? stats.m_total_us / 1000.0 / stats.m_calls : 0.0);
+            method.pushKV("max_ms", stats.m_max_us / 1000.0);
+
+            methods.pushKV(name, method);
+        }
+
+        json.pushKV("limited_active", m_limited_active);
+        json.pushKV("limited_capacity", m_limited_capacity);
+        json.pushKV("methods", methods);
+
+        return json;
+    }
+
+private:
+    mutable Mutex m_mutex;
+    std::map<std::string, MethodStats> m_methods GUARDED_BY(m_mutex);
+    int m_limited_active GUARDED_BY(m_mutex) = 0;
+    int m_limited_capacity GUARDED_BY(m_mutex) = std::numeric_limits<int>::max();
+};
+
+#endif // GRIDCOIN_RPC_WORK_QUEUE_H
@@ -7,7 +7,9 @@
 #define BITCOIN_SYNC_H
 
 #include "threadsafety.h"
+#include "util/perfstats.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <string>
@@ -110,6 +112,25 @@ public:
     }
 
     using UniqueLock = std::unique_lock<PARENT>;
+
+    //! Get the name that lock statistics are kept under, or nullptr when the
+    //! mutex is not profiled.
+    const char* ProfileName() const
+    {
+        return m_profile_name.load(std::memory_order_relaxed);
+    }
+
+    //! Record wait and hold times of LOCK() call sites for this mutex. The name
+    //! must outlive the process.
+    void EnableProfiling(const char* name)
+    {
+        m_profile_name.store(name, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<const char*> m_profile_name{nullptr};
+
+public:
 #ifdef __clang__
     //! For negative capabilities in the Clang Thread Safety Analysis.
     //! A negative requirement uses the EXCLUSIVE_LOCKS_REQUIRED attribute, in conjunction
@@ -144,9 +165,32 @@ template <typename Mutex, typename Base = typename Mutex::UniqueLock>
 class SCOPED_LOCKABLE UniqueLock : public Base
 {
 private:
+    LockProfileSite* m_profile_site = nullptr; //!< Set for a profiled mutex.
+    int64_t m_profile_acquired = 0;            //!< When the lock was taken.
+
+    const char* ProfileName()
+    {
+        return static_cast<Mutex*>(Base::mutex())->ProfileName();
+    }
+
     void Enter(const char* pszName, const char* pszFile, int nLine)
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(Base::mutex()));
+
+        if (const char* profile_name = ProfileName()) {
+            const int64_t start = PerfNowNanos();
+            const bool contended = !Base::try_lock();
+
+            if (contended) {
+                Base::lock();
+            }
+
+            m_profile_acquired = PerfNowNanos();
+            m_profile_site = LockProfileSite::Get(profile_name, pszFile, nLine);
+            m_profile_site->RecordAcquire(contended, m_profile_acquired - start);
+
+            return;
+        }
 #ifdef DEBUG_LOCKCONTENTION
         if (!Base::try_lock()) {
             PrintLockContention(pszName, pszFile, nLine);
@@ -161,12 +205,24 @@ private:
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(Base::mutex()), true);
         if (Base::try_lock()) {
+            if (const char* profile_name = ProfileName()) {
+                m_profile_acquired = PerfNowNanos();
+                m_profile_site = LockProfileSite::Get(profile_name, pszFile, nLine);
+                m_profile_site->RecordAcquire(false, 0);
+            }
             return true;
         }
         LeaveCritical();
         return false;
     }
 
+    void RecordProfileHold()
+    {
+        if (m_profile_site && Base::owns_lock()) {
+            m_profile_site->RecordHold(PerfNowNanos() - m_profile_acquired);
+        }
+    }
+
 public:
     UniqueLock(Mutex& mutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(mutexIn) : Base(mutexIn, std::defer_lock)
     {
@@ -189,6 +245,8 @@ public:
 
     ~UniqueLock() UNLOCK_FUNCTION()
     {
+        RecordProfileHold();
+
         if (Base::owns_lock())
             LeaveCritical();
     }
@@ -210,6 +268,7 @@ public:
     public:
         explicit reverse_lock(UniqueLock& _lock, const char* _guardname, const char* _file, int _line) : lock(_lock), file(_file), line(_line) {
             CheckLastCritical((void*)lock.mutex(), lockname, _guardname, _file, _line);
+            lock.RecordProfileHold();
             lock.unlock();
             LeaveCritical();
             lock.swap(templock);
@@ -219,6 +278,7 @@ public:
             templock.swap(lock);
             EnterCritical(lockname.c_str(), file.c_str(), line, (void*)lock.mutex());
             lock.lock();
+            lock.m_profile_acquired = PerfNowNanos();
         }
 
      private:
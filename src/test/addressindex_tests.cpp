@@ -0,0 +1,188 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "clientversion.h"
+#include "index/addressindex.h"
+#include "main.h"
+#include "streams.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+
+namespace {
+
+std::string SerializeKey(const AddressIndex::AddressKey& key)
+{
+    CDataStream stream(SER_DISK, CLIENT_VERSION);
+    stream << std::make_pair(AddressIndex::ADDRESS_KEY_TYPE, key);
+
+    return stream.str();
+}
+
+uint160 TestHash(const uint8_t n)
+{
+    return uint160(std::vector<unsigned char>(20, n));
+}
+
+CScript ScriptFor(const CTxDestination& dest)
+{
+    CScript script;
+    script.SetDestination(dest);
+
+    return script;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(addressindex_tests)
+
+// ---------------------------------------------------------------------------
+// Key layout
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(address_keys_sort_in_chain_order)
+{
+    AddressIndex::AddressKey key;
+    key.m_hash = TestHash(1);
+
+    std::vector<std::string> serialized;
+
+    for (const int height : {1, 255, 256, 65536, 1000000}) {
+        key.m_height = height;
+        serialized.push_back(SerializeKey(key));
+    }
+
+    BOOST_CHECK(std::is_sorted(serialized.begin(), serialized.end()));
+
+    // Transactions later in the same block sort after earlier ones:
+    key.m_tx_position = 256;
+    const std::string later = SerializeKey(key);
+    key.m_tx_position = 1;
+    BOOST_CHECK(SerializeKey(key) < later);
+}
+
+BOOST_AUTO_TEST_CASE(address_scan_prefix_matches_row_keys)
+{
+    AddressIndex::AddressKey key;
+    key.m_type = AddressIndex::AddressType::SCRIPT_HASH;
+    key.m_hash = TestHash(42);
+    key.m_height = 12345;
+    key.m_txid = uint256(7);
+
+    CDataStream prefix(SER_DISK, CLIENT_VERSION);
+    prefix << std::make_pair(
+        AddressIndex::ADDRESS_KEY_TYPE,
+        std::make_pair(static_cast<uint8_t>(key.m_type), key.m_hash));
+
+    BOOST_CHECK_EQUAL(SerializeKey(key).rfind(prefix.str(), 0), 0u);
+
+    // A different destination does not share the prefix:
+    key.m_hash = TestHash(43);
+    BOOST_CHECK(SerializeKey(key).rfind(prefix.str(), 0) != 0u);
+}
+
+BOOST_AUTO_TEST_CASE(address_key_round_trips)
+{
+    AddressIndex::AddressKey key;
+    key.m_type = AddressIndex::AddressType::SCRIPT_HASH;
+    key.m_hash = TestHash(9);
+    key.m_height = 2500000;
+    key.m_tx_position = 3;
+    key.m_txid = uint256(11);
+    key.m_index = 4;
+    key.m_spending = true;
+
+    CDataStream stream(SER_DISK, CLIENT_VERSION);
+    stream << key;
+
+    AddressIndex::AddressKey decoded;
+    stream >> decoded;
+
+    BOOST_CHECK(decoded.m_type == key.m_type);
+    BOOST_CHECK(decoded.m_hash == key.m_hash);
+    BOOST_CHECK_EQUAL(decoded.m_height, key.m_height);
+    BOOST_CHECK_EQUAL(decoded.m_tx_position, key.m_tx_position);
+    BOOST_CHECK(decoded.m_txid == key.m_txid);
+    BOOST_CHECK_EQUAL(decoded.m_index, key.m_index);
+    BOOST_CHECK(decoded.m_spending);
+}
+
+// ---------------------------------------------------------------------------
+// Row building
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(build_rows_for_outputs_and_spends)
+{
+    const CKeyID key_id(TestHash(5));
+    const CScriptID script_id(CScript() << OP_TRUE);
+
+    CBlock block;
+
+    CTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].prevout.SetNull();
+    coinbase.vout.emplace_back(5 * COIN, ScriptFor(key_id));
+    block.vtx.push_back(coinbase);
+
+    CTransaction spend;
+    spend.vin.emplace_back(COutPoint(uint256(1), 0));
+    spend.vin.emplace_back(COutPoint(uint256(2), 0));
+    spend.vout.emplace_back(2 * COIN, ScriptFor(script_id));
+    spend.vout.emplace_back(0, CScript() << OP_RETURN);
+    block.vtx.push_back(spend);
+
+    // The second spent output is not standard and has no address row:
+    const std::vector<std::vector<CTxOut>> spent_outputs {
+        { },
+        { CTxOut(3 * COIN, ScriptFor(key_id)), CTxOut(1 * COIN, CScript() << OP_TRUE) },
+    };
+
+    CBlockIndex index;
+    index.nHeight = 10;
+
+    const AddressIndex::BlockRows rows = AddressIndex::BuildRows(
+        block, &index, spent_outputs, AddressIndex::ADDRESSES | AddressIndex::CPIDS);
+
+    BOOST_REQUIRE_EQUAL(rows.m_addresses.size(), 3u);
+    BOOST_CHECK(rows.m_cpids.empty());
+
+    BOOST_CHECK(rows.m_addresses[0].m_key.m_hash == key_id);
+    BOOST_CHECK_EQUAL(rows.m_addresses[0].m_key.m_tx_position, 0u);
+    BOOST_CHECK(!rows.m_addresses[0].m_key.m_spending);
+    BOOST_CHECK_EQUAL(rows.m_addresses[0].m_delta, 5 * COIN);
+
+    BOOST_CHECK(rows.m_addresses[1].m_key.m_hash == key_id);
+    BOOST_CHECK(rows.m_addresses[1].m_key.m_txid == spend.GetHash());
+    BOOST_CHECK_EQUAL(rows.m_addresses[1].m_key.m_index, 0u);
+    BOOST_CHECK(rows.m_addresses[1].m_key.m_spending);
+    BOOST_CHECK_EQUAL(rows.m_addresses[1].m_delta, -3 * COIN);
+
+    BOOST_CHECK(rows.m_addresses[2].m_key.m_type == AddressIndex::AddressType::SCRIPT_HASH);
+    BOOST_CHECK_EQUAL(rows.m_addresses[2].m_key.m_height, 10);
+    BOOST_CHECK_EQUAL(rows.m_addresses[2].m_delta, 2 * COIN);
+
+    for (const auto& row : rows.m_addresses) {
+        BOOST_CHECK_EQUAL(row.m_key.m_height, 10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(build_rows_skips_disabled_components)
+{
+    CBlock block;
+    CTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].prevout.SetNull();
+    coinbase.vout.emplace_back(5 * COIN, ScriptFor(CKeyID(TestHash(5))));
+    block.vtx.push_back(coinbase);
+
+    CBlockIndex index;
+
+    const AddressIndex::BlockRows rows = AddressIndex::BuildRows(block, &index, {}, AddressIndex::CPIDS);
+
+    BOOST_CHECK(rows.m_addresses.empty());
+    BOOST_CHECK(rows.m_cpids.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 #include "hash.h"
 #include "netbase.h"
 #include "random.h"
+#include "streams.h"
 
 using namespace std;
 
@@ -545,4 +546,84 @@ BOOST_AUTO_TEST_CASE(caddrinfo_get_new_bucket)
     BOOST_CHECK(buckets.size() > 64);
 }
 
+BOOST_AUTO_TEST_CASE(addrman_delete_reuses_slots)
+{
+    CAddrManTest addrman;
+
+    // Set addrman addr placement to be deterministic.
+    addrman.MakeDeterministic();
+
+    CNetAddr source = ResolveIP("250.1.2.1");
+    std::vector<CAddress> vAddr;
+    std::vector<int> vId;
+
+    for (int i = 0; i < 1000; i++) {
+        CAddress addr = CAddress(ResolveService("250." + boost::to_string(i / 256) + "." + boost::to_string(i % 256) + ".1", 8333), NODE_NONE);
+        int nId;
+        addrman.Create(addr, source, &nId);
+        vAddr.push_back(addr);
+        vId.push_back(nId);
+    }
+
+    for (int i = 0; i < 1000; i += 2) {
+        addrman.Delete(vId[i]);
+    }
+
+    // Test 35: Deleting entries keeps the others reachable by address.
+    BOOST_CHECK(addrman.size() == 500);
+    for (int i = 0; i < 1000; i++) {
+        int nId = -1;
+        CAddrInfo* pinfo = addrman.Find(vAddr[i], &nId);
+        if (i % 2 == 0) {
+            BOOST_CHECK(pinfo == NULL);
+        } else {
+            BOOST_REQUIRE(pinfo != NULL);
+            BOOST_CHECK(nId == vId[i]);
+            BOOST_CHECK(pinfo->ToString() == vAddr[i].ToString());
+        }
+    }
+
+    // Test 36: New entries take the slots of the deleted ones.
+    int nId;
+    addrman.Create(vAddr[0], source, &nId);
+    BOOST_CHECK(nId < 1000);
+    BOOST_CHECK(addrman.Find(vAddr[0]) != NULL);
+}
+
+BOOST_AUTO_TEST_CASE(addrman_serialize_roundtrip)
+{
+    CAddrManTest addrman;
+
+    // Set addrman addr placement to be deterministic.
+    addrman.MakeDeterministic();
+
+    for (unsigned int i = 1; i < 1000; i++) {
+        string strAddr = boost::to_string(i % 256) + "." + boost::to_string(i / 256) + ".1.23";
+        CAddress addr = CAddress(ResolveService(strAddr), NODE_NONE);
+        addr.nTime = GetAdjustedTime();
+        addrman.Add(addr, ResolveIP("250.1.2." + boost::to_string(i % 7)));
+        if (i % 5 == 0)
+            addrman.Good(addr);
+    }
+
+    CDataStream ssPeers1(SER_DISK, PROTOCOL_VERSION);
+    ssPeers1 << addrman;
+
+    CAddrManTest addrman2;
+    CDataStream ssCopy(ssPeers1);
+    ssCopy >> addrman2;
+
+    // Test 37: A reloaded address manager holds the same entries.
+    BOOST_CHECK(addrman2.size() == addrman.size());
+    for (unsigned int i = 1; i < 1000; i++) {
+        string strAddr = boost::to_string(i % 256) + "." + boost::to_string(i / 256) + ".1.23";
+        BOOST_CHECK((addrman.Find(ResolveIP(strAddr)) == NULL) == (addrman2.Find(ResolveIP(strAddr)) == NULL));
+    }
+
+    // Test 38: Serializing it again yields the same peers.dat bytes.
+    CDataStream ssPeers2(SER_DISK, PROTOCOL_VERSION);
+    ssPeers2 << addrman2;
+    BOOST_CHECK(ssPeers1.str() == ssPeers2.str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
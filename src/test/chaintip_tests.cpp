@@ -0,0 +1,94 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "main.h"
+#include "node/chaintip.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+
+namespace {
+//!
+//! \brief Links a few block index entries into a chain for the snapshot.
+//!
+struct ChainFixture
+{
+    std::array<uint256, 3> hashes;
+    std::array<CBlockIndex, 3> blocks;
+
+    ChainFixture()
+    {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            hashes[i] = uint256{static_cast<uint8_t>(i + 1)};
+            blocks[i].SetNull();
+            blocks[i].phashBlock = &hashes[i];
+            blocks[i].nHeight = static_cast<int>(i);
+
+            if (i > 0) {
+                blocks[i].pprev = &blocks[i - 1];
+                blocks[i - 1].pnext = &blocks[i];
+            }
+        }
+    }
+
+    ~ChainFixture()
+    {
+        LOCK(cs_main);
+
+        pindexBest = nullptr;
+        PublishChainTip();
+    }
+};
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(chaintip_tests)
+
+BOOST_AUTO_TEST_CASE(snapshot_is_empty_before_the_index_loads)
+{
+    {
+        LOCK(cs_main);
+
+        pindexBest = nullptr;
+        PublishChainTip();
+    }
+
+    const std::shared_ptr<const ChainTip> tip = GetChainTip();
+
+    BOOST_REQUIRE(tip != nullptr);
+    BOOST_CHECK(tip->m_index == nullptr);
+    BOOST_CHECK_EQUAL(tip->m_height, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(snapshot_holds_the_published_tip, ChainFixture)
+{
+    {
+        LOCK(cs_main);
+
+        pindexBest = &blocks[1];
+        PublishChainTip();
+    }
+
+    const std::shared_ptr<const ChainTip> before = GetChainTip();
+
+    // A reader keeps a stable view while the tip moves:
+    {
+        LOCK(cs_main);
+
+        pindexBest = &blocks[2];
+        PublishChainTip();
+    }
+
+    BOOST_CHECK_EQUAL(before->m_index, &blocks[1]);
+    BOOST_CHECK_EQUAL(before->m_height, 1);
+    BOOST_CHECK(before->m_hash == hashes[1]);
+
+    const std::shared_ptr<const ChainTip> after = GetChainTip();
+
+    BOOST_CHECK_EQUAL(after->m_index, &blocks[2]);
+    BOOST_CHECK_EQUAL(after->m_height, 2);
+    BOOST_CHECK(after->m_hash == hashes[2]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,17 +12,12 @@
 #include "util.h"
 #include "random.h"
 #include "banman.h"
+#include "node/orphan_txs.h"
 
 #include <test/test_gridcoin.h>
 
 #include <stdint.h>
 
-// Tests this internal-to-main.cpp method:
-extern bool AddOrphanTx(const CTransaction& tx);
-extern unsigned int LimitOrphanTxSize(unsigned int nMaxOrphans);
-extern std::map<uint256, CTransaction> mapOrphanTransactions;
-extern std::map<uint256, std::set<uint256> > mapOrphanTransactionsByPrev;
-
 CService ip(uint32_t i)
 {
     struct in_addr s;
@@ -124,12 +119,9 @@ BOOST_AUTO_TEST_CASE(DoS_misbehavior_decay)
     BOOST_CHECK(nodestats.nMisbehavior == 0); // nMisbehavior should be 0.
 }
 
-CTransaction RandomOrphan()
+CTransaction RandomOrphan(const std::vector<CTransaction>& orphans)
 {
-    auto it = mapOrphanTransactions.lower_bound(InsecureRand256());
-    if (it == mapOrphanTransactions.end())
-        it = mapOrphanTransactions.begin();
-    return it->second;
+    return orphans[InsecureRandRange(orphans.size())];
 }
 
 BOOST_AUTO_TEST_CASE(DoS_mapOrphans)
@@ -139,6 +131,9 @@ BOOST_AUTO_TEST_CASE(DoS_mapOrphans)
     CBasicKeyStore keystore;
     BOOST_CHECK(keystore.AddKey(key));
 
+    OrphanTxManager orphan_txs;
+    std::vector<CTransaction> orphans;
+
     // 50 orphan transactions:
     for (int i = 0; i < 50; i++)
     {
@@ -150,13 +145,14 @@ BOOST_AUTO_TEST_CASE(DoS_mapOrphans)
         tx.vout.resize(1);
         tx.vout[0].nValue = 1*CENT;
         tx.vout[0].scriptPubKey.SetDestination(key.GetPubKey().GetID());
-        AddOrphanTx(tx);
+        BOOST_CHECK(orphan_txs.Add(tx, 0, 1000));
+        orphans.push_back(tx);
     }
 
     // ... and 50 that depend on other orphans:
     for (int i = 0; i < 50; i++)
     {
-        CTransaction txPrev = RandomOrphan();
+        CTransaction txPrev = RandomOrphan(orphans);
 
         CTransaction tx;
         tx.vin.resize(1);
@@ -166,13 +162,14 @@ BOOST_AUTO_TEST_CASE(DoS_mapOrphans)
         tx.vout[0].nValue = 1*CENT;
         tx.vout[0].scriptPubKey.SetDestination(key.GetPubKey().GetID());
         BOOST_CHECK(SignSignature(keystore, txPrev, tx, 0));
-        AddOrphanTx(tx);
+        if (orphan_txs.Add(tx, 0, 1000))
+            orphans.push_back(tx);
     }
 
     // This really-big orphan should be ignored:
     for (int i = 0; i < 10; i++)
     {
-        CTransaction txPrev = RandomOrphan();
+        CTransaction txPrev = RandomOrphan(orphans);
 
         CTransaction tx;
         tx.vout.resize(1);
@@ -190,17 +187,17 @@ BOOST_AUTO_TEST_CASE(DoS_mapOrphans)
         for (unsigned int j = 1; j < tx.vin.size(); j++)
             tx.vin[j].scriptSig = tx.vin[0].scriptSig;
 
-        BOOST_CHECK(!AddOrphanTx(tx));
+        BOOST_CHECK(!orphan_txs.Add(tx, 0, 1000));
     }
 
-    // Test LimitOrphanTxSize() function:
-    LimitOrphanTxSize(40);
-    BOOST_CHECK(mapOrphanTransactions.size() <= 40);
-    LimitOrphanTxSize(10);
-    BOOST_CHECK(mapOrphanTransactions.size() <= 10);
-    LimitOrphanTxSize(0);
-    BOOST_CHECK(mapOrphanTransactions.empty());
-    BOOST_CHECK(mapOrphanTransactionsByPrev.empty());
+    // Test OrphanTxManager::LimitSize() function:
+    orphan_txs.LimitSize(40);
+    BOOST_CHECK(orphan_txs.Size() <= 40);
+    orphan_txs.LimitSize(10);
+    BOOST_CHECK(orphan_txs.Size() <= 10);
+    orphan_txs.LimitSize(0);
+    BOOST_CHECK_EQUAL(orphan_txs.Size(), 0u);
+    BOOST_CHECK_EQUAL(orphan_txs.Bytes(), 0u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
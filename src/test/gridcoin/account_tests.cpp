@@ -0,0 +1,137 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include "main.h"
+#include "gridcoin/account.h"
+#include "gridcoin/cpid.h"
+
+#include <vector>
+
+namespace {
+//!
+//! \brief Create a CPID with every byte set to the specified value.
+//!
+GRC::Cpid MakeCpid(const unsigned char value)
+{
+    return GRC::Cpid(std::vector<unsigned char>(16, value));
+}
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(ResearchAccountMap)
+
+BOOST_AUTO_TEST_CASE(it_initializes_to_an_empty_map)
+{
+    const GRC::ResearchAccountMap accounts;
+
+    BOOST_CHECK(accounts.empty());
+    BOOST_CHECK_EQUAL(accounts.size(), 0);
+    BOOST_CHECK(accounts.begin() == accounts.end());
+    BOOST_CHECK(accounts.find(MakeCpid(0x01)) == accounts.end());
+    BOOST_CHECK_EQUAL(accounts.count(MakeCpid(0x01)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(it_creates_accounts_on_access)
+{
+    GRC::ResearchAccountMap accounts;
+
+    accounts[MakeCpid(0x01)].m_accrual = 123;
+    accounts[MakeCpid(0x02)].m_accrual = 456;
+    accounts[MakeCpid(0x01)].m_total_research_subsidy = 789;
+
+    BOOST_CHECK_EQUAL(accounts.size(), 2);
+    BOOST_CHECK_EQUAL(accounts.count(MakeCpid(0x01)), 1);
+
+    const auto iter = accounts.find(MakeCpid(0x01));
+
+    BOOST_REQUIRE(iter != accounts.end());
+    BOOST_CHECK(iter->first == MakeCpid(0x01));
+    BOOST_CHECK_EQUAL(iter->second.m_accrual, 123);
+    BOOST_CHECK_EQUAL(iter->second.m_total_research_subsidy, 789);
+}
+
+BOOST_AUTO_TEST_CASE(it_iterates_over_accounts_in_insertion_order)
+{
+    GRC::ResearchAccountMap accounts;
+
+    accounts[MakeCpid(0x03)];
+    accounts[MakeCpid(0x01)];
+    accounts[MakeCpid(0x02)];
+
+    std::vector<GRC::Cpid> cpids;
+
+    for (const auto& account_pair : accounts) {
+        cpids.push_back(account_pair.first);
+    }
+
+    BOOST_REQUIRE_EQUAL(cpids.size(), 3);
+    BOOST_CHECK(cpids[0] == MakeCpid(0x03));
+    BOOST_CHECK(cpids[1] == MakeCpid(0x01));
+    BOOST_CHECK(cpids[2] == MakeCpid(0x02));
+}
+
+BOOST_AUTO_TEST_CASE(it_erases_an_account_and_keeps_the_others_reachable)
+{
+    GRC::ResearchAccountMap accounts;
+
+    accounts[MakeCpid(0x01)].m_accrual = 1;
+    accounts[MakeCpid(0x02)].m_accrual = 2;
+    accounts[MakeCpid(0x03)].m_accrual = 3;
+
+    BOOST_CHECK_EQUAL(accounts.erase(MakeCpid(0x01)), 1);
+    BOOST_CHECK_EQUAL(accounts.erase(MakeCpid(0x01)), 0);
+
+    BOOST_CHECK_EQUAL(accounts.size(), 2);
+    BOOST_CHECK(accounts.find(MakeCpid(0x01)) == accounts.end());
+    BOOST_REQUIRE(accounts.find(MakeCpid(0x02)) != accounts.end());
+    BOOST_REQUIRE(accounts.find(MakeCpid(0x03)) != accounts.end());
+    BOOST_CHECK_EQUAL(accounts.find(MakeCpid(0x02))->second.m_accrual, 2);
+    BOOST_CHECK_EQUAL(accounts.find(MakeCpid(0x03))->second.m_accrual, 3);
+
+    BOOST_CHECK_EQUAL(accounts.erase(MakeCpid(0x03)), 1);
+
+    BOOST_CHECK_EQUAL(accounts.size(), 1);
+    BOOST_CHECK_EQUAL(accounts.find(MakeCpid(0x02))->second.m_accrual, 2);
+}
+
+BOOST_AUTO_TEST_CASE(it_removes_every_account)
+{
+    GRC::ResearchAccountMap accounts;
+
+    accounts[MakeCpid(0x01)];
+    accounts[MakeCpid(0x02)];
+    accounts.clear();
+
+    BOOST_CHECK(accounts.empty());
+    BOOST_CHECK(accounts.find(MakeCpid(0x01)) == accounts.end());
+
+    accounts[MakeCpid(0x02)].m_accrual = 2;
+
+    BOOST_CHECK_EQUAL(accounts.size(), 1);
+    BOOST_CHECK_EQUAL(accounts.find(MakeCpid(0x02))->second.m_accrual, 2);
+}
+
+BOOST_AUTO_TEST_CASE(it_sums_accrual_and_research_subsidy)
+{
+    GRC::ResearchAccountMap accounts;
+
+    BOOST_CHECK_EQUAL(accounts.TotalAccrual(), 0);
+    BOOST_CHECK_EQUAL(accounts.TotalResearchSubsidy(), 0);
+
+    accounts[MakeCpid(0x01)].m_accrual = 100;
+    accounts[MakeCpid(0x01)].m_total_research_subsidy = 1000;
+    accounts[MakeCpid(0x02)].m_accrual = 200;
+    accounts[MakeCpid(0x02)].m_total_research_subsidy = 2000;
+
+    BOOST_CHECK_EQUAL(accounts.TotalAccrual(), 300);
+    BOOST_CHECK_EQUAL(accounts.TotalResearchSubsidy(), 3000);
+
+    const GRC::ResearchAccountRange range(accounts);
+
+    BOOST_CHECK_EQUAL(range.TotalAccrual(), 300);
+    BOOST_CHECK_EQUAL(range.TotalResearchSubsidy(), 3000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,149 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <main.h>
+#include <chainparams.h>
+#include <gridcoin/account.h>
+#include <gridcoin/cpid.h>
+#include <gridcoin/superblock.h>
+#include <gridcoin/tally.h>
+#include <test/test_gridcoin.h>
+
+#include <array>
+#include <map>
+
+namespace {
+//!
+//! \brief A short mock chain with a research account that staked the first
+//! block.
+//!
+//! The snapshot accrual computer adds the pending accrual of an account only
+//! when its last reward block is lower than the current superblock. Without
+//! a superblock, that means a block below height zero, so the chain starts at
+//! height -1.
+//!
+struct AccrualSetup
+{
+    std::array<CBlockIndex, 3> blocks;
+    CBlockIndex* const saved_best = pindexBest;
+    const GRC::Cpid cpid = GRC::Cpid(InsecureRandBytes(16));
+    GRC::ResearchAccount& account = GRC::Tally::CreateAccount(cpid);
+
+    AccrualSetup()
+    {
+        SelectParams(CBaseChainParams::MAIN);
+
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            blocks[i].nVersion = 12;
+            blocks[i].nHeight = static_cast<int>(i) - 1;
+            blocks[i].nTime = 1000000 + i * 24 * 60 * 60;
+
+            if (i > 0) {
+                blocks[i].pprev = &blocks[i - 1];
+                blocks[i - 1].pnext = &blocks[i];
+            }
+        }
+
+        blocks[0].SetResearcherContext(cpid, 10 * COIN, 0.0);
+        blocks[1].SetResearcherContext(cpid, 10 * COIN, 0.0);
+
+        account.m_first_block_ptr = &blocks[0];
+        account.m_last_block_ptr = &blocks[0];
+        account.m_total_research_subsidy = 10 * COIN;
+        account.m_accrual = 72;
+
+        pindexBest = &blocks.back();
+    }
+
+    ~AccrualSetup()
+    {
+        GRC::Tally::RemoveAccount(cpid);
+        pindexBest = saved_best;
+    }
+
+    CAmount GetAccrual() const
+    {
+        return GRC::Tally::GetAccrual(cpid, blocks[2].nTime, &blocks[2]);
+    }
+};
+} // Anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(accrual_tests, AccrualSetup)
+
+BOOST_AUTO_TEST_CASE(it_recalculates_accruals_when_the_tip_changes)
+{
+    LOCK(cs_main);
+
+    pindexBest = &blocks[1];
+
+    BOOST_CHECK_EQUAL(GetAccrual(), 72);
+
+    // Stands in for a change that the tally does not see, like a contract
+    // in a connected block:
+    account.m_accrual = 100;
+    pindexBest = &blocks[2];
+
+    BOOST_CHECK_EQUAL(GetAccrual(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(it_recalculates_accruals_after_recording_a_reward_block)
+{
+    LOCK(cs_main);
+
+    BOOST_CHECK_EQUAL(GetAccrual(), 72);
+
+    // A reward at or above the current superblock drops the pending accrual:
+    GRC::Tally::RecordRewardBlock(&blocks[1]);
+
+    BOOST_CHECK(account.m_last_block_ptr == &blocks[1]);
+    BOOST_CHECK_EQUAL(GetAccrual(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(it_recalculates_accruals_after_forgetting_a_reward_block)
+{
+    LOCK(cs_main);
+
+    GRC::Tally::RecordRewardBlock(&blocks[1]);
+
+    BOOST_CHECK_EQUAL(GetAccrual(), 0);
+
+    GRC::Tally::ForgetRewardBlock(&blocks[1]);
+
+    BOOST_CHECK(account.m_last_block_ptr == &blocks[0]);
+    BOOST_CHECK_EQUAL(GetAccrual(), 72);
+}
+
+BOOST_AUTO_TEST_CASE(it_recalculates_accruals_after_applying_and_reverting_a_superblock)
+{
+    LOCK(cs_main);
+
+    BOOST_CHECK_EQUAL(GetAccrual(), 72);
+
+    // Version 1 superblocks do not touch the accrual snapshots on disk, so
+    // change the account like the snapshot tally would:
+    account.m_accrual = 100;
+
+    BOOST_CHECK(GRC::Tally::ApplySuperblock(GRC::SuperblockPtr::BindShared(GRC::Superblock(1), &blocks[2])));
+    BOOST_CHECK_EQUAL(GetAccrual(), 100);
+
+    account.m_accrual = 72;
+
+    BOOST_CHECK(GRC::Tally::RevertSuperblock());
+    BOOST_CHECK_EQUAL(GetAccrual(), 72);
+}
+
+BOOST_AUTO_TEST_CASE(it_calculates_the_accruals_of_every_account_like_one_account)
+{
+    LOCK(cs_main);
+
+    const std::map<GRC::Cpid, CAmount> accruals = GRC::Tally::GetAccruals(blocks[2].nTime, &blocks[2]);
+
+    BOOST_REQUIRE(accruals.count(cpid) == 1);
+    BOOST_CHECK_EQUAL(accruals.at(cpid), 72);
+    BOOST_CHECK_EQUAL(accruals.at(cpid), GetAccrual());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,8 @@
 #include <util/string.h>
 
 #include <boost/test/unit_test.hpp>
+#include <memory>
+#include <set>
 #include <vector>
 
 extern leveldb::DB *txdb;
@@ -1819,4 +1821,241 @@ BOOST_AUTO_TEST_CASE(beacon_registry_GetBeaconChainletRoot_test_2)
     }
 }
 
+BOOST_AUTO_TEST_CASE(beacon_registry_pending_indexes_follow_reorgs)
+{
+    FastRandomContext rng(uint256 {0});
+
+    GRC::BeaconRegistry& registry = GRC::GetBeaconRegistry();
+
+    // Make sure the registry is reset.
+    registry.Reset();
+
+    const GRC::Cpid cpid_a = GRC::Cpid::Parse("00010203040506070809101112131415");
+    const GRC::Cpid cpid_b = GRC::Cpid::Parse("15141312111009080706050403020100");
+    const GRC::Cpid cpid_c = GRC::Cpid::Parse("0f0e0d0c0b0a09080706050403020100");
+
+    CBlockIndex pindex {};
+    pindex.nVersion = 13;
+    pindex.nHeight = 1;
+
+    // Keep the contracts alive for the contexts that refer to them.
+    std::vector<std::unique_ptr<GRC::Contract>> contracts;
+    std::vector<std::unique_ptr<CTransaction>> txs;
+
+    const auto make_ctx = [&](const GRC::Cpid& cpid, const CKey& key, const int64_t time, const GRC::ContractAction action) {
+        txs.push_back(std::make_unique<CTransaction>());
+        txs.back()->nTime = time;
+
+        GRC::Beacon beacon {key.GetPubKey(), time, txs.back()->GetHash()};
+        GRC::BeaconPayload payload {2, cpid, beacon};
+
+        contracts.push_back(std::make_unique<GRC::Contract>(
+            GRC::MakeContract<GRC::BeaconPayload>(3, action, payload)));
+
+        return GRC::ContractContext {*contracts.back(), *txs.back(), &pindex};
+    };
+
+    // The CPID index must return exactly the pending beacons of the map for each CPID.
+    const auto check_indexes = [&]() {
+        for (const auto& cpid : {cpid_a, cpid_b, cpid_c}) {
+            std::set<CKeyID> expected;
+
+            for (const auto& pending_pair : registry.PendingBeacons()) {
+                if (pending_pair.second->m_cpid == cpid) {
+                    expected.insert(pending_pair.first);
+                }
+            }
+
+            std::set<CKeyID> found;
+
+            for (const auto& beacon : registry.FindPending(cpid)) {
+                BOOST_CHECK(beacon->m_cpid == cpid);
+                found.insert(beacon->GetId());
+            }
+
+            BOOST_CHECK(found == expected);
+        }
+    };
+
+    CKey key1, key2, key3, key4;
+    key1.MakeNewKey(true);
+    key2.MakeNewKey(true);
+    key3.MakeNewKey(true);
+    key4.MakeNewKey(true);
+
+    const int64_t time1 = 1000;
+    const int64_t time2 = 2000;
+    const int64_t time3 = 1000 + GRC::PendingBeacon::RETENTION_AGE + 10;
+
+    GRC::ContractContext ctx1 = make_ctx(cpid_a, key1, time1, GRC::ContractAction::ADD);
+    GRC::ContractContext ctx2 = make_ctx(cpid_a, key2, time2, GRC::ContractAction::ADD);
+    GRC::ContractContext ctx3 = make_ctx(cpid_b, key3, time3, GRC::ContractAction::ADD);
+    GRC::ContractContext ctx4 = make_ctx(cpid_c, key4, time3 + 1, GRC::ContractAction::ADD);
+
+    registry.Add(ctx1);
+    registry.Add(ctx2);
+    registry.Add(ctx3);
+    registry.Add(ctx4);
+
+    BOOST_CHECK_EQUAL(registry.PendingBeacons().size(), 4);
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_a).size(), 2);
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_b).size(), 1);
+    check_indexes();
+
+    // Disconnecting the block of an advertisement removes it from the index.
+    registry.Revert(ctx2);
+
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_a).size(), 1);
+    check_indexes();
+
+    // Reconnecting it puts it back.
+    registry.Add(ctx2);
+
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_a).size(), 2);
+    check_indexes();
+
+    // Revoking the beacon of a CPID removes its pending beacon.
+    GRC::ContractContext ctx5 = make_ctx(cpid_c, key4, time3 + 2, GRC::ContractAction::REMOVE);
+
+    registry.Delete(ctx5);
+
+    BOOST_CHECK(registry.FindPending(cpid_c).empty());
+    check_indexes();
+
+    // The superblock activates the first beacon of CPID A. The second beacon of CPID A is
+    // past the retention age and expires. The beacon of CPID B is not.
+    const uint256 superblock_hash = rng.rand256();
+    const int64_t superblock_time = time2 + GRC::PendingBeacon::RETENTION_AGE + 1;
+
+    registry.ActivatePending({key1.GetPubKey().GetID()}, superblock_time, superblock_hash, 2);
+
+    BOOST_CHECK(registry.Try(cpid_a) != nullptr);
+    BOOST_CHECK(registry.FindPending(cpid_a).empty());
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_b).size(), 1);
+    BOOST_CHECK_EQUAL(registry.ExpiredBeacons().size(), 1);
+    check_indexes();
+
+    // Disconnecting the superblock restores both beacons of CPID A to pending.
+    registry.Deactivate(superblock_hash);
+
+    BOOST_CHECK(registry.Try(cpid_a) == nullptr);
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_a).size(), 2);
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_b).size(), 1);
+    BOOST_CHECK(registry.ExpiredBeacons().empty());
+    check_indexes();
+
+    // Connecting the superblock again reaches the same state.
+    registry.ActivatePending({key1.GetPubKey().GetID()}, superblock_time, superblock_hash, 2);
+
+    BOOST_CHECK(registry.Try(cpid_a) != nullptr);
+    BOOST_CHECK(registry.FindPending(cpid_a).empty());
+    BOOST_CHECK_EQUAL(registry.FindPending(cpid_b).size(), 1);
+    BOOST_CHECK_EQUAL(registry.ExpiredBeacons().size(), 1);
+    check_indexes();
+
+    registry.Reset();
+
+    BOOST_CHECK(registry.FindPending(cpid_a).empty());
+    BOOST_CHECK(registry.FindPending(cpid_b).empty());
+}
+
+BOOST_AUTO_TEST_CASE(beacon_registry_reverts_entries_not_in_memory)
+{
+    FastRandomContext rng(uint256 {0});
+
+    GRC::BeaconRegistry& registry = GRC::GetBeaconRegistry();
+
+    // Make sure the registry is reset.
+    registry.Reset();
+
+    // Pending beacon
+    CTransaction tx1 {};
+    tx1.nTime = int64_t {1};
+
+    CBlockIndex pindex1 {};
+    pindex1.nVersion = 13;
+    pindex1.nHeight = 1;
+    pindex1.nTime = tx1.nTime;
+
+    GRC::Beacon beacon1 {TestKey::Public(), tx1.nTime, tx1.GetHash()};
+    GRC::BeaconPayload beacon_payload1 {2, TestKey::Cpid(), beacon1};
+    beacon_payload1.m_signature = TestKey::Signature(beacon_payload1);
+
+    GRC::Contract contract1 = GRC::MakeContract<GRC::BeaconPayload>(3, GRC::ContractAction::ADD, beacon_payload1);
+    GRC::ContractContext ctx1 {contract1, tx1, &pindex1};
+
+    registry.Add(ctx1);
+
+    // Activation
+    const uint256 superblock_hash = rng.rand256();
+
+    registry.ActivatePending({TestKey::Public().GetID()}, 2, superblock_hash, 2);
+
+    const uint256 activated_beacon_hash = Hash(superblock_hash, tx1.GetHash());
+
+    // Renewal
+    CTransaction tx3 {};
+    tx3.nTime = int64_t {3};
+
+    CBlockIndex pindex3 {};
+    pindex3.nVersion = 13;
+    pindex3.nHeight = 3;
+    pindex3.nTime = tx3.nTime;
+
+    GRC::Beacon beacon3 {TestKey::Public(), tx3.nTime, tx3.GetHash()};
+    GRC::BeaconPayload beacon_payload3 {2, TestKey::Cpid(), beacon3};
+    beacon_payload3.m_signature = TestKey::Signature(beacon_payload3);
+
+    GRC::Contract contract3 = GRC::MakeContract<GRC::BeaconPayload>(3, GRC::ContractAction::ADD, beacon_payload3);
+    GRC::ContractContext ctx3 {contract3, tx3, &pindex3};
+
+    registry.Add(ctx3);
+
+    BOOST_CHECK(registry.Try(TestKey::Cpid()) != nullptr);
+    BOOST_CHECK(registry.Try(TestKey::Cpid())->m_hash == tx3.GetHash());
+
+    // Reload the registry from LevelDB. Only the current renewal stays in memory. The pending and activated
+    // entries that it supersedes remain on disk.
+    registry.ResetInMemoryOnly();
+    registry.Initialize();
+
+    BOOST_CHECK_EQUAL(registry.GetBeaconDB().size(), 1);
+    BOOST_CHECK(registry.Try(TestKey::Cpid()) != nullptr);
+    BOOST_CHECK(registry.Try(TestKey::Cpid())->m_hash == tx3.GetHash());
+
+    // Reverting the renewal loads the activated beacon from LevelDB to restore it.
+    registry.Revert(ctx3);
+
+    BOOST_CHECK(registry.Try(TestKey::Cpid()) != nullptr);
+    BOOST_CHECK(registry.Try(TestKey::Cpid())->m_hash == activated_beacon_hash);
+    BOOST_CHECK(registry.Try(TestKey::Cpid())->m_status == GRC::BeaconStatusForStorage::ACTIVE);
+
+    // The renewal is gone and the pending entry was never loaded, so only the restored beacon is in memory.
+    registry.PassivateDB();
+
+    BOOST_CHECK_EQUAL(registry.GetBeaconDB().size(), 1);
+
+    // Deactivating the superblock loads the pending beacon from LevelDB to restore it.
+    registry.Deactivate(superblock_hash);
+
+    BOOST_CHECK(registry.Try(TestKey::Cpid()) == nullptr);
+
+    std::vector<GRC::Beacon_ptr> pending_beacons = registry.FindPending(TestKey::Cpid());
+
+    BOOST_CHECK_EQUAL(pending_beacons.size(), 1);
+
+    if (pending_beacons.size() == 1) {
+        BOOST_CHECK(pending_beacons[0]->m_hash == tx1.GetHash());
+        BOOST_CHECK(pending_beacons[0]->m_status == GRC::BeaconStatusForStorage::PENDING);
+    }
+
+    // Reverting the advertisement leaves nothing.
+    registry.Revert(ctx1);
+
+    BOOST_CHECK(registry.FindPending(TestKey::Cpid()).empty());
+    BOOST_CHECK(registry.FindHistorical(tx1.GetHash()) == nullptr);
+
+    registry.Reset();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
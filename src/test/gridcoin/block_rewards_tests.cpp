@@ -7,11 +7,14 @@
 #include "amount.h"
 #include "gridcoin/consensus/block_rewards.h"
 #include "gridcoin/consensus/mutable_transaction.h"
+#include "gridcoin/cpid.h"
+#include "gridcoin/mrc.h"
 #include "gridcoin/sidestake.h"
 #include "key.h"
 #include "script.h"
 #include "validation.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -581,4 +584,55 @@ BOOST_AUTO_TEST_CASE(construct_appends_sidestake_outputs)
     BOOST_CHECK_EQUAL(allocated, (alloc1 * total_owed).ToCAmount() + (alloc2 * total_owed).ToCAmount());
 }
 
+// =============================================================================
+// RunSignatureChecks — concurrent signature verification
+// =============================================================================
+
+BOOST_AUTO_TEST_CASE(run_signature_checks_handles_no_checks)
+{
+    BOOST_CHECK(GRC::BlockRewardRules::RunSignatureChecks({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(run_signature_checks_returns_results_in_check_order)
+{
+    const uint256 last_block_hash = uint256S("0102030405060708091011121314151617181920212223242526272829303132");
+
+    // Sign a full block of MRCs, and then break every third signature:
+    std::vector<GRC::MRC> mrcs(10);
+    std::vector<CPubKey> public_keys;
+
+    for (size_t i = 0; i < mrcs.size(); ++i) {
+        CKey key;
+        key.MakeNewKey(true);
+        public_keys.push_back(key.GetPubKey());
+
+        mrcs[i].m_mining_id = GRC::Cpid::Parse(strprintf("%032x", i + 1));
+        mrcs[i].m_fee = (i + 1) * COIN;
+        mrcs[i].m_last_block_hash = last_block_hash;
+
+        BOOST_REQUIRE(mrcs[i].Sign(key));
+
+        if (i % 3 == 0) {
+            mrcs[i].m_fee += 1;
+        }
+    }
+
+    std::vector<std::function<bool()>> checks;
+
+    for (size_t i = 0; i < mrcs.size(); ++i) {
+        checks.emplace_back([&, i]() {
+            return mrcs[i].VerifySignature(public_keys[i], last_block_hash);
+        });
+    }
+
+    const std::vector<uint8_t> results = GRC::BlockRewardRules::RunSignatureChecks(checks);
+
+    BOOST_REQUIRE_EQUAL(results.size(), mrcs.size());
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        BOOST_CHECK_EQUAL(results[i] != 0, i % 3 != 0);
+        BOOST_CHECK_EQUAL(results[i] != 0, checks[i]());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 #include <main.h>
 #include <gridcoin/account.h>
 #include <gridcoin/beacon.h>
+#include <gridcoin/consensus/block_rewards.h>
 #include <gridcoin/cpid.h>
 #include <gridcoin/mrc.h>
 #include <gridcoin/tally.h>
@@ -86,6 +87,69 @@ struct Setup {
         GRC::Researcher::Reload({}, {});
     }
 
+    //!
+    //! \brief Stake a block on the tip of the mock chain that pays one MRC and
+    //! check its rewards with BlockRewardRules::Check().
+    //!
+    //! \param mrc_key   Key to sign the MRC with.
+    //! \param claim_key Key to sign a researcher claim for the same CPID with,
+    //! or \c nullptr to stake the block as an investor.
+    //!
+    //! \return The first error reported by Check(), or an empty string when
+    //! the block passes.
+    //!
+    std::string CheckBlockRewards(CKey& mrc_key, CKey* claim_key)
+    {
+        account.m_accrual = 72;
+
+        GRC::MRC mrc;
+        CAmount reward{0}, fee{0};
+        GRC::CreateMRC(pindex->pprev, mrc, reward, fee, wallet);
+        mrc.Sign(mrc_key);
+
+        CTransaction mrc_tx;
+        mrc_tx.nTime = pindex->nTime;
+        mrc_tx.vContracts.emplace_back(GRC::MakeContract<GRC::MRC>(2, GRC::ContractAction::ADD, mrc));
+
+        CBlock block;
+        block.nVersion = pindex->nVersion;
+        block.nTime = pindex->nTime;
+        block.vtx.resize(2);
+        block.vtx[1].vin.resize(1);
+        block.vtx[1].vout.resize(2);
+        block.vtx[1].vout[1].scriptPubKey.SetDestination(key.GetPubKey().GetID());
+        block.vtx.push_back(mrc_tx);
+
+        std::map<GRC::Cpid, std::pair<uint256, GRC::MRC>> mrc_map;
+        std::map<GRC::Cpid, uint256> mrc_tx_map;
+        mrc_map[cpid] = {mrc_tx.GetHash(), mrc};
+
+        GRC::Claim claim;
+        uint32_t claim_contract_version = 2;
+
+        if (claim_key) {
+            claim.m_mining_id = cpid;
+        }
+
+        if (!CreateMRCRewards(block, mrc_map, mrc_tx_map, reward, claim_contract_version, claim, wallet)) {
+            return "CreateMRCRewards() failed";
+        }
+
+        // Sign the claim over the final coinstake like the miner does:
+        if (claim_key) {
+            const_cast<GRC::Claim&>(block.GetClaim()).Sign(*claim_key, pindex->pprev->GetBlockHash(), block.vtx[1]);
+        }
+
+        const GRC::BlockRewardRules rules(block, pindex, 1000 * COIN, 0, 0, 0);
+        std::string error;
+
+        if (rules.Check(error)) {
+            return "";
+        }
+
+        return error;
+    }
+
     ~Setup() {
         GRC::GetBeaconRegistry().Reset();
         gArgs.ForceSetArg("forcecpid", "");
@@ -273,4 +337,34 @@ BOOST_AUTO_TEST_CASE(it_creates_valid_mrc_claims)
     // around this.
 }
 
+BOOST_AUTO_TEST_CASE(check_reports_a_bad_mrc_signature_first)
+{
+    const std::string mrc_error = "An MRC in the claim failed to validate";
+    CKey other_key;
+    other_key.MakeNewKey(false);
+
+    LOCK2(cs_main, wallet->cs_wallet);
+
+    BOOST_CHECK(CheckBlockRewards(key, nullptr) != mrc_error);
+    BOOST_CHECK_EQUAL(CheckBlockRewards(other_key, nullptr), mrc_error);
+
+    // The MRC checks run before the claim signature check:
+    BOOST_CHECK_EQUAL(CheckBlockRewards(other_key, &other_key), mrc_error);
+}
+
+BOOST_AUTO_TEST_CASE(check_reports_a_bad_claim_signature)
+{
+    const std::string claim_error = strprintf(
+        "Beacon signature verification failed for CPID %s at height %d",
+        GRC::MiningId(cpid).ToString(),
+        pindex->nHeight);
+    CKey other_key;
+    other_key.MakeNewKey(false);
+
+    LOCK2(cs_main, wallet->cs_wallet);
+
+    BOOST_CHECK(CheckBlockRewards(key, &key) != claim_error);
+    BOOST_CHECK_EQUAL(CheckBlockRewards(key, &other_key), claim_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "gridcoin/scraper/part_delta.h"
+#include "tinyformat.h"
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+namespace {
+//!
+//! \brief Gzip a CSV file like the scraper does when it stores stats files.
+//!
+SerializeData GzipPart(const std::string& csv)
+{
+    std::stringstream stream;
+    stream << csv;
+
+    boost::iostreams::filtering_istream in;
+    in.push(boost::iostreams::gzip_compressor());
+    in.push(stream);
+
+    std::string compressed;
+    boost::iostreams::copy(in, boost::iostreams::back_inserter(compressed));
+
+    const auto begin = reinterpret_cast<const std::byte*>(compressed.data());
+
+    return SerializeData(begin, begin + compressed.size());
+}
+
+//!
+//! \brief Make a project stats CSV with one row per CPID. Rows whose index is
+//! a multiple of \p changed_every carry a different credit value.
+//!
+std::string MakeStatsCsv(const size_t rows, const size_t changed_every)
+{
+    std::string csv = "#total_credit,expavg_time,expavg_credit,cpid\n";
+
+    for (size_t i = 0; i < rows; ++i) {
+        const double credit = (changed_every && i % changed_every == 0) ? i * 3.5 : i * 2.25;
+        csv += strprintf("%d,%d,%.2f,%032x\n", i * 1000, 1600000000 + i, credit, i * 7919);
+    }
+
+    return csv;
+}
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(part_delta_tests)
+
+BOOST_AUTO_TEST_CASE(it_rebuilds_a_part_from_the_changed_rows)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(5000, 0));
+    const SerializeData target = GzipPart(MakeStatsCsv(5000, 50));
+
+    const std::optional<SerializeData> delta = MakeScraperPartDelta(base, target);
+
+    BOOST_REQUIRE(delta.has_value());
+    BOOST_CHECK_LT(delta->size(), target.size() / 4);
+
+    const std::optional<SerializeData> rebuilt = ApplyScraperPartDelta(base, *delta);
+
+    BOOST_REQUIRE(rebuilt.has_value());
+    BOOST_CHECK(*rebuilt == target);
+}
+
+BOOST_AUTO_TEST_CASE(it_rebuilds_a_part_with_added_and_removed_rows)
+{
+    std::string base_csv = MakeStatsCsv(3000, 0);
+    std::string target_csv = MakeStatsCsv(2000, 0);
+
+    target_csv += "1,2,3.00,ffffffffffffffffffffffffffffffff\n";
+    target_csv.insert(0, "0,0,0.00,00000000000000000000000000000001\n");
+
+    const SerializeData base = GzipPart(base_csv);
+    const SerializeData target = GzipPart(target_csv);
+
+    const std::optional<SerializeData> delta = MakeScraperPartDelta(base, target);
+
+    BOOST_REQUIRE(delta.has_value());
+    BOOST_CHECK(ApplyScraperPartDelta(base, *delta) == target);
+}
+
+BOOST_AUTO_TEST_CASE(it_declines_parts_that_are_not_gzipped)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(100, 0));
+    const SerializeData target(1000, std::byte{0x42});
+
+    BOOST_CHECK(!MakeScraperPartDelta(base, target).has_value());
+    BOOST_CHECK(!MakeScraperPartDelta(target, base).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(it_declines_a_delta_that_is_not_smaller_than_the_part)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(100, 0));
+    const SerializeData target = GzipPart("x\n");
+
+    BOOST_CHECK(!MakeScraperPartDelta(base, target).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(it_rejects_a_malformed_delta)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(100, 0));
+
+    BOOST_CHECK(!ApplyScraperPartDelta(base, SerializeData(100, std::byte{0x1f})).has_value());
+    BOOST_CHECK(!ApplyScraperPartDelta(base, GzipPart("not a delta")).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(it_rejects_a_delta_that_copies_past_the_end_of_the_base)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(5000, 0));
+    const SerializeData target = GzipPart(MakeStatsCsv(5000, 50));
+    const SerializeData short_base = GzipPart(MakeStatsCsv(10, 0));
+
+    const std::optional<SerializeData> delta = MakeScraperPartDelta(base, target);
+
+    BOOST_REQUIRE(delta.has_value());
+    BOOST_CHECK(!ApplyScraperPartDelta(short_base, *delta).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(it_rejects_a_delta_that_rebuilds_different_text)
+{
+    const SerializeData base = GzipPart(MakeStatsCsv(5000, 0));
+    const SerializeData target = GzipPart(MakeStatsCsv(5000, 50));
+    const SerializeData other_base = GzipPart(MakeStatsCsv(5000, 7));
+
+    const std::optional<SerializeData> delta = MakeScraperPartDelta(base, target);
+
+    BOOST_REQUIRE(delta.has_value());
+    BOOST_CHECK(!ApplyScraperPartDelta(other_base, *delta).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,205 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "gridcoin/scraper/part_store.h"
+#include "hash.h"
+#include "util.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+namespace {
+//!
+//! \brief Create part data of the specified size filled with a marker byte.
+//!
+SerializeData MakePartData(const size_t size, const uint8_t marker)
+{
+    return SerializeData(size, std::byte{marker});
+}
+
+//!
+//! \brief Provides a scratch directory in the test data directory.
+//!
+struct PartStoreFixture
+{
+    fs::path m_dir;
+
+    PartStoreFixture()
+        : m_dir(GetDataDir() / "part_store_tests")
+    {
+        fs::remove_all(m_dir);
+    }
+
+    ~PartStoreFixture()
+    {
+        fs::remove_all(m_dir);
+    }
+};
+} // Anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(part_store_tests, PartStoreFixture)
+
+BOOST_AUTO_TEST_CASE(it_holds_parts_in_memory_until_opened)
+{
+    ScraperPartStore store;
+
+    const SerializeData data = MakePartData(1000, 1);
+    const uint256 hash = Hash(data);
+
+    store.Put(hash, data);
+
+    BOOST_CHECK(*store.Get(hash) == data);
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 1000);
+
+    BOOST_CHECK(store.Open(m_dir, 0));
+
+    BOOST_CHECK(fs::exists(m_dir / hash.GetHex()));
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 0);
+    BOOST_CHECK(*store.Get(hash) == data);
+}
+
+BOOST_AUTO_TEST_CASE(it_evicts_the_least_recently_used_parts)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 2500));
+
+    const SerializeData data_1 = MakePartData(1000, 1);
+    const SerializeData data_2 = MakePartData(1000, 2);
+    const SerializeData data_3 = MakePartData(1000, 3);
+
+    store.Put(Hash(data_1), data_1);
+    store.Put(Hash(data_2), data_2);
+
+    // Touch the first part so that the second part becomes the oldest:
+    BOOST_CHECK(*store.Get(Hash(data_1)) == data_1);
+
+    store.Put(Hash(data_3), data_3);
+
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 2000);
+
+    // Reading the evicted part back loads it from disk:
+    BOOST_CHECK(*store.Get(Hash(data_2)) == data_2);
+    BOOST_CHECK(*store.Get(Hash(data_1)) == data_1);
+    BOOST_CHECK(*store.Get(Hash(data_3)) == data_3);
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 2000);
+}
+
+BOOST_AUTO_TEST_CASE(it_keeps_handed_out_data_valid_after_eviction)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 1000));
+
+    const SerializeData data_1 = MakePartData(1000, 1);
+    const SerializeData data_2 = MakePartData(1000, 2);
+
+    store.Put(Hash(data_1), data_1);
+    const std::shared_ptr<const SerializeData> held = store.Get(Hash(data_1));
+
+    store.Put(Hash(data_2), data_2);
+
+    BOOST_CHECK(*held == data_1);
+}
+
+BOOST_AUTO_TEST_CASE(it_rejects_a_part_file_that_does_not_match_its_hash)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 0));
+
+    const SerializeData data = MakePartData(1000, 1);
+    const uint256 hash = Hash(data);
+
+    store.Put(hash, data);
+
+    {
+        std::ofstream file((m_dir / hash.GetHex()).string(), std::ios::binary | std::ios::in);
+        file.seekp(500);
+        file.put(0x7f);
+    }
+
+    BOOST_CHECK(store.Get(hash) == nullptr);
+    BOOST_CHECK(!fs::exists(m_dir / hash.GetHex()));
+
+    // The store dropped the corrupt part, so it accepts the part again:
+    store.Put(hash, data);
+
+    BOOST_REQUIRE(store.Get(hash) != nullptr);
+    BOOST_CHECK(*store.Get(hash) == data);
+}
+
+BOOST_AUTO_TEST_CASE(it_drops_a_part_whose_file_is_missing)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 0));
+
+    const SerializeData data = MakePartData(1000, 1);
+    const uint256 hash = Hash(data);
+
+    store.Put(hash, data);
+    fs::remove(m_dir / hash.GetHex());
+
+    BOOST_CHECK(store.Get(hash) == nullptr);
+
+    store.Put(hash, data);
+
+    BOOST_REQUIRE(store.Get(hash) != nullptr);
+    BOOST_CHECK(*store.Get(hash) == data);
+}
+
+BOOST_AUTO_TEST_CASE(it_erases_parts)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 10000));
+
+    const SerializeData data = MakePartData(1000, 1);
+    const uint256 hash = Hash(data);
+
+    store.Put(hash, data);
+    store.Erase(hash);
+
+    BOOST_CHECK(!fs::exists(m_dir / hash.GetHex()));
+    BOOST_CHECK(store.Get(hash) == nullptr);
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(it_leaves_part_files_in_place_after_closing)
+{
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 1000));
+
+    const SerializeData data_1 = MakePartData(1000, 1);
+    const SerializeData data_2 = MakePartData(1000, 2);
+
+    store.Put(Hash(data_1), data_1);
+    store.Put(Hash(data_2), data_2);
+
+    store.Close();
+
+    // The part that was only on disk is gone. The cached part stays usable:
+    BOOST_CHECK(store.Get(Hash(data_1)) == nullptr);
+    BOOST_REQUIRE(store.Get(Hash(data_2)) != nullptr);
+    BOOST_CHECK(*store.Get(Hash(data_2)) == data_2);
+
+    store.Erase(Hash(data_1));
+    store.Erase(Hash(data_2));
+
+    BOOST_CHECK(fs::exists(m_dir / Hash(data_1).GetHex()));
+    BOOST_CHECK(fs::exists(m_dir / Hash(data_2).GetHex()));
+    BOOST_CHECK_EQUAL(store.MemoryUsage(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(it_removes_stale_part_files_when_opened)
+{
+    fs::create_directories(m_dir);
+
+    const fs::path stale = m_dir / uint256{}.GetHex();
+    std::ofstream(stale.string()) << "stale";
+
+    ScraperPartStore store;
+    BOOST_CHECK(store.Open(m_dir, 0));
+
+    BOOST_CHECK(!fs::exists(stale));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
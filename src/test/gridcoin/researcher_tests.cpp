@@ -241,6 +241,50 @@ BOOST_AUTO_TEST_CASE(it_parses_a_project_xml_string)
     gArgs.ForceSetArg("email", "");
 }
 
+BOOST_AUTO_TEST_CASE(it_parses_a_project_xml_string_with_unrelated_elements)
+{
+    gArgs.ForceSetArg("email", "researcher@example.com");
+
+    // Elements appear in a different order and between elements that the
+    // parser does not use, including nested ones and ones with attributes:
+    //
+    GRC::MiningProject project = GRC::MiningProject::Parse(
+        R"XML(
+        <project>
+          <gui_urls>
+            <gui_url>
+              <name>Your account</name>
+              <url>https://example.com/home.php</url>
+            </gui_url>
+          </gui_urls>
+          <user_expavg_credit>123.45</user_expavg_credit>
+          <team_name attr="1">Wrong Team</team_name>
+          <external_cpid>f5d8234352e5a5ae3915debba7258294</external_cpid>
+          <rsc_backoff_time>
+            <name>CPU</name>
+            <value>0.000000</value>
+          </rsc_backoff_time>
+          <cross_project_id>XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX</cross_project_id>
+          <team_name>Team Name</team_name>
+          <project_name>Project Name</project_name>
+          <master_url>https://example.com/</master_url>
+          <project_name>Second Name</project_name>
+        </project>
+        )XML");
+
+    GRC::Cpid cpid = GRC::Cpid::Parse("f5d8234352e5a5ae3915debba7258294");
+
+    BOOST_CHECK(project.m_name == "project name");
+    BOOST_CHECK(project.m_cpid == cpid);
+    BOOST_CHECK(project.m_team == "team name");
+    BOOST_CHECK(project.m_url == "https://example.com/");
+    BOOST_CHECK(project.m_rac == 123.45);
+    BOOST_CHECK(project.m_error == GRC::MiningProject::Error::NONE);
+
+    // Clean up:
+    gArgs.ForceSetArg("email", "");
+}
+
 BOOST_AUTO_TEST_CASE(it_falls_back_to_compute_a_missing_external_cpid)
 {
     gArgs.ForceSetArg("email", "researcher@example.com");
@@ -1671,6 +1715,55 @@ void it_parses_project_xml_from_a_client_state_xml_file()
     GRC::Researcher::Reload(GRC::MiningProjectMap());
 }
 
+// Note: the precondition skips this test case when the test harness cannot
+// resolve the client_state.xml stub.
+void it_reloads_projects_when_the_parse_inputs_change()
+{
+    // A reload reuses the projects parsed from an unchanged client_state.xml
+    // file, but it must parse the file again when the email address used to
+    // verify the CPIDs changes.
+
+    gArgs.ForceSetArg("email", "researcher@example.com");
+    gArgs.ForceSetArg("boincdatadir", ResolveStubDir().string() + "/");
+
+    GRC::Researcher::Reload();
+
+    const GRC::Cpid cpid_2 = GRC::Cpid::Parse("8edc235ddcecf9c416a5f9417d56f4fd");
+
+    BOOST_CHECK(GRC::Researcher::Get()->Id() == cpid_2);
+    BOOST_CHECK(GRC::Researcher::Get()->Projects().size() == 3);
+
+    // The same file and settings produce the same projects:
+    GRC::Researcher::Reload();
+
+    BOOST_CHECK(GRC::Researcher::Get()->Id() == cpid_2);
+    BOOST_CHECK(GRC::Researcher::Get()->Projects().size() == 3);
+
+    if (const GRC::ProjectOption project2 = GRC::Researcher::Get()->Project("valid project 2")) {
+        BOOST_CHECK(project2->m_error == GRC::MiningProject::Error::NONE);
+    } else {
+        BOOST_FAIL("Project 2 does not exist in the mining project map.");
+    }
+
+    // The CPIDs in the stub do not match a different email address:
+    gArgs.ForceSetArg("email", "someone.else@example.com");
+
+    GRC::Researcher::Reload();
+
+    BOOST_CHECK(GRC::Researcher::Get()->Id() == GRC::MiningId::ForNoncruncher());
+
+    if (const GRC::ProjectOption project2 = GRC::Researcher::Get()->Project("valid project 2")) {
+        BOOST_CHECK(project2->m_error == GRC::MiningProject::Error::MISMATCHED_CPID);
+    } else {
+        BOOST_FAIL("Project 2 does not exist in the mining project map.");
+    }
+
+    // Clean up:
+    gArgs.ForceSetArg("email", "");
+    gArgs.ForceSetArg("boincdatadir", "");
+    GRC::Researcher::Reload(GRC::MiningProjectMap());
+}
+
 // Note: the precondition skips this test case when the test harness cannot
 // resolve the client_state.xml stub.
 void it_resets_to_noncruncher_mode_when_explicitly_configured()
@@ -1705,6 +1798,7 @@ BOOST_AUTO_TEST_CASE(client_state_stub_exists)
 {
     if (fs::exists(ResolveStubDir() / "client_state.xml")) {
         boost::unit_test::framework::master_test_suite().add(BOOST_TEST_CASE(&it_parses_project_xml_from_a_client_state_xml_file));
+        boost::unit_test::framework::master_test_suite().add(BOOST_TEST_CASE(&it_reloads_projects_when_the_parse_inputs_change));
         boost::unit_test::framework::master_test_suite().add(BOOST_TEST_CASE(&it_resets_to_noncruncher_mode_when_explicitly_configured));
     } else {
         BOOST_TEST_MESSAGE("client_state.xml test stub not found");
@@ -5,6 +5,8 @@
 #include <base58.h>
 #include "compat/endian.h"
 #include <gridcoin/md5.h>
+#include "gridcoin/project.h"
+#include "gridcoin/scraper/scraper.h"
 #include "gridcoin/scraper/scraper_net.h"
 #include "gridcoin/superblock.h"
 #include "gridcoin/support/xml.h"
@@ -14,6 +16,9 @@
 
 #include <array>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
 #include <vector>
@@ -312,6 +317,7 @@ struct ScraperStatsMeta
 const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperStatsMeta& meta)
 {
     ScraperStatsVerifiedBeaconsTotalCredits stats_and_verified_beacons;
+    ScraperStats stats;
 
     ScraperObjectStats p1c1;
     p1c1.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -320,7 +326,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p1c1.statsvalue.dRAC = meta.p1c1_rac;
     p1c1.statsvalue.dAvgRAC = meta.p1c1_avg_rac;
     p1c1.statsvalue.dMag = meta.p1c1_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p1c1.statskey, p1c1);
+    stats.emplace(p1c1.statskey, p1c1);
 
     ScraperObjectStats p1c2;
     p1c2.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -329,7 +335,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p1c2.statsvalue.dRAC = meta.p1c2_rac;
     p1c2.statsvalue.dAvgRAC = meta.p1c2_avg_rac;
     p1c2.statsvalue.dMag = meta.p1c2_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p1c2.statskey, p1c2);
+    stats.emplace(p1c2.statskey, p1c2);
 
     ScraperObjectStats p2c1;
     p2c1.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -338,7 +344,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p2c1.statsvalue.dRAC = meta.p2c1_rac;
     p2c1.statsvalue.dAvgRAC = meta.p2c1_avg_rac;
     p2c1.statsvalue.dMag = meta.p2c1_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p2c1.statskey, p2c1);
+    stats.emplace(p2c1.statskey, p2c1);
 
     ScraperObjectStats p2c2;
     p2c2.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -347,7 +353,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p2c2.statsvalue.dRAC = meta.p2c2_rac;
     p2c2.statsvalue.dAvgRAC = meta.p2c2_avg_rac;
     p2c2.statsvalue.dMag = meta.p2c2_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p2c2.statskey, p2c2);
+    stats.emplace(p2c2.statskey, p2c2);
 
     ScraperObjectStats p1c3;
     p1c3.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -356,7 +362,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p1c3.statsvalue.dRAC = meta.p1c3_rac;
     p1c3.statsvalue.dAvgRAC = meta.p1c3_avg_rac;
     p1c3.statsvalue.dMag = meta.p1c3_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p1c2.statskey, p1c3);
+    stats.emplace(p1c2.statskey, p1c3);
 
     ScraperObjectStats p2c3;
     p2c3.statskey.objecttype = statsobjecttype::byCPIDbyProject;
@@ -365,7 +371,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p2c3.statsvalue.dRAC = meta.p2c3_rac;
     p2c3.statsvalue.dAvgRAC = meta.p2c3_avg_rac;
     p2c3.statsvalue.dMag = meta.p2c3_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p2c2.statskey, p2c3);
+    stats.emplace(p2c2.statskey, p2c3);
 
     ScraperObjectStats c1;
     c1.statskey.objecttype = statsobjecttype::byCPID;
@@ -374,7 +380,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     c1.statsvalue.dRAC = meta.c1_rac;
     c1.statsvalue.dAvgRAC = meta.c1_rac;
     c1.statsvalue.dMag = meta.c1_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(c1.statskey, c1);
+    stats.emplace(c1.statskey, c1);
 
     ScraperObjectStats c2;
     c2.statskey.objecttype = statsobjecttype::byCPID;
@@ -383,7 +389,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     c2.statsvalue.dRAC = meta.c2_rac;
     c2.statsvalue.dAvgRAC = meta.c2_rac;
     c2.statsvalue.dMag = meta.c2_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(c2.statskey, c2);
+    stats.emplace(c2.statskey, c2);
 
     ScraperObjectStats c3;
     c3.statskey.objecttype = statsobjecttype::byCPID;
@@ -392,7 +398,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     c3.statsvalue.dRAC = meta.c3_rac;
     c3.statsvalue.dAvgRAC = meta.c3_rac;
     c3.statsvalue.dMag = meta.c3_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(c3.statskey, c3);
+    stats.emplace(c3.statskey, c3);
 
     ScraperObjectStats p1;
     p1.statskey.objecttype = statsobjecttype::byProject;
@@ -401,7 +407,7 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p1.statsvalue.dRAC = meta.p1_rac;
     p1.statsvalue.dAvgRAC = meta.p1_avg_rac;
     p1.statsvalue.dMag = meta.p1_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p1.statskey, p1);
+    stats.emplace(p1.statskey, p1);
 
     ScraperObjectStats p2;
     p2.statskey.objecttype = statsobjecttype::byProject;
@@ -410,7 +416,9 @@ const ScraperStatsVerifiedBeaconsTotalCredits GetTestScraperStats(const ScraperS
     p2.statsvalue.dRAC = meta.p2_rac;
     p2.statsvalue.dAvgRAC = meta.p2_avg_rac;
     p2.statsvalue.dMag = meta.p2_mag;
-    stats_and_verified_beacons.mScraperStats.emplace(p2.statskey, p2);
+    stats.emplace(p2.statskey, p2);
+
+    stats_and_verified_beacons.mScraperStats = ScraperStatsTable(stats);
 
     ScraperPendingBeaconEntry pendingBeaconEntry1;
     pendingBeaconEntry1.cpid = meta.cpid1_str;
@@ -561,8 +569,58 @@ ConvergedScraperStats GetTestConvergence(
 
     return convergence;
 }
+
+//!
+//! \brief Gzip a project stats CSV like the scrapers do.
+//!
+SerializeData GzipStatsCsv(const std::string& csv)
+{
+    std::string compressed;
+
+    {
+        boost::iostreams::filtering_ostream out;
+        out.push(boost::iostreams::gzip_compressor());
+        out.push(boost::iostreams::back_inserter(compressed));
+        out << csv;
+    }
+
+    const auto begin = reinterpret_cast<const std::byte*>(compressed.data());
+
+    return SerializeData(begin, begin + compressed.size());
+}
+
+//!
+//! \brief Build a gzipped project stats part like the scrapers publish.
+//!
+//! \param seed Varies the credit and CPIDs of the rows.
+//!
+std::unique_ptr<CSplitBlob::CPart> GetTestProjectStatsPart(const uint32_t seed)
+{
+    std::string csv = "#total_credit,expavg_time,expavg_credit,cpid\n";
+
+    for (uint32_t i = 0; i < 200; ++i) {
+        // Overlapping CPIDs across projects exercise the byCPID roll up:
+        const uint32_t cpid = (i * 7 + seed) % 300;
+
+        csv += strprintf("%d,%d,%.3f,%032x\n", (i + 1) * 1000 + seed, 1600000000 + i, (i * 37 + seed) / 7.0, cpid);
+    }
+
+    SerializeData data = GzipStatsCsv(csv);
+
+    // Parts share one store keyed by the part hash, so the hash must match:
+    auto part = std::make_unique<CSplitBlob::CPart>(Hash(data));
+    part->SetData(std::move(data));
+
+    return part;
+}
 } // anonymous namespace
 
+bool LoadProjectObjectToStatsByCPID(const std::string& project, const SerializeData& ProjectData,
+                                    const double& projectmag, ScraperStatsTable& mScraperStats);
+bool ProcessNetworkWideFromProjectStats(ScraperStatsTable& mScraperStats);
+bool LoadProjectPartsToStatsByCPID(const ConvergedManifest& StructConvergedManifest, const GRC::WhitelistSnapshot& greylist,
+                                   const double& dMagnitudePerProject, ScraperStatsTable& mScraperStats);
+
 // -----------------------------------------------------------------------------
 // Superblock
 // -----------------------------------------------------------------------------
@@ -1203,7 +1261,7 @@ BOOST_AUTO_TEST_CASE(it_checks_whether_it_was_created_from_fallback_convergence)
     SerializeData project_part_data(project_part_stream.begin(), project_part_stream.end());
 
     CSplitBlob::CPart project_part(Hash(project_part_data));
-    project_part.data = project_part_data;
+    project_part.SetData(project_part_data);
 
     superblock.m_projects.SetHint("project_name", &project_part);
 
@@ -1939,7 +1997,7 @@ BOOST_AUTO_TEST_CASE(it_sets_a_project_part_convergence_hint)
     SerializeData project_part_data(project_part_stream.begin(), project_part_stream.end());
 
     CSplitBlob::CPart project_part(Hash(project_part_data));
-    project_part.data = project_part_data;
+    project_part.SetData(project_part_data);
 
     projects.SetHint("project_name", &project_part);
 
@@ -2136,12 +2194,12 @@ BOOST_AUTO_TEST_CASE(it_serializes_to_a_stream_for_fallback_convergences)
     uint256 hash = Hash(project_part_data);
 
     CSplitBlob::CPart project_1_part(hash);
-    project_1_part.data = project_part_data;
+    project_1_part.SetData(project_part_data);
 
     projects.SetHint("project_1", &project_1_part);
 
     CSplitBlob::CPart project_2_part(hash);
-    project_2_part.data = project_part_data;
+    project_2_part.SetData(project_part_data);
 
     projects.SetHint("project_2", &project_2_part);
 
@@ -2468,6 +2526,114 @@ BOOST_AUTO_TEST_CASE(it_hashes_a_set_of_scraper_statistics_like_a_superblock)
     BOOST_CHECK(quorum_hash == superblock.GetHash());
 }
 
+BOOST_AUTO_TEST_CASE(it_hashes_stats_from_converged_manifest_parts_like_a_serial_load)
+{
+    std::vector<std::unique_ptr<CSplitBlob::CPart>> parts;
+    ConvergedManifest manifest;
+
+    for (uint32_t i = 0; i < 12; ++i) {
+        parts.push_back(GetTestProjectStatsPart(i));
+        manifest.ConvergedManifestPartPtrsMap.emplace("project_" + ToString(i), parts.back().get());
+    }
+
+    parts.push_back(std::make_unique<CSplitBlob::CPart>(uint256{}));
+    manifest.ConvergedManifestPartPtrsMap.emplace("BeaconList", parts.back().get());
+
+    // Load the projects one at a time in key order as the scraper used to:
+    const double magnitude_per_project = NETWORK_MAGNITUDE / 12;
+    ScraperStatsVerifiedBeaconsTotalCredits expected;
+
+    for (const auto& entry : manifest.ConvergedManifestPartPtrsMap) {
+        if (entry.first == "BeaconList") continue;
+
+        ScraperStatsTable project_stats;
+        LoadProjectObjectToStatsByCPID(entry.first, *entry.second->GetData(), magnitude_per_project, project_stats);
+
+        expected.mScraperStats.Merge(std::move(project_stats));
+    }
+
+    ProcessNetworkWideFromProjectStats(expected.mScraperStats);
+
+    // Call the parallel loader directly with an empty greylist. The full
+    // GetScraperStatsByConvergedManifest() entry point reads the greylist from
+    // the whitelist registry, which needs a chain to refresh the automatic
+    // greylist:
+    const GRC::WhitelistSnapshot greylist(std::make_shared<GRC::ProjectList>(),
+                                          GRC::ProjectEntry::ProjectFilterFlag::GREYLISTED);
+    ScraperStatsVerifiedBeaconsTotalCredits stats;
+
+    BOOST_REQUIRE(LoadProjectPartsToStatsByCPID(manifest, greylist, magnitude_per_project, stats.mScraperStats));
+    ProcessNetworkWideFromProjectStats(stats.mScraperStats);
+
+    BOOST_REQUIRE_EQUAL(stats.mScraperStats.size(), expected.mScraperStats.size());
+
+    const ScraperStats stats_map = stats.mScraperStats.ToMap();
+    const ScraperStats expected_map = expected.mScraperStats.ToMap();
+
+    auto expected_iter = expected_map.begin();
+
+    for (const auto& entry : stats_map) {
+        BOOST_CHECK(entry.first.objecttype == expected_iter->first.objecttype);
+        BOOST_CHECK_EQUAL(entry.first.objectID, expected_iter->first.objectID);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dTC, expected_iter->second.statsvalue.dTC);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dRAC, expected_iter->second.statsvalue.dRAC);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dAvgRAC, expected_iter->second.statsvalue.dAvgRAC);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dMag, expected_iter->second.statsvalue.dMag);
+        ++expected_iter;
+    }
+
+    BOOST_CHECK(GRC::QuorumHash::Hash(stats) == GRC::QuorumHash::Hash(expected));
+}
+
+BOOST_AUTO_TEST_CASE(it_counts_rows_with_unkeyed_cpids_in_the_project_totals)
+{
+    // The last row's CPID is uppercase, so it cannot key a stats table entry:
+    const SerializeData data = GzipStatsCsv(
+        "#total_credit,expavg_time,expavg_credit,cpid\n"
+        "1000,1600000000,100.000,00010203040506070809101112131415\n"
+        "2000,1600000000,300.000,15141312111009080706050403020100\n"
+        "3000,1600000000,600.000,ABCDEF0123456789ABCDEF0123456789\n");
+
+    ScraperStatsTable stats;
+
+    BOOST_REQUIRE(LoadProjectObjectToStatsByCPID("project", data, 1000.0, stats));
+    BOOST_REQUIRE_EQUAL(stats.ByCPIDbyProject().size(), 2u);
+    BOOST_REQUIRE_EQUAL(stats.ByProject().size(), 1u);
+
+    // The other CPIDs' shares of the project magnitude include the row:
+    BOOST_CHECK_EQUAL(stats.ByCPIDbyProject()[0].statsvalue.dMag, 100.0);
+    BOOST_CHECK_EQUAL(stats.ByCPIDbyProject()[1].statsvalue.dMag, 300.0);
+
+    const ScraperObjectStatsValue& project = stats.ByProject()[0].statsvalue;
+
+    BOOST_CHECK_EQUAL(project.dTC, 6000.0);
+    BOOST_CHECK_EQUAL(project.dRAC, 1000.0);
+    BOOST_CHECK_EQUAL(project.dAvgRAC, 1000.0 / 3);
+    BOOST_CHECK_EQUAL(project.dMag, 1000.0);
+}
+
+BOOST_AUTO_TEST_CASE(it_fails_stats_for_converged_manifest_parts_with_missing_data)
+{
+    std::vector<std::unique_ptr<CSplitBlob::CPart>> parts;
+    ConvergedManifest manifest;
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        parts.push_back(GetTestProjectStatsPart(i));
+        manifest.ConvergedManifestPartPtrsMap.emplace("project_" + ToString(i), parts.back().get());
+    }
+
+    // A part that the store does not hold:
+    parts.push_back(std::make_unique<CSplitBlob::CPart>(uint256S("0x01")));
+    manifest.ConvergedManifestPartPtrsMap.emplace("project_missing", parts.back().get());
+
+    const GRC::WhitelistSnapshot greylist(std::make_shared<GRC::ProjectList>(),
+                                          GRC::ProjectEntry::ProjectFilterFlag::GREYLISTED);
+    ScraperStatsTable stats;
+
+    BOOST_CHECK(!LoadProjectPartsToStatsByCPID(manifest, greylist, NETWORK_MAGNITUDE / 4, stats));
+    BOOST_CHECK(stats.empty());
+}
+
 BOOST_AUTO_TEST_CASE(it_parses_a_sha256_hash_string)
 {
     const std::vector<unsigned char> expected {
@@ -2825,3 +2991,210 @@ BOOST_AUTO_TEST_CASE(it_deserializes_from_a_stream_for_md5)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// -----------------------------------------------------------------------------
+// ScraperStatsTable
+// -----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(ScraperStatsTable__Tables)
+
+BOOST_AUTO_TEST_CASE(it_converts_a_stats_map_into_sorted_tables)
+{
+    const ScraperStatsMeta meta;
+    const ScraperStatsTable stats = GetTestScraperStats(meta).mScraperStats;
+
+    BOOST_CHECK(!stats.NetworkWide());
+    BOOST_REQUIRE_EQUAL(stats.size(), (size_t) 9);
+
+    BOOST_REQUIRE_EQUAL(stats.Projects().size(), (size_t) 2);
+    BOOST_CHECK_EQUAL(stats.ProjectName(0), meta.project1);
+    BOOST_CHECK_EQUAL(stats.ProjectName(1), meta.project2);
+
+    BOOST_REQUIRE_EQUAL(stats.ByCPID().size(), (size_t) 3);
+    BOOST_CHECK(stats.ByCPID()[0].cpid == meta.cpid1);
+    BOOST_CHECK(stats.ByCPID()[1].cpid == meta.cpid2);
+    BOOST_CHECK(stats.ByCPID()[2].cpid == meta.cpid3);
+    BOOST_CHECK_EQUAL(stats.ByCPID()[0].statsvalue.dMag, meta.c1_mag);
+
+    BOOST_REQUIRE_EQUAL(stats.ByProject().size(), (size_t) 2);
+    BOOST_CHECK_EQUAL(stats.ByProject()[0].project, 0u);
+    BOOST_CHECK_EQUAL(stats.ByProject()[0].statsvalue.dTC, meta.p1_tc);
+    BOOST_CHECK_EQUAL(stats.ByProject()[1].project, 1u);
+    BOOST_CHECK_EQUAL(stats.ByProject()[1].statsvalue.dTC, meta.p2_tc);
+
+    BOOST_REQUIRE_EQUAL(stats.ByCPIDbyProject().size(), (size_t) 4);
+    BOOST_REQUIRE(stats.Find(1, meta.cpid2) != nullptr);
+    BOOST_CHECK_EQUAL(stats.Find(1, meta.cpid2)->statsvalue.dRAC, meta.p2c2_rac);
+    BOOST_CHECK(stats.Find(0, meta.cpid3) == nullptr);
+    BOOST_CHECK(stats.Find(2, meta.cpid1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(it_converts_back_to_the_same_stats_map)
+{
+    ScraperStats expected;
+
+    const auto add = [&](statsobjecttype objecttype, std::string object_id, double value) {
+        ScraperObjectStats entry {};
+        entry.statskey = { objecttype, std::move(object_id) };
+        entry.statsvalue.dTC = value;
+        entry.statsvalue.dMag = value / 10;
+
+        expected.emplace(entry.statskey, entry);
+    };
+
+    // Project names that share a prefix exercise the key order of the map:
+    add(statsobjecttype::NetworkWide, "", 100);
+    add(statsobjecttype::byCPID, "ffeeddccbbaa99887766554433221100", 1);
+    add(statsobjecttype::byCPID, "00112233445566778899aabbccddeeff", 2);
+    add(statsobjecttype::byProject, "seti", 3);
+    add(statsobjecttype::byProject, "seti_beta", 4);
+    add(statsobjecttype::byCPIDbyProject, "seti_beta,00112233445566778899aabbccddeeff", 5);
+    add(statsobjecttype::byCPIDbyProject, "seti,ffeeddccbbaa99887766554433221100", 6);
+    add(statsobjecttype::byCPIDbyProject, "seti,00112233445566778899aabbccddeeff", 7);
+
+    const ScraperStats stats = ScraperStatsTable(expected).ToMap();
+
+    BOOST_REQUIRE_EQUAL(stats.size(), expected.size());
+
+    auto expected_iter = expected.begin();
+
+    for (const auto& entry : stats) {
+        BOOST_CHECK(entry.first.objecttype == expected_iter->first.objecttype);
+        BOOST_CHECK(entry.second.statskey.objecttype == expected_iter->first.objecttype);
+        BOOST_CHECK_EQUAL(entry.first.objectID, expected_iter->first.objectID);
+        BOOST_CHECK_EQUAL(entry.second.statskey.objectID, expected_iter->first.objectID);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dTC, expected_iter->second.statsvalue.dTC);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dMag, expected_iter->second.statsvalue.dMag);
+        ++expected_iter;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(it_orders_the_tables_like_the_map_for_names_that_share_a_prefix)
+{
+    const GRC::Cpid cpid1 = GRC::Cpid::Parse("00112233445566778899aabbccddeeff");
+    const GRC::Cpid cpid2 = GRC::Cpid::Parse("ffeeddccbbaa99887766554433221100");
+
+    ScraperStats expected;
+    ScraperObjectStatsValue statsvalue {};
+
+    const auto add = [&](statsobjecttype objecttype, std::string object_id) {
+        ScraperObjectStats entry {};
+        entry.statskey = { objecttype, std::move(object_id) };
+
+        expected.emplace(entry.statskey, entry);
+    };
+
+    // The space sorts before the comma, so "foo bar,..." sorts before "foo,..."
+    // while "foo" sorts before "foo bar":
+    add(statsobjecttype::byProject, "foo");
+    add(statsobjecttype::byProject, "foo bar");
+    add(statsobjecttype::byCPIDbyProject, "foo," + cpid1.ToString());
+    add(statsobjecttype::byCPIDbyProject, "foo bar," + cpid1.ToString());
+    add(statsobjecttype::byCPIDbyProject, "foo bar," + cpid2.ToString());
+
+    const auto table_rows = [](const ScraperStatsTable& table) {
+        std::vector<std::string> rows;
+
+        for (const auto& entry : table.ByProject()) {
+            rows.push_back(table.ProjectName(entry.project));
+        }
+
+        for (const auto& entry : table.ByCPIDbyProject()) {
+            rows.push_back(table.ProjectName(entry.project) + "," + entry.cpid.ToString());
+        }
+
+        return rows;
+    };
+
+    const std::vector<std::string> expected_rows {
+        "foo",
+        "foo bar",
+        "foo bar," + cpid1.ToString(),
+        "foo bar," + cpid2.ToString(),
+        "foo," + cpid1.ToString(),
+    };
+
+    std::vector<std::string> map_rows;
+
+    for (const auto& entry : expected) {
+        map_rows.push_back(entry.first.objectID);
+    }
+
+    BOOST_CHECK(map_rows == expected_rows);
+
+    const ScraperStatsTable converted(expected);
+    const std::vector<std::string> converted_rows = table_rows(converted);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        converted_rows.begin(), converted_rows.end(),
+        expected_rows.begin(), expected_rows.end());
+
+    BOOST_REQUIRE(converted.Find(0, cpid1) != nullptr);
+    BOOST_CHECK_EQUAL(converted.ProjectName(0), "foo bar");
+
+    // Adding the projects in either order produces the same tables:
+    ScraperStatsTable in_order;
+    in_order.AddProject("foo", statsvalue, { { cpid1, statsvalue } });
+    in_order.AddProject("foo bar", statsvalue, { { cpid1, statsvalue }, { cpid2, statsvalue } });
+
+    ScraperStatsTable out_of_order;
+    out_of_order.AddProject("foo bar", statsvalue, { { cpid1, statsvalue }, { cpid2, statsvalue } });
+    out_of_order.AddProject("foo", statsvalue, { { cpid1, statsvalue } });
+
+    for (const ScraperStatsTable* table : { &in_order, &out_of_order }) {
+        const std::vector<std::string> rows = table_rows(*table);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(rows.begin(), rows.end(), expected_rows.begin(), expected_rows.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(it_merges_projects_in_any_order_like_a_map)
+{
+    const auto project_stats = [](const std::string& project, const double value) {
+        ScraperStatsTable table;
+        ScraperObjectStatsValue statsvalue {};
+        statsvalue.dTC = value;
+
+        table.AddProject(project, statsvalue, {
+            { GRC::Cpid::Parse("00112233445566778899aabbccddeeff"), statsvalue },
+            { GRC::Cpid::Parse("ffeeddccbbaa99887766554433221100"), statsvalue },
+        });
+
+        return table;
+    };
+
+    ScraperStatsTable in_order;
+    in_order.Merge(project_stats("a", 1));
+    in_order.Merge(project_stats("b", 2));
+    in_order.Merge(project_stats("c", 3));
+
+    ScraperStatsTable out_of_order;
+    out_of_order.Merge(project_stats("c", 3));
+    out_of_order.Merge(project_stats("a", 1));
+    out_of_order.Merge(project_stats("b", 2));
+
+    // Like std::map::merge, the entries of a project already present remain:
+    out_of_order.Merge(project_stats("a", 4));
+
+    const ScraperStats expected = in_order.ToMap();
+    const ScraperStats stats = out_of_order.ToMap();
+
+    BOOST_REQUIRE_EQUAL(in_order.size(), (size_t) 9);
+    BOOST_REQUIRE_EQUAL(out_of_order.size(), (size_t) 9);
+    BOOST_REQUIRE_EQUAL(stats.size(), expected.size());
+
+    auto expected_iter = expected.begin();
+
+    for (const auto& entry : stats) {
+        BOOST_CHECK(entry.first.objecttype == expected_iter->first.objecttype);
+        BOOST_CHECK_EQUAL(entry.first.objectID, expected_iter->first.objectID);
+        BOOST_CHECK_EQUAL(entry.second.statsvalue.dTC, expected_iter->second.statsvalue.dTC);
+        ++expected_iter;
+    }
+
+    BOOST_REQUIRE_EQUAL(out_of_order.Projects().size(), (size_t) 3);
+    BOOST_CHECK_EQUAL(out_of_order.ProjectName(2), "c");
+    BOOST_CHECK_EQUAL(out_of_order.Find(2, GRC::Cpid::Parse("ffeeddccbbaa99887766554433221100"))->statsvalue.dTC, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
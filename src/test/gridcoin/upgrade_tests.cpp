@@ -0,0 +1,390 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "compat.h"
+#include "crypto/sha256.h"
+#include "gridcoin/scraper/http.h"
+#include "gridcoin/upgrade.h"
+#include "util.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <zip.h>
+
+namespace {
+//!
+//! \brief Serves one file over HTTP on the loopback interface as a stand-in
+//! for the snapshot server.
+//!
+//! Supports open-ended range requests with an If-Range condition like the
+//! snapshot CDN does. Each connection handles a single request.
+//!
+class LocalHttpServer
+{
+public:
+    LocalHttpServer(std::string body, std::string etag)
+        : m_body(std::move(body))
+        , m_etag(std::move(etag))
+    {
+#ifdef WIN32
+        WSADATA wsadata;
+        WSAStartup(MAKEWORD(2, 2), &wsadata);
+#endif
+        m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        BOOST_REQUIRE(m_socket != INVALID_SOCKET);
+
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+
+        BOOST_REQUIRE(bind(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+        BOOST_REQUIRE(listen(m_socket, 4) == 0);
+
+        socklen_t len = sizeof(addr);
+        BOOST_REQUIRE(getsockname(m_socket, reinterpret_cast<sockaddr*>(&addr), &len) == 0);
+        m_port = ntohs(addr.sin_port);
+
+        m_thread = std::thread([this]() { Serve(); });
+    }
+
+    ~LocalHttpServer()
+    {
+        m_stop = true;
+
+        // Wake the accept() call with a connection of our own:
+        SOCKET wake = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(m_port);
+        connect(wake, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        closesocket(wake);
+
+        m_thread.join();
+        closesocket(m_socket);
+    }
+
+    std::string Url() const
+    {
+        return strprintf("http://127.0.0.1:%d/snapshot.zip", m_port);
+    }
+
+    //!
+    //! \brief Replace the file. The next response carries the new content.
+    //!
+    void SetBody(std::string body, std::string etag)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_body = std::move(body);
+        m_etag = std::move(etag);
+    }
+
+    //!
+    //! \brief Drop the connection of the next response after \p bytes of the
+    //! body.
+    //!
+    void CutNextResponseAfter(size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cut_after = bytes;
+    }
+
+    //!
+    //! \brief Get the start offsets of the range requests that the server
+    //! answered with partial content.
+    //!
+    std::vector<size_t> PartialResponses()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_partial_responses;
+    }
+
+private:
+    SOCKET m_socket = INVALID_SOCKET;
+    uint16_t m_port = 0;
+    std::thread m_thread;
+    std::atomic<bool> m_stop { false };
+
+    std::mutex m_mutex;
+    std::string m_body;
+    std::string m_etag;
+    size_t m_cut_after = 0;
+    std::vector<size_t> m_partial_responses;
+
+    void Serve()
+    {
+        while (!m_stop) {
+            SOCKET client = accept(m_socket, nullptr, nullptr);
+
+            if (client == INVALID_SOCKET) {
+                continue;
+            }
+
+            if (!m_stop) {
+                Respond(client);
+            }
+
+            closesocket(client);
+        }
+    }
+
+    void Respond(SOCKET client)
+    {
+        std::string request;
+        char buffer[1024];
+
+        while (request.find("\r\n\r\n") == std::string::npos) {
+            const int received = recv(client, buffer, sizeof(buffer), 0);
+
+            if (received <= 0) return;
+
+            request.append(buffer, received);
+        }
+
+        std::map<std::string, std::string> headers;
+        std::istringstream lines(request);
+
+        for (std::string line; std::getline(lines, line);) {
+            const size_t colon = line.find(':');
+
+            if (colon == std::string::npos) continue;
+
+            std::string value = line.substr(colon + 1);
+            value.erase(0, value.find_first_not_of(' '));
+            value.erase(value.find_last_not_of("\r") + 1);
+
+            headers[ToLower(line.substr(0, colon))] = value;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        const std::string body = m_body;
+        const std::string etag = "\"" + m_etag + "\"";
+        const size_t cut_after = std::exchange(m_cut_after, 0);
+
+        size_t start = 0;
+        std::string status = "200 OK";
+        std::string extra_headers;
+
+        if (headers.count("range") && (!headers.count("if-range") || headers["if-range"] == etag)) {
+            start = std::stoul(headers["range"].substr(6)); // "bytes=N-"
+
+            if (start >= body.size()) {
+                lock.unlock();
+                Send(client, "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+                return;
+            }
+
+            status = "206 Partial Content";
+            extra_headers = strprintf("Content-Range: bytes %d-%d/%d\r\n", start, body.size() - 1, body.size());
+            m_partial_responses.push_back(start);
+        }
+
+        lock.unlock();
+
+        Send(client, strprintf(
+            "HTTP/1.1 %s\r\nContent-Length: %d\r\nETag: %s\r\n%sConnection: close\r\n\r\n",
+            status, body.size() - start, etag, extra_headers));
+
+        const size_t end = cut_after > 0 ? start + cut_after : body.size();
+        Send(client, body.substr(start, end - start));
+    }
+
+    static void Send(SOCKET client, const std::string& data)
+    {
+        for (size_t sent = 0; sent < data.size();) {
+            const int result = send(client, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+
+            if (result <= 0) return;
+
+            sent += result;
+        }
+    }
+};
+
+//!
+//! \brief Get file content that does not compress to nothing.
+//!
+std::string MakeFileContent(const size_t size, const uint8_t seed)
+{
+    std::string content(size, '\0');
+
+    for (size_t i = 0; i < size; ++i) {
+        content[i] = static_cast<char>((i * 7919 + seed) ^ (i >> 8));
+    }
+
+    return content;
+}
+
+std::string Sha256Hex(const std::string& data)
+{
+    uint8_t digest[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(reinterpret_cast<const uint8_t*>(data.data()), data.size()).Finalize(digest);
+
+    return HexStr(digest);
+}
+
+std::string ReadFile(const fs::path& path)
+{
+    fsbridge::ifstream file(path, std::ios::binary);
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//!
+//! \brief Provides a scratch directory in the test data directory.
+//!
+struct UpgradeFixture
+{
+    fs::path m_dir;
+
+    UpgradeFixture()
+        : m_dir(GetDataDir() / "upgrade_tests")
+    {
+        fs::remove_all(m_dir);
+        fs::create_directories(m_dir);
+
+        DownloadStatus.Reset();
+        GRC::ExtractStatus.Reset();
+    }
+
+    ~UpgradeFixture()
+    {
+        fs::remove_all(m_dir);
+    }
+};
+} // Anonymous namespace
+
+BOOST_FIXTURE_TEST_SUITE(upgrade_tests, UpgradeFixture)
+
+BOOST_AUTO_TEST_CASE(it_hashes_the_snapshot_while_downloading)
+{
+    const std::string body = MakeFileContent(300000, 1);
+    LocalHttpServer server(body, "v1");
+
+    const fs::path destination = m_dir / "snapshot.zip";
+    const std::string digest = Http().DownloadResumable(server.Url(), destination);
+
+    BOOST_CHECK_EQUAL(digest, Sha256Hex(body));
+    BOOST_CHECK(ReadFile(destination) == body);
+    BOOST_CHECK(!fs::exists(destination.string() + ".part"));
+    BOOST_CHECK(!fs::exists(destination.string() + ".etag"));
+    BOOST_CHECK(server.PartialResponses().empty());
+}
+
+BOOST_AUTO_TEST_CASE(it_resumes_an_interrupted_download)
+{
+    const std::string body = MakeFileContent(300000, 2);
+    LocalHttpServer server(body, "v1");
+
+    const fs::path destination = m_dir / "snapshot.zip";
+
+    server.CutNextResponseAfter(100000);
+    BOOST_CHECK_THROW(Http().DownloadResumable(server.Url(), destination), std::runtime_error);
+
+    BOOST_CHECK(!fs::exists(destination));
+    BOOST_CHECK_EQUAL(fs::file_size(destination.string() + ".part"), 100000);
+
+    const std::string digest = Http().DownloadResumable(server.Url(), destination);
+
+    BOOST_CHECK_EQUAL(digest, Sha256Hex(body));
+    BOOST_CHECK(ReadFile(destination) == body);
+    BOOST_REQUIRE_EQUAL(server.PartialResponses().size(), 1);
+    BOOST_CHECK_EQUAL(server.PartialResponses()[0], 100000);
+}
+
+BOOST_AUTO_TEST_CASE(it_starts_over_when_the_snapshot_changes)
+{
+    LocalHttpServer server(MakeFileContent(300000, 3), "v1");
+
+    const fs::path destination = m_dir / "snapshot.zip";
+
+    server.CutNextResponseAfter(100000);
+    BOOST_CHECK_THROW(Http().DownloadResumable(server.Url(), destination), std::runtime_error);
+
+    const std::string body = MakeFileContent(250000, 4);
+    server.SetBody(body, "v2");
+
+    const std::string digest = Http().DownloadResumable(server.Url(), destination);
+
+    BOOST_CHECK_EQUAL(digest, Sha256Hex(body));
+    BOOST_CHECK(ReadFile(destination) == body);
+    BOOST_CHECK(server.PartialResponses().empty());
+}
+
+BOOST_AUTO_TEST_CASE(it_downloads_and_extracts_a_snapshot)
+{
+    const std::map<std::string, std::string> files {
+        { "blk0001.dat", MakeFileContent(1500000, 5) },
+        { "txleveldb/000001.ldb", MakeFileContent(400000, 6) },
+        { "txleveldb/CURRENT", "MANIFEST-000002\n" },
+        { "accrual/registry.dat", MakeFileContent(1000, 7) },
+    };
+
+    const fs::path fixture = m_dir / "fixture.zip";
+
+    {
+        int ze = 0;
+        zip_t* archive = zip_open(fixture.string().c_str(), ZIP_CREATE | ZIP_TRUNCATE, &ze);
+        BOOST_REQUIRE(archive != nullptr);
+
+        // "accrual/" has no directory entry on purpose.
+        BOOST_REQUIRE(zip_dir_add(archive, "txleveldb", 0) >= 0);
+
+        for (const auto& file : files) {
+            zip_source_t* source = zip_source_buffer(archive, file.second.data(), file.second.size(), 0);
+            BOOST_REQUIRE(source != nullptr);
+            BOOST_REQUIRE(zip_file_add(archive, file.first.c_str(), source, ZIP_FL_OVERWRITE) >= 0);
+        }
+
+        BOOST_REQUIRE(zip_close(archive) == 0);
+    }
+
+    const std::string archive_bytes = ReadFile(fixture);
+    LocalHttpServer server(archive_bytes, "snapshot");
+
+    const fs::path destination = m_dir / "snapshot.zip";
+    const fs::path data_dir = m_dir / "data";
+
+    const std::string digest = Http().DownloadResumable(server.Url(), destination);
+    BOOST_CHECK_EQUAL(digest, Sha256Hex(archive_bytes));
+
+    GRC::Upgrade::ExtractSnapshot(destination, data_dir);
+
+    BOOST_CHECK(GRC::ExtractStatus.GetSnapshotExtractComplete());
+    BOOST_CHECK(!GRC::ExtractStatus.GetSnapshotExtractFailed());
+    BOOST_CHECK_EQUAL(GRC::ExtractStatus.GetSnapshotExtractProgress(), 100);
+
+    for (const auto& file : files) {
+        BOOST_CHECK_MESSAGE(ReadFile(data_dir / file.first) == file.second, file.first);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(it_rejects_a_snapshot_without_entries)
+{
+    const fs::path archive = m_dir / "empty.zip";
+
+    {
+        int ze = 0;
+        zip_t* zip_archive = zip_open(archive.string().c_str(), ZIP_CREATE | ZIP_TRUNCATE, &ze);
+        BOOST_REQUIRE(zip_archive != nullptr);
+        BOOST_REQUIRE(zip_dir_add(zip_archive, "empty", 0) >= 0);
+        BOOST_REQUIRE(zip_close(zip_archive) == 0);
+    }
+
+    GRC::Upgrade::ExtractSnapshot(archive, m_dir / "data");
+
+    BOOST_CHECK(GRC::ExtractStatus.GetSnapshotZipInvalid());
+    BOOST_CHECK(!GRC::ExtractStatus.GetSnapshotExtractComplete());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
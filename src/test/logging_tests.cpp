@@ -0,0 +1,123 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include <logging/writer.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(logging_tests)
+
+BOOST_AUTO_TEST_CASE(log_ring_preserves_order_and_bounds)
+{
+    BCLog::LogRing ring(3);
+
+    BOOST_CHECK_EQUAL(ring.Capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK(ring.TryPush(std::to_string(i)));
+    }
+
+    std::string overflow = "overflow";
+    BOOST_CHECK(!ring.TryPush(std::move(overflow)));
+    BOOST_CHECK_EQUAL(overflow, "overflow"); // Not moved from when rejected.
+
+    std::string line;
+    for (int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE(ring.TryPop(line));
+        BOOST_CHECK_EQUAL(line, std::to_string(i));
+    }
+
+    BOOST_CHECK(!ring.TryPop(line));
+
+    // The cells are reusable after they wrap around:
+    BOOST_CHECK(ring.TryPush("again"));
+    BOOST_REQUIRE(ring.TryPop(line));
+    BOOST_CHECK_EQUAL(line, "again");
+}
+
+BOOST_AUTO_TEST_CASE(background_writer_writes_every_line_by_stop)
+{
+    std::mutex mutex;
+    std::vector<std::string> written;
+    uint64_t dropped = 0;
+
+    BCLog::BackgroundWriter writer(
+        1 << 16,
+        [&](const std::vector<std::string>& lines, uint64_t batch_dropped) {
+            std::lock_guard<std::mutex> lock(mutex);
+            written.insert(written.end(), lines.begin(), lines.end());
+            dropped += batch_dropped;
+        },
+        "test-logger");
+
+    constexpr int THREADS = 4;
+    constexpr int LINES = 1000;
+
+    std::vector<std::thread> producers;
+
+    for (int t = 0; t < THREADS; ++t) {
+        producers.emplace_back([&writer, t] {
+            for (int i = 0; i < LINES; ++i) {
+                writer.Submit(std::to_string(t) + ":" + std::to_string(i));
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    writer.Stop();
+
+    BOOST_CHECK_EQUAL(written.size(), static_cast<size_t>(THREADS * LINES));
+    BOOST_CHECK_EQUAL(dropped, 0u);
+    BOOST_CHECK(!writer.Submit("after stop"));
+
+    // Lines of one producer stay in the order that it submitted them:
+    std::vector<int> next(THREADS, 0);
+    for (const auto& line : written) {
+        const size_t separator = line.find(':');
+        const int t = std::stoi(line.substr(0, separator));
+        BOOST_CHECK_EQUAL(std::stoi(line.substr(separator + 1)), next[t]++);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(background_writer_counts_dropped_lines)
+{
+    std::mutex sink_mutex;
+    sink_mutex.lock(); // Hold the writer in its first batch.
+
+    uint64_t lines_written = 0;
+    uint64_t dropped = 0;
+
+    BCLog::BackgroundWriter writer(
+        2,
+        [&](const std::vector<std::string>& lines, uint64_t batch_dropped) {
+            std::lock_guard<std::mutex> lock(sink_mutex);
+            lines_written += lines.size();
+            dropped += batch_dropped;
+        },
+        "test-logger");
+
+    uint64_t submitted = 0;
+    while (writer.Dropped() == 0) {
+        BOOST_CHECK(writer.Submit("line"));
+        ++submitted;
+    }
+
+    sink_mutex.unlock();
+    writer.Flush();
+    writer.Stop();
+
+    BOOST_CHECK_EQUAL(writer.Dropped(), 1u);
+    BOOST_CHECK_EQUAL(dropped, 1u);
+    BOOST_CHECK_EQUAL(lines_written + dropped, submitted);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
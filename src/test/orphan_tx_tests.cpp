@@ -0,0 +1,273 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include "node/orphan_txs.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+//! Create a minimal test transaction that spends the given outputs and has
+//! \p outputs outputs. The lock time makes each transaction hash unique.
+CTransaction MakeTestTx(const std::vector<COutPoint>& prevouts, uint32_t unique_id, size_t outputs = 1)
+{
+    CTransaction tx;
+    tx.nTime = 1700000000;
+    tx.nLockTime = unique_id;
+
+    for (const auto& prevout : prevouts) {
+        tx.vin.emplace_back(prevout);
+    }
+
+    tx.vout.resize(outputs);
+    for (auto& txout : tx.vout) {
+        txout.nValue = 1;
+    }
+
+    return tx;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(orphan_tx_tests)
+
+// ---------------------------------------------------------------------------
+// Basic add / contains / size accounting
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(add_and_contains)
+{
+    OrphanTxManager mgr;
+
+    CTransaction tx = MakeTestTx({COutPoint(uint256(1), 0)}, 1);
+    uint256 hash = tx.GetHash();
+
+    BOOST_CHECK(mgr.Add(tx, 0, 1000));
+    BOOST_CHECK(mgr.Contains(hash));
+    BOOST_CHECK(mgr.Get(hash) != nullptr);
+    BOOST_CHECK_EQUAL(mgr.Size(), 1u);
+    BOOST_CHECK_EQUAL(mgr.Bytes(), GetSerializeSize(tx, SER_NETWORK, CTransaction::CURRENT_VERSION));
+
+    // Duplicate rejected.
+    BOOST_CHECK(!mgr.Add(tx, 0, 1000));
+    BOOST_CHECK_EQUAL(mgr.Size(), 1u);
+
+    BOOST_CHECK(mgr.Erase(hash));
+    BOOST_CHECK(!mgr.Contains(hash));
+    BOOST_CHECK_EQUAL(mgr.Bytes(), 0u);
+    BOOST_CHECK(!mgr.Erase(hash));
+}
+
+BOOST_AUTO_TEST_CASE(rejects_large_orphans)
+{
+    OrphanTxManager mgr;
+
+    std::vector<COutPoint> prevouts;
+    for (uint32_t i = 0; i < 200; ++i) {
+        prevouts.emplace_back(uint256(1), i);
+    }
+
+    CTransaction tx = MakeTestTx(prevouts, 1);
+
+    BOOST_CHECK(GetSerializeSize(tx, SER_NETWORK, CTransaction::CURRENT_VERSION)
+                > OrphanTxManager::MAX_ORPHAN_TX_SIZE);
+    BOOST_CHECK(!mgr.Add(tx, 0, 1000));
+    BOOST_CHECK_EQUAL(mgr.Size(), 0u);
+    BOOST_CHECK_EQUAL(mgr.GetStats().rejected, 1u);
+}
+
+// ---------------------------------------------------------------------------
+// Outpoint-indexed processing
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(process_queue_chain)
+{
+    OrphanTxManager mgr;
+
+    // Build a chain: A -> B -> C. A is the accepted parent (not an orphan).
+    // B spends output 1 of A, so the index must match more than output 0.
+    CTransaction tx_a = MakeTestTx({COutPoint(uint256(1), 0)}, 10, 2);
+    uint256 hash_a = tx_a.GetHash();
+
+    CTransaction tx_b = MakeTestTx({COutPoint(hash_a, 1)}, 11);
+    uint256 hash_b = tx_b.GetHash();
+
+    CTransaction tx_c = MakeTestTx({COutPoint(hash_b, 0)}, 12);
+    uint256 hash_c = tx_c.GetHash();
+
+    // An unrelated orphan stays in the pool.
+    CTransaction tx_x = MakeTestTx({COutPoint(uint256(2), 0)}, 13);
+
+    mgr.Add(tx_c, 0, 1000);
+    mgr.Add(tx_b, 0, 1000);
+    mgr.Add(tx_x, 0, 1000);
+
+    std::vector<uint256> accepted;
+    size_t count = mgr.ProcessQueue(hash_a, [&](CTransaction& tx, bool& missing_inputs) {
+        accepted.push_back(tx.GetHash());
+        return true;
+    });
+
+    BOOST_CHECK_EQUAL(count, 2u);
+    BOOST_REQUIRE_EQUAL(accepted.size(), 2u);
+    BOOST_CHECK(accepted[0] == hash_b);
+    BOOST_CHECK(accepted[1] == hash_c);
+    BOOST_CHECK_EQUAL(mgr.Size(), 1u);
+    BOOST_CHECK(mgr.Contains(tx_x.GetHash()));
+    BOOST_CHECK_EQUAL(mgr.GetStats().accepted, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(process_queue_missing_inputs_keeps_orphan)
+{
+    OrphanTxManager mgr;
+
+    CTransaction tx_a = MakeTestTx({COutPoint(uint256(1), 0)}, 20);
+    uint256 hash_a = tx_a.GetHash();
+
+    // B spends A and another transaction that has not arrived yet.
+    CTransaction tx_b = MakeTestTx({COutPoint(hash_a, 0), COutPoint(uint256(3), 0)}, 21);
+    uint256 hash_b = tx_b.GetHash();
+
+    mgr.Add(tx_b, 0, 1000);
+
+    size_t count = mgr.ProcessQueue(hash_a, [](CTransaction& tx, bool& missing_inputs) {
+        missing_inputs = true;
+        return false;
+    });
+
+    BOOST_CHECK_EQUAL(count, 0u);
+    BOOST_CHECK(mgr.Contains(hash_b));
+
+    // When the other parent arrives, an invalid orphan is removed.
+    count = mgr.ProcessQueue(uint256(3), [](CTransaction& tx, bool& missing_inputs) {
+        return false;
+    });
+
+    BOOST_CHECK_EQUAL(count, 0u);
+    BOOST_CHECK(!mgr.Contains(hash_b));
+    BOOST_CHECK_EQUAL(mgr.GetStats().invalid, 1u);
+}
+
+// ---------------------------------------------------------------------------
+// Size cap and eviction
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(limit_size_by_count_and_bytes)
+{
+    OrphanTxManager mgr;
+
+    for (uint32_t i = 0; i < 20; ++i) {
+        mgr.Add(MakeTestTx({COutPoint(uint256(i + 1), 0)}, i), 0, 1000);
+    }
+
+    BOOST_CHECK_EQUAL(mgr.Size(), 20u);
+
+    const size_t tx_size = mgr.Bytes() / mgr.Size();
+
+    BOOST_CHECK_EQUAL(mgr.LimitSize(15), 5u);
+    BOOST_CHECK_EQUAL(mgr.Size(), 15u);
+
+    BOOST_CHECK_EQUAL(mgr.LimitSize(100, tx_size * 10), 5u);
+    BOOST_CHECK_EQUAL(mgr.Size(), 10u);
+    BOOST_CHECK_EQUAL(mgr.Bytes(), tx_size * 10);
+    BOOST_CHECK_EQUAL(mgr.GetStats().evicted, 10u);
+}
+
+// ---------------------------------------------------------------------------
+// Time- and peer-based expiry
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(expire_old_orphans)
+{
+    OrphanTxManager mgr;
+
+    CTransaction tx_old = MakeTestTx({COutPoint(uint256(1), 0)}, 30);
+    CTransaction tx_new = MakeTestTx({COutPoint(uint256(1), 0)}, 31);
+
+    mgr.Add(tx_old, 0, 1000);
+    mgr.Add(tx_new, 0, 1000 + OrphanTxManager::MAX_ORPHAN_AGE_SECONDS);
+
+    BOOST_CHECK_EQUAL(mgr.EraseExpired(1001 + OrphanTxManager::MAX_ORPHAN_AGE_SECONDS), 1u);
+    BOOST_CHECK(!mgr.Contains(tx_old.GetHash()));
+    BOOST_CHECK(mgr.Contains(tx_new.GetHash()));
+
+    // The outpoint index no longer refers to the expired orphan.
+    size_t calls = 0;
+    mgr.ProcessQueue(uint256(1), [&](CTransaction& tx, bool& missing_inputs) {
+        ++calls;
+        return true;
+    });
+
+    BOOST_CHECK_EQUAL(calls, 1u);
+    BOOST_CHECK_EQUAL(mgr.Size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(erase_for_peer)
+{
+    OrphanTxManager mgr;
+
+    mgr.Add(MakeTestTx({COutPoint(uint256(1), 0)}, 40), 7, 1000);
+    mgr.Add(MakeTestTx({COutPoint(uint256(2), 0)}, 41), 7, 1000);
+    mgr.Add(MakeTestTx({COutPoint(uint256(3), 0)}, 42), 8, 1000);
+
+    BOOST_CHECK_EQUAL(mgr.EraseForPeer(7), 2u);
+    BOOST_CHECK_EQUAL(mgr.Size(), 1u);
+    BOOST_CHECK_EQUAL(mgr.EraseForPeer(7), 0u);
+    BOOST_CHECK_EQUAL(mgr.GetStats().peer_erased, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(expiry_and_peer_erasure_keep_indices_in_sync)
+{
+    OrphanTxManager mgr;
+
+    CTransaction tx_a = MakeTestTx({COutPoint(uint256(1), 0)}, 60);
+    CTransaction tx_b = MakeTestTx({COutPoint(uint256(2), 0)}, 61);
+    CTransaction tx_c = MakeTestTx({COutPoint(uint256(3), 0)}, 62);
+    CTransaction tx_d = MakeTestTx({COutPoint(uint256(4), 0)}, 63);
+
+    // Received out of time order from two peers:
+    mgr.Add(tx_a, 7, 1300);
+    mgr.Add(tx_b, 8, 1000);
+    mgr.Add(tx_c, 7, 1200);
+    mgr.Add(tx_d, 8, 1400);
+
+    // Dropping a peer removes its orphans from the time index too, so expiry
+    // does not count them again.
+    BOOST_CHECK_EQUAL(mgr.EraseForPeer(8), 2u);
+    BOOST_CHECK_EQUAL(mgr.EraseExpired(1350 + OrphanTxManager::MAX_ORPHAN_AGE_SECONDS), 2u);
+    BOOST_CHECK_EQUAL(mgr.Size(), 0u);
+
+    // Expiry removes orphans from the peer index too.
+    mgr.Add(tx_a, 7, 1000);
+    mgr.Add(tx_b, 7, 2000);
+
+    BOOST_CHECK_EQUAL(mgr.EraseExpired(1001 + OrphanTxManager::MAX_ORPHAN_AGE_SECONDS), 1u);
+    BOOST_CHECK(mgr.Contains(tx_b.GetHash()));
+    BOOST_CHECK(mgr.Erase(tx_b.GetHash()));
+    BOOST_CHECK_EQUAL(mgr.EraseForPeer(7), 0u);
+
+    BOOST_CHECK_EQUAL(mgr.GetStats().expired, 3u);
+    BOOST_CHECK_EQUAL(mgr.GetStats().peer_erased, 2u);
+}
+
+// ---------------------------------------------------------------------------
+// Edge cases
+// ---------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(clear_empties_everything)
+{
+    OrphanTxManager mgr;
+
+    mgr.Add(MakeTestTx({COutPoint(uint256(1), 0)}, 50), 0, 1000);
+    mgr.Add(MakeTestTx({COutPoint(uint256(2), 0)}, 51), 0, 1000);
+
+    mgr.Clear();
+
+    BOOST_CHECK_EQUAL(mgr.Size(), 0u);
+    BOOST_CHECK_EQUAL(mgr.Bytes(), 0u);
+    BOOST_CHECK_EQUAL(mgr.GetStats().added, 2u);
+    BOOST_CHECK_EQUAL(mgr.ProcessQueue(uint256(1), [](CTransaction&, bool&) { return true; }), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
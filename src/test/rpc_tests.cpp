@@ -4,16 +4,63 @@
 #include <key_io.h>
 #include <util.h>
 
+#include <rpc/blockchain.h>
 #include <rpc/client.h>
 #include <rpc/protocol.h>
 #include <rpc/server.h>
+#include <rpc/work_queue.h>
 
 #include <univalue.h>
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 
 using namespace std;
 
+namespace {
+using TcpConnection = AcceptedConnectionImpl<boost::asio::ip::tcp>;
+
+//!
+//! \brief An RPC server connection and the client end of its socket.
+//!
+struct LoopbackConnection
+{
+    ioContext m_io_context;
+    boost::asio::ssl::context m_ssl_context { boost::asio::ssl::context::sslv23 };
+    std::shared_ptr<TcpConnection> m_conn;
+    boost::asio::ip::tcp::socket m_client;
+
+    LoopbackConnection()
+        : m_conn(std::make_shared<TcpConnection>(m_io_context, m_ssl_context, false))
+        , m_client(m_io_context)
+    {
+        boost::asio::ip::tcp::acceptor acceptor(
+            m_io_context,
+            boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+
+        m_client.connect(acceptor.local_endpoint());
+        acceptor.accept(m_conn->sslStream.lowest_layer());
+    }
+
+    //!
+    //! \brief Run the handlers of the connection until none are pending.
+    //!
+    void Run()
+    {
+#if BOOST_VERSION >= 107000
+        m_io_context.restart();
+#else
+        m_io_context.reset();
+#endif
+        m_io_context.run();
+    }
+};
+} // Anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(rpc_tests)
 
 static UniValue
@@ -118,4 +165,258 @@ BOOST_AUTO_TEST_CASE(rpc_parse_monetary_values)
     BOOST_CHECK_EQUAL(AmountFromValue(ValueFromString("20999999.99999999")), 2099999999999999LL);
 }
 
+BOOST_AUTO_TEST_CASE(rpc_batch_replies_in_request_order)
+{
+    // Mix runs of chain queries, which execute on several threads, with other
+    // calls, which execute alone, and with errors:
+    UniValue batch(UniValue::VARR);
+
+    for (int i = 0; i < 64; ++i) {
+        if (i % 8 == 7) {
+            batch.push_back(i);
+            continue;
+        }
+
+        UniValue request(UniValue::VOBJ);
+        UniValue params(UniValue::VARR);
+
+        if (i % 8 == 6) {
+            request.pushKV("method", "notarealmethod");
+        } else if (i % 2 == 0) {
+            request.pushKV("method", "getblockcount");
+        } else {
+            request.pushKV("method", "getblockhash");
+            params.push_back(-1);
+        }
+
+        request.pushKV("params", params);
+        request.pushKV("id", i);
+        batch.push_back(request);
+    }
+
+    UniValue replies;
+    BOOST_REQUIRE(replies.read(JSONRPCExecBatch(batch)));
+    BOOST_REQUIRE(replies.isArray());
+    BOOST_REQUIRE_EQUAL(replies.size(), batch.size());
+
+    for (int i = 0; i < 64; ++i) {
+        const UniValue& reply = replies[i];
+        const UniValue& error = find_value(reply, "error");
+
+        if (i % 8 == 7) {
+            BOOST_CHECK(find_value(reply, "id").isNull());
+            BOOST_CHECK_EQUAL(find_value(error, "code").get_int(), RPC_INVALID_REQUEST);
+            continue;
+        }
+
+        BOOST_CHECK_EQUAL(find_value(reply, "id").get_int(), i);
+
+        if (i % 8 == 6) {
+            BOOST_CHECK_EQUAL(find_value(error, "code").get_int(), RPC_METHOD_NOT_FOUND);
+        } else if (i % 2 == 0) {
+            BOOST_CHECK(error.isNull());
+            BOOST_CHECK(find_value(reply, "result").isNum());
+        } else {
+            BOOST_CHECK_EQUAL(find_value(error, "code").get_int(), RPC_MISC_ERROR);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rpc_block_json_matches_at_an_explicit_chain_position)
+{
+    // getblocksbatch converts a block in the best chain. getblock and
+    // exportblocks convert it at a position resolved beforehand. Both
+    // representations must contain the same keys in the same order:
+    const uint256 prev_hash = uint256S("0x01");
+    const uint256 next_hash = uint256S("0x02");
+
+    CBlockIndex prev;
+    prev.phashBlock = &prev_hash;
+
+    CBlockIndex next;
+    next.phashBlock = &next_hash;
+
+    CBlock block;
+    block.nVersion = 10;
+    block.nBits = 0x1e0fffff;
+    block.vtx.resize(1);
+    block.vtx[0].vin.resize(1);
+    block.vtx[0].vin[0].prevout.SetNull();
+    block.vtx[0].vout.emplace_back(10 * COIN, CScript() << OP_TRUE);
+
+    CBlockIndex blockindex;
+    blockindex.nVersion = block.nVersion;
+    blockindex.nBits = block.nBits;
+    blockindex.nHeight = 1;
+    blockindex.pprev = &prev;
+    blockindex.pnext = &next;
+
+    UniValue expected;
+
+    {
+        LOCK(cs_main);
+        expected = blockToJSON(block, &blockindex, true);
+    }
+
+    const int confirmations = find_value(expected, "confirmations").get_int();
+    const UniValue actual = blockToJSON(block, &blockindex, &next, confirmations, true);
+
+    const std::vector<std::string>& keys = actual.getKeys();
+    const auto claim_iter = std::find(keys.begin(), keys.end(), "claim");
+
+    BOOST_REQUIRE(claim_iter != keys.end());
+    BOOST_CHECK(*std::prev(claim_iter) == "tx");
+    BOOST_CHECK(keys == expected.getKeys());
+    BOOST_CHECK_EQUAL(actual.write(), expected.write());
+}
+
+BOOST_AUTO_TEST_CASE(rpc_work_queue_rejects_connections_beyond_its_depth)
+{
+    ioContext io_context;
+    boost::asio::ssl::context ssl_context(boost::asio::ssl::context::sslv23);
+
+    const auto make_connection = [&]() {
+        return std::make_shared<TcpConnection>(io_context, ssl_context, false);
+    };
+
+    RPCWorkQueue queue;
+
+    BOOST_CHECK(!queue.Enqueue(make_connection()));
+
+    queue.Start(2);
+
+    const auto first = make_connection();
+
+    BOOST_CHECK(queue.Enqueue(first));
+    BOOST_CHECK(queue.Enqueue(make_connection()));
+    BOOST_CHECK(!queue.Enqueue(make_connection()));
+
+    BOOST_CHECK(queue.Dequeue() == first);
+    BOOST_CHECK(queue.Enqueue(make_connection()));
+
+    const RPCWorkQueue::Stats stats = queue.GetStats();
+
+    BOOST_CHECK_EQUAL(stats.m_depth, 2);
+    BOOST_CHECK_EQUAL(stats.m_max_depth, 2);
+    BOOST_CHECK_EQUAL(stats.m_peak_depth, 2);
+    BOOST_CHECK_EQUAL(stats.m_dispatched, 1);
+    BOOST_CHECK_EQUAL(stats.m_rejected, 2);
+
+    queue.Interrupt();
+
+    BOOST_CHECK(queue.Dequeue() == nullptr);
+    BOOST_CHECK(!queue.Enqueue(make_connection()));
+}
+
+BOOST_AUTO_TEST_CASE(rpc_connection_waits_for_the_next_keep_alive_request)
+{
+    LoopbackConnection loopback;
+    std::vector<bool> results;
+
+    const auto wait = [&]() {
+        loopback.m_conn->async_wait_readable(std::chrono::seconds(1), [&](const bool readable) {
+            results.push_back(readable);
+        });
+    };
+
+    // Return the connection from another thread, as an RPC worker does:
+    std::thread(wait).join();
+    boost::asio::write(loopback.m_client, boost::asio::buffer(std::string("first\n")));
+    loopback.Run();
+
+    BOOST_REQUIRE_EQUAL(results.size(), 1);
+    BOOST_CHECK(results[0]);
+
+    std::string line;
+    std::getline(loopback.m_conn->stream(), line);
+    BOOST_CHECK_EQUAL(line, "first");
+
+    // The next request on the same connection:
+    std::thread(wait).join();
+    boost::asio::write(loopback.m_client, boost::asio::buffer(std::string("second\n")));
+    loopback.Run();
+
+    BOOST_REQUIRE_EQUAL(results.size(), 2);
+    BOOST_CHECK(results[1]);
+
+    std::getline(loopback.m_conn->stream(), line);
+    BOOST_CHECK_EQUAL(line, "second");
+
+    // A client that stays idle for longer than the timeout:
+    std::thread(wait).join();
+    loopback.Run();
+
+    BOOST_REQUIRE_EQUAL(results.size(), 3);
+    BOOST_CHECK(!results[2]);
+}
+
+BOOST_AUTO_TEST_CASE(rpc_connection_writes_a_reply_and_closes)
+{
+    LoopbackConnection loopback;
+
+    loopback.m_conn->async_write_and_close(HTTPReply(HTTP_SERVICE_UNAVAILABLE, "", false));
+    loopback.Run();
+
+    boost::asio::streambuf buffer;
+    boost::system::error_code error;
+    boost::asio::read(loopback.m_client, buffer, error);
+
+    const std::string reply(
+        boost::asio::buffers_begin(buffer.data()),
+        boost::asio::buffers_end(buffer.data()));
+
+    BOOST_CHECK(error == boost::asio::error::eof);
+    BOOST_CHECK_EQUAL(reply.substr(0, reply.find("\r\n")), "HTTP/1.1 503 Service Unavailable");
+}
+
+BOOST_AUTO_TEST_CASE(rpc_call_tracker_limits_concurrent_slow_calls)
+{
+    RPCCallTracker tracker;
+
+    // Each slow method may use two of four threads, and all limited methods
+    // together may use three:
+    tracker.Configure(4, { "getblockcount:1", "exportblocks:0", "notarealmethod:1", "getblockstats" });
+
+    bool limited = false;
+
+    BOOST_CHECK(tracker.Begin("getblocksbatch", limited));
+    BOOST_CHECK(limited);
+    BOOST_CHECK(tracker.Begin("getblocksbatch", limited));
+    BOOST_CHECK(!tracker.Begin("getblocksbatch", limited));
+
+    BOOST_CHECK(tracker.Begin("getblockcount", limited));
+    BOOST_CHECK(limited);
+    BOOST_CHECK(!tracker.Begin("getblockstats", limited));
+
+    // A limit of zero removes the default limit of a slow method:
+    BOOST_CHECK(tracker.Begin("exportblocks", limited));
+    BOOST_CHECK(!limited);
+    BOOST_CHECK(tracker.Begin("exportblocks", limited));
+    BOOST_CHECK(tracker.Begin("exportblocks", limited));
+
+    tracker.End("getblocksbatch", true, 1000, false);
+
+    BOOST_CHECK(!tracker.Begin("getblockcount", limited));
+    BOOST_CHECK(tracker.Begin("getblockstats", limited));
+    BOOST_CHECK(limited);
+
+    const UniValue stats = tracker.ToJson();
+    const UniValue& methods = find_value(stats, "methods");
+
+    BOOST_CHECK_EQUAL(find_value(stats, "limited_capacity").get_int(), 3);
+    BOOST_CHECK_EQUAL(find_value(stats, "limited_active").get_int(), 3);
+    BOOST_CHECK(find_value(methods, "notarealmethod").isNull());
+
+    const UniValue& batch = find_value(methods, "getblocksbatch");
+
+    BOOST_CHECK_EQUAL(find_value(batch, "calls").get_int(), 1);
+    BOOST_CHECK_EQUAL(find_value(batch, "rejected").get_int(), 1);
+    BOOST_CHECK_EQUAL(find_value(batch, "active").get_int(), 1);
+    BOOST_CHECK_EQUAL(find_value(batch, "limit").get_int(), 2);
+
+    BOOST_CHECK_EQUAL(find_value(find_value(methods, "getblockcount"), "rejected").get_int(), 1);
+    BOOST_CHECK_EQUAL(find_value(find_value(methods, "getblockstats"), "rejected").get_int(), 1);
+    BOOST_CHECK_EQUAL(find_value(find_value(methods, "exportblocks"), "limit").get_int(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
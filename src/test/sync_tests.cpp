@@ -4,8 +4,10 @@
 
 #include <sync.h>
 
+#include <algorithm>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 
 #include <boost/test/unit_test.hpp>
 
@@ -47,4 +49,67 @@ BOOST_AUTO_TEST_CASE(potential_deadlock_detected)
     #endif
 }
 
+BOOST_AUTO_TEST_CASE(profiled_lock_records_sites)
+{
+    CCriticalSection mutex;
+    mutex.EnableProfiling("sync_tests_profiled");
+
+    const auto find_site = [](const int line) {
+        const auto snapshots = LockProfileSite::GetSnapshots();
+
+        return *std::find_if(snapshots.begin(), snapshots.end(), [&](const LockProfileSite::Snapshot& snapshot) {
+            return snapshot.m_lock == "sync_tests_profiled" && snapshot.m_line == line;
+        });
+    };
+
+    int line = 0;
+    for (int i = 0; i < 3; ++i) {
+        line = __LINE__; LOCK(mutex);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const LockProfileSite::Snapshot site = find_site(line);
+
+    BOOST_CHECK_EQUAL(site.m_count, 3u);
+    BOOST_CHECK_EQUAL(site.m_contended, 0u);
+    BOOST_CHECK(site.m_hold_ns >= 3000000u);
+    BOOST_CHECK(site.m_max_hold_ns >= 1000000u);
+
+    // A contended acquisition records its wait:
+    std::thread holder;
+    {
+        WAIT_LOCK(mutex, lock);
+        holder = std::thread([&] {
+            line = __LINE__; LOCK(mutex);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    holder.join();
+
+    const LockProfileSite::Snapshot contended = find_site(line);
+
+    BOOST_CHECK_EQUAL(contended.m_count, 1u);
+    BOOST_CHECK_EQUAL(contended.m_contended, 1u);
+    BOOST_CHECK(contended.m_wait_ns > 0u);
+}
+
+BOOST_AUTO_TEST_CASE(latency_histogram_percentiles)
+{
+    static LatencyHistogram histogram("sync_tests_latency");
+
+    for (int i = 0; i < 90; ++i) histogram.Record(5000);    // 5 us
+    for (int i = 0; i < 10; ++i) histogram.Record(3000000); // 3 ms
+
+    const LatencyHistogram::Snapshot snapshot = histogram.GetSnapshot();
+
+    BOOST_CHECK_EQUAL(snapshot.m_count, 100u);
+    BOOST_CHECK_EQUAL(snapshot.m_max_ns, 3000000u);
+    BOOST_CHECK_EQUAL(snapshot.Percentile(50), 8000u);     // Bucket below 8 us.
+    BOOST_CHECK_EQUAL(snapshot.Percentile(99), 3000000u);  // Capped at the maximum.
+
+    histogram.Reset();
+    BOOST_CHECK_EQUAL(histogram.GetSnapshot().m_count, 0u);
+    BOOST_CHECK_EQUAL(histogram.GetSnapshot().Percentile(50), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
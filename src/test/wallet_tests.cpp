@@ -1,7 +1,10 @@
 #include <boost/test/unit_test.hpp>
 
+#include "chainparams.h"
+#include "consensus/merkle.h"
 #include "gridcoin/sidestake.h"
 #include "main.h"
+#include "node/blockstorage.h"
 #include "wallet/wallet.h"
 
 // how many times to run all the tests to have a chance to catch errors that only show up with particular random shuffles
@@ -302,4 +305,403 @@ BOOST_AUTO_TEST_CASE(coin_selection_tests)
     empty_wallet();
 }
 
+//!
+//! \brief Create a transaction that passes CheckTransaction() for storing in a
+//! wallet database. The lock time makes each transaction hash unique.
+//!
+static CTransaction MakeStoredTx(uint32_t id, size_t script_size = 1)
+{
+    const std::vector<unsigned char> script(script_size, OP_TRUE);
+
+    CTransaction tx;
+    tx.nTime = 0;
+    tx.nLockTime = id;
+    tx.vin.emplace_back(COutPoint(uint256S("0x01"), id));
+    tx.vout.emplace_back(COIN, CScript(script.begin(), script.end()));
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(wallet_loads_records_in_bulk)
+{
+    // The mock database environment keeps every wallet file in the same
+    // in-memory database, so check only the records written here and remove
+    // them afterward:
+    const std::string wallet_file = "wallet_bulk_tests.dat";
+    const uint32_t record_count = 5000;
+    const uint32_t large_record_id = 2500;
+
+    CWallet source(wallet_file);
+    std::vector<uint256> hashes;
+
+    {
+        CWalletDB walletdb(wallet_file, "cr+");
+
+        for (uint32_t i = 1; i <= record_count; ++i) {
+            CWalletTx wtx(&source, MakeStoredTx(i));
+            wtx.nOrderPos = i;
+
+            // A record larger than the 1 MiB bulk read buffer forces a read
+            // to grow the buffer and retry:
+            if (i == large_record_id) {
+                for (uint32_t j = 1; j <= 3; ++j) {
+                    wtx.vtxPrev.emplace_back(MakeStoredTx(record_count + j, 512 * 1024));
+                }
+            }
+
+            hashes.push_back(wtx.GetHash());
+            BOOST_REQUIRE(walletdb.WriteTx(wtx.GetHash(), wtx));
+        }
+    }
+
+    // The mock database environment stores every wallet file in one database,
+    // so the load also reads records left by other tests and may report
+    // errors for them. Check only the records of this test:
+    CWallet loaded(wallet_file);
+    CWalletDB(wallet_file).LoadWallet(&loaded);
+
+    {
+        LOCK(loaded.cs_wallet);
+
+        for (uint32_t i = 1; i <= record_count; ++i) {
+            const auto iter = loaded.mapWallet.find(hashes[i - 1]);
+
+            BOOST_REQUIRE(iter != loaded.mapWallet.end());
+            BOOST_CHECK_EQUAL(iter->second.nLockTime, i);
+            BOOST_CHECK_EQUAL(iter->second.nOrderPos, i);
+            BOOST_CHECK_EQUAL(iter->second.vtxPrev.size(), i == large_record_id ? 3u : 0u);
+        }
+
+        const CWalletTx& large_wtx = loaded.mapWallet.at(hashes[large_record_id - 1]);
+
+        for (const auto& supporting_tx : large_wtx.vtxPrev) {
+            BOOST_CHECK_EQUAL(supporting_tx.vout[0].scriptPubKey.size(), 512u * 1024u);
+        }
+    }
+
+    CWalletDB walletdb(wallet_file);
+
+    for (const auto& hash : hashes) {
+        walletdb.EraseTx(hash);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(wallet_prunes_supporting_txs_of_confirmed_txs)
+{
+    const std::string wallet_file = "wallet_prune_tests.dat";
+    const uint256 block_hash = uint256S("0x0d");
+
+    CBlockIndex block_index;
+    block_index.phashBlock = &block_hash;
+    block_index.nHeight = 1;
+
+    CBlockIndex* const saved_best = pindexBest;
+
+    {
+        LOCK(cs_main);
+        mapBlockIndex[block_hash] = &block_index;
+        pindexBest = &block_index;
+    }
+
+    CWallet prune_wallet(wallet_file);
+
+    CWalletTx confirmed(&prune_wallet, MakeStoredTx(20001));
+    confirmed.hashBlock = block_hash;
+    confirmed.nIndex = 0;
+    confirmed.vtxPrev.emplace_back(MakeStoredTx(20002));
+    confirmed.vtxPrev.emplace_back(MakeStoredTx(20003));
+
+    CWalletTx pending(&prune_wallet, MakeStoredTx(20004));
+    pending.vtxPrev.emplace_back(MakeStoredTx(20005));
+
+    {
+        LOCK(prune_wallet.cs_wallet);
+        CWalletDB walletdb(wallet_file, "cr+");
+
+        for (const CWalletTx* wtx : {&confirmed, &pending}) {
+            BOOST_REQUIRE(walletdb.WriteTx(wtx->GetHash(), *wtx));
+            prune_wallet.mapWallet.emplace(wtx->GetHash(), *wtx);
+        }
+    }
+
+    prune_wallet.PruneSupportingTransactions();
+
+    {
+        LOCK(prune_wallet.cs_wallet);
+
+        BOOST_CHECK(prune_wallet.mapWallet.at(confirmed.GetHash()).vtxPrev.empty());
+        BOOST_CHECK_EQUAL(prune_wallet.mapWallet.at(pending.GetHash()).vtxPrev.size(), 1u);
+    }
+
+    // The pruned record is rewritten, and the unconfirmed one is untouched.
+    // As above, the load may report errors for records of other tests:
+    CWallet loaded(wallet_file);
+    CWalletDB(wallet_file).LoadWallet(&loaded);
+
+    {
+        LOCK(loaded.cs_wallet);
+
+        BOOST_REQUIRE(loaded.mapWallet.count(confirmed.GetHash()));
+        BOOST_REQUIRE(loaded.mapWallet.count(pending.GetHash()));
+        BOOST_CHECK(loaded.mapWallet.at(confirmed.GetHash()).vtxPrev.empty());
+        BOOST_CHECK(loaded.mapWallet.at(confirmed.GetHash()).hashBlock == block_hash);
+        BOOST_CHECK_EQUAL(loaded.mapWallet.at(pending.GetHash()).vtxPrev.size(), 1u);
+    }
+
+    CWalletDB walletdb(wallet_file);
+    walletdb.EraseTx(confirmed.GetHash());
+    walletdb.EraseTx(pending.GetHash());
+
+    LOCK(cs_main);
+    mapBlockIndex.erase(block_hash);
+    pindexBest = saved_best;
+}
+
+//!
+//! \brief Check that the wallet's unspent index holds exactly the transactions
+//! that a full scan of mapWallet finds with unspent outputs of the wallet.
+//!
+static void CheckUnspentIndex(const CWallet& unspent_wallet)
+{
+    LOCK(unspent_wallet.cs_wallet);
+
+    std::map<uint256, const CWalletTx*> expected;
+
+    for (const auto& [hash, wtx] : unspent_wallet.mapWallet) {
+        for (unsigned int i = 0; i < wtx.vout.size(); ++i) {
+            if (!wtx.IsSpent(i) && unspent_wallet.IsMine(wtx.vout[i]) != ISMINE_NO) {
+                expected.emplace(hash, &wtx);
+                break;
+            }
+        }
+    }
+
+    BOOST_CHECK(unspent_wallet.UnspentIndex() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(unspent_index_tracks_spends_reorgs_and_abandoned_txs)
+{
+    const std::string wallet_file = "wallet_unspent_tests.dat";
+
+    CKey key;
+    key.MakeNewKey(true);
+
+    CScript my_script;
+    my_script.SetDestination(key.GetPubKey().GetID());
+    const CScript other_script = CScript() << OP_TRUE;
+
+    CWallet unspent_wallet(wallet_file);
+
+    {
+        LOCK(unspent_wallet.cs_wallet);
+        BOOST_REQUIRE(unspent_wallet.LoadKey(key));
+    }
+
+    // Build the index now so that the changes below update it in place
+    // instead of triggering a rebuild:
+    CheckUnspentIndex(unspent_wallet);
+
+    CTransaction receive = MakeStoredTx(30001);
+    receive.vout[0].scriptPubKey = my_script;
+    receive.vout.emplace_back(COIN, my_script);
+    receive.vout.emplace_back(COIN, other_script);
+
+    CTransaction receive_other = MakeStoredTx(30002);
+    receive_other.vout[0].scriptPubKey = my_script;
+
+    BOOST_REQUIRE(unspent_wallet.AddToWalletIfInvolvingMe(receive, nullptr));
+    BOOST_REQUIRE(unspent_wallet.AddToWalletIfInvolvingMe(receive_other, nullptr));
+    CheckUnspentIndex(unspent_wallet);
+
+    // Spending one of two outputs keeps the transaction in the index:
+    CTransaction send;
+    send.nTime = 0;
+    send.vin.emplace_back(COutPoint(receive.GetHash(), 0));
+    send.vout.emplace_back(COIN, other_script);
+
+    BOOST_REQUIRE(unspent_wallet.AddToWalletIfInvolvingMe(send, nullptr));
+    CheckUnspentIndex(unspent_wallet);
+
+    // A coinstake spends the remaining outputs:
+    CTransaction coinstake;
+    coinstake.nTime = 0;
+    coinstake.vin.emplace_back(COutPoint(receive.GetHash(), 1));
+    coinstake.vin.emplace_back(COutPoint(receive_other.GetHash(), 0));
+    coinstake.vout.resize(1);
+    coinstake.vout[0].SetEmpty();
+    coinstake.vout.emplace_back(3 * COIN, my_script);
+
+    BOOST_REQUIRE(coinstake.IsCoinStake());
+    BOOST_REQUIRE(unspent_wallet.AddToWalletIfInvolvingMe(coinstake, nullptr));
+    CheckUnspentIndex(unspent_wallet);
+
+    {
+        LOCK(unspent_wallet.cs_wallet);
+
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(receive.GetHash()), 0u);
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(receive_other.GetHash()), 0u);
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(coinstake.GetHash()), 1u);
+    }
+
+    // A reorganization that disconnects the coinstake marks its inputs
+    // unspent again:
+    unspent_wallet.DisableTransaction(coinstake);
+    CheckUnspentIndex(unspent_wallet);
+
+    {
+        LOCK(unspent_wallet.cs_wallet);
+
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(receive.GetHash()), 1u);
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(receive_other.GetHash()), 1u);
+    }
+
+    // The wallet then drops the orphaned coinstake:
+    BOOST_REQUIRE(unspent_wallet.EraseFromWallet(coinstake.GetHash()));
+    CheckUnspentIndex(unspent_wallet);
+
+    {
+        LOCK(unspent_wallet.cs_wallet);
+        BOOST_CHECK_EQUAL(unspent_wallet.UnspentIndex().count(coinstake.GetHash()), 0u);
+    }
+
+    // Abandoning the remaining transactions empties the index:
+    for (const CTransaction* tx : {&receive, &receive_other, &send}) {
+        BOOST_REQUIRE(unspent_wallet.EraseFromWallet(tx->GetHash()));
+        CheckUnspentIndex(unspent_wallet);
+    }
+
+    LOCK(unspent_wallet.cs_wallet);
+    BOOST_CHECK(unspent_wallet.UnspentIndex().empty());
+}
+
+BOOST_AUTO_TEST_CASE(threaded_rescan_matches_serial_rescan)
+{
+    CKey key;
+    key.MakeNewKey(true);
+
+    CScript my_script;
+    my_script.SetDestination(key.GetPubKey().GetID());
+    const CScript other_script = CScript() << OP_TRUE;
+
+    // More blocks than one batch holds for either thread count, so that some
+    // spends of wallet outputs fall in a later batch than the outputs:
+    const size_t block_count = 300;
+    const int64_t now = GetAdjustedTime();
+    const uint256 funding_hash = uint256S("0x0f");
+
+    std::vector<uint256> block_hashes(block_count);
+    std::vector<CBlockIndex> indexes(block_count);
+    std::set<uint256> expected_hashes;
+    std::vector<COutPoint> my_outputs;
+
+    CBlockIndex* const saved_best = pindexBest;
+
+    for (uint32_t i = 0; i < block_count; ++i) {
+        CBlock block;
+        block.nTime = now;
+        block.nBits = 0x1e0fffff;
+        block.hashPrevBlock = i > 0 ? block_hashes[i - 1] : uint256();
+
+        CTransaction coinbase;
+        coinbase.nLockTime = i;
+        coinbase.vin.resize(1);
+        coinbase.vout.resize(1);
+        block.vtx.push_back(coinbase);
+
+        CTransaction coinstake;
+        coinstake.vin.emplace_back(COutPoint(funding_hash, i));
+        coinstake.vout.resize(1);
+        coinstake.vout[0].SetEmpty();
+        coinstake.vout.emplace_back(COIN, other_script);
+        block.vtx.push_back(coinstake);
+
+        if (i % 7 == 0) {
+            CTransaction receive;
+            receive.vin.emplace_back(COutPoint(funding_hash, 100000 + i));
+            receive.vout.emplace_back(COIN, my_script);
+            block.vtx.push_back(receive);
+
+            my_outputs.emplace_back(receive.GetHash(), 0);
+            expected_hashes.insert(receive.GetHash());
+        }
+
+        if (i % 11 == 10 && !my_outputs.empty()) {
+            CTransaction send;
+            send.vin.emplace_back(my_outputs.front());
+            send.vout.emplace_back(COIN, other_script);
+            block.vtx.push_back(send);
+
+            my_outputs.erase(my_outputs.begin());
+            expected_hashes.insert(send.GetHash());
+        }
+
+        CTransaction unrelated;
+        unrelated.vin.emplace_back(COutPoint(funding_hash, 200000 + i));
+        unrelated.vout.emplace_back(COIN, other_script);
+        block.vtx.push_back(unrelated);
+
+        block.hashMerkleRoot = BlockMerkleRoot(block);
+        block_hashes[i] = block.GetHash();
+
+        CBlockIndex& index = indexes[i];
+        index.phashBlock = &block_hashes[i];
+        index.nHeight = i;
+        index.nTime = block.nTime;
+
+        if (i > 0) {
+            index.pprev = &indexes[i - 1];
+            indexes[i - 1].pnext = &index;
+        }
+
+        LOCK(cs_main);
+        BOOST_REQUIRE(WriteBlockToDisk(block, index.nFile, index.nBlockPos, Params().MessageStart()));
+        mapBlockIndex[block_hashes[i]] = &index;
+    }
+
+    {
+        LOCK(cs_main);
+        pindexBest = &indexes.back();
+    }
+
+    CWallet serial_wallet;
+    CWallet threaded_wallet;
+
+    for (CWallet* rescan_wallet : {&serial_wallet, &threaded_wallet}) {
+        LOCK(rescan_wallet->cs_wallet);
+        BOOST_REQUIRE(rescan_wallet->AddKey(key));
+    }
+
+    // These wallets are not file-backed, so AddToWallet() fails to write the
+    // transactions it inserts and the rescans count none of them. Compare the
+    // contents of mapWallet instead of the returned counts:
+    serial_wallet.ScanForWalletTransactions(&indexes[0], false, 1);
+    threaded_wallet.ScanForWalletTransactions(&indexes[0], false, 4);
+
+    {
+        LOCK2(serial_wallet.cs_wallet, threaded_wallet.cs_wallet);
+
+        BOOST_REQUIRE_EQUAL(serial_wallet.mapWallet.size(), expected_hashes.size());
+        BOOST_REQUIRE_EQUAL(threaded_wallet.mapWallet.size(), expected_hashes.size());
+
+        auto threaded_iter = threaded_wallet.mapWallet.begin();
+
+        for (const auto& [hash, serial_wtx] : serial_wallet.mapWallet) {
+            BOOST_CHECK(expected_hashes.count(hash));
+            BOOST_CHECK(threaded_iter->first == hash);
+            BOOST_CHECK(threaded_iter->second.hashBlock == serial_wtx.hashBlock);
+            BOOST_CHECK_EQUAL(threaded_iter->second.nIndex, serial_wtx.nIndex);
+            BOOST_CHECK_EQUAL(threaded_iter->second.IsSpent(0), serial_wtx.IsSpent(0));
+            ++threaded_iter;
+        }
+    }
+
+    LOCK(cs_main);
+
+    for (const auto& hash : block_hashes) {
+        mapBlockIndex.erase(hash);
+    }
+
+    pindexBest = saved_best;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
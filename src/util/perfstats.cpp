@@ -0,0 +1,260 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#include <util/perfstats.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+namespace {
+//!
+//! \brief Site table plus one overflow site for locations that do not fit.
+//!
+LockProfileSite g_lock_sites[LockProfileSite::MAX_SITES + 1];
+
+void UpdateMax(std::atomic<uint64_t>& max, const uint64_t value)
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+struct HistogramRegistry
+{
+    std::mutex m_mutex;
+    std::vector<LatencyHistogram*> m_histograms;
+};
+
+//!
+//! \brief Get the registered histograms.
+//!
+//! A function-local static so that histograms defined in other translation
+//! units can register during static initialization.
+//!
+HistogramRegistry& Histograms()
+{
+    static HistogramRegistry registry;
+
+    return registry;
+}
+} // Anonymous namespace
+
+// -----------------------------------------------------------------------------
+// Class: LockProfileSite
+// -----------------------------------------------------------------------------
+
+LockProfileSite* LockProfileSite::Get(const char* lock_name, const char* file, int line)
+{
+    // String literals for the same file can differ in address between
+    // translation units. Such sites get separate slots and are merged when
+    // reported.
+    size_t hash = reinterpret_cast<uintptr_t>(file) ^ (static_cast<size_t>(line) * 0x9e3779b97f4a7c15ull);
+    hash ^= reinterpret_cast<uintptr_t>(lock_name) >> 4;
+
+    for (size_t probe = 0; probe < MAX_SITES; ++probe) {
+        LockProfileSite& site = g_lock_sites[(hash + probe) % MAX_SITES];
+        int state = site.m_state.load(std::memory_order_acquire);
+
+        if (state == EMPTY) {
+            if (site.m_state.compare_exchange_strong(state, CLAIMED, std::memory_order_acquire)) {
+                site.m_lock_name = lock_name;
+                site.m_file = file;
+                site.m_line = line;
+                site.m_state.store(READY, std::memory_order_release);
+
+                return &site;
+            }
+        }
+
+        while (state == CLAIMED) {
+            std::this_thread::yield();
+            state = site.m_state.load(std::memory_order_acquire);
+        }
+
+        if (site.m_file == file && site.m_line == line && site.m_lock_name == lock_name) {
+            return &site;
+        }
+    }
+
+    LockProfileSite& overflow = g_lock_sites[MAX_SITES];
+
+    if (overflow.m_state.load(std::memory_order_acquire) != READY) {
+        int expected = EMPTY;
+        if (overflow.m_state.compare_exchange_strong(expected, CLAIMED, std::memory_order_acquire)) {
+            overflow.m_lock_name = "(other)";
+            overflow.m_file = "(other)";
+            overflow.m_state.store(READY, std::memory_order_release);
+        }
+    }
+
+    return &overflow;
+}
+
+std::vector<LockProfileSite::Snapshot> LockProfileSite::GetSnapshots()
+{
+    std::vector<Snapshot> snapshots;
+
+    for (const LockProfileSite& site : g_lock_sites) {
+        if (site.m_state.load(std::memory_order_acquire) != READY
+            || site.m_count.load(std::memory_order_relaxed) == 0)
+        {
+            continue;
+        }
+
+        Snapshot snapshot;
+        snapshot.m_lock = site.m_lock_name;
+        snapshot.m_file = site.m_file;
+        snapshot.m_line = site.m_line;
+        snapshot.m_count = site.m_count.load(std::memory_order_relaxed);
+        snapshot.m_contended = site.m_contended.load(std::memory_order_relaxed);
+        snapshot.m_wait_ns = site.m_wait_ns.load(std::memory_order_relaxed);
+        snapshot.m_max_wait_ns = site.m_max_wait_ns.load(std::memory_order_relaxed);
+        snapshot.m_hold_ns = site.m_hold_ns.load(std::memory_order_relaxed);
+        snapshot.m_max_hold_ns = site.m_max_hold_ns.load(std::memory_order_relaxed);
+
+        snapshots.push_back(std::move(snapshot));
+    }
+
+    return snapshots;
+}
+
+void LockProfileSite::ResetAll()
+{
+    for (LockProfileSite& site : g_lock_sites) {
+        site.m_count.store(0, std::memory_order_relaxed);
+        site.m_contended.store(0, std::memory_order_relaxed);
+        site.m_wait_ns.store(0, std::memory_order_relaxed);
+        site.m_max_wait_ns.store(0, std::memory_order_relaxed);
+        site.m_hold_ns.store(0, std::memory_order_relaxed);
+        site.m_max_hold_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LockProfileSite::RecordAcquire(bool contended, int64_t wait_ns)
+{
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (contended) {
+        m_contended.fetch_add(1, std::memory_order_relaxed);
+        m_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+        UpdateMax(m_max_wait_ns, wait_ns);
+    }
+}
+
+void LockProfileSite::RecordHold(int64_t hold_ns)
+{
+    m_hold_ns.fetch_add(hold_ns, std::memory_order_relaxed);
+    UpdateMax(m_max_hold_ns, hold_ns);
+}
+
+// -----------------------------------------------------------------------------
+// Class: LatencyHistogram
+// -----------------------------------------------------------------------------
+
+LatencyHistogram::LatencyHistogram(const char* name) : m_name(name)
+{
+    HistogramRegistry& registry = Histograms();
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    registry.m_histograms.push_back(this);
+}
+
+void LatencyHistogram::Record(int64_t elapsed_ns)
+{
+    if (elapsed_ns < 0) elapsed_ns = 0;
+
+    uint64_t micros = static_cast<uint64_t>(elapsed_ns) / 1000;
+    size_t bucket = 0;
+
+    while (micros > 0 && bucket < BUCKETS - 1) {
+        micros >>= 1;
+        ++bucket;
+    }
+
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_total_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    UpdateMax(m_max_ns, elapsed_ns);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+
+    snapshot.m_name = m_name;
+    snapshot.m_count = m_count.load(std::memory_order_relaxed);
+    snapshot.m_total_ns = m_total_ns.load(std::memory_order_relaxed);
+    snapshot.m_max_ns = m_max_ns.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        snapshot.m_buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void LatencyHistogram::Reset()
+{
+    m_count.store(0, std::memory_order_relaxed);
+    m_total_ns.store(0, std::memory_order_relaxed);
+    m_max_ns.store(0, std::memory_order_relaxed);
+
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::vector<LatencyHistogram::Snapshot> LatencyHistogram::GetSnapshots()
+{
+    HistogramRegistry& registry = Histograms();
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    std::vector<Snapshot> snapshots;
+    snapshots.reserve(registry.m_histograms.size());
+
+    for (const auto& histogram : registry.m_histograms) {
+        snapshots.push_back(histogram->GetSnapshot());
+    }
+
+    return snapshots;
+}
+
+void LatencyHistogram::ResetAll()
+{
+    HistogramRegistry& registry = Histograms();
+
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+    for (const auto& histogram : registry.m_histograms) {
+        histogram->Reset();
+    }
+}
+
+uint64_t LatencyHistogram::Snapshot::Percentile(double percentile) const
+{
+    if (m_count == 0) return 0;
+
+    // Bucket counts and the total are read separately, so rely on their sum:
+    uint64_t total = 0;
+    for (const auto& count : m_buckets) {
+        total += count;
+    }
+
+    const uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * total + 0.5);
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += m_buckets[i];
+
+        if (seen >= rank && seen > 0) {
+            const uint64_t upper_ns = (uint64_t{1} << i) * 1000;
+
+            return std::min(upper_ns, m_max_ns);
+        }
+    }
+
+    return m_max_ns;
+}
@@ -0,0 +1,195 @@
+// Copyright (c) 2026 The Gridcoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTIL_PERFSTATS_H
+#define BITCOIN_UTIL_PERFSTATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//!
+//! \brief Read the monotonic clock used by the performance counters.
+//!
+//! \return Nanoseconds since an unspecified epoch.
+//!
+inline int64_t PerfNowNanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//!
+//! \brief Lock wait and hold times recorded for one call site of a profiled
+//! mutex.
+//!
+//! Sites live in a fixed table that threads claim slots in without a lock.
+//! The counters use relaxed atomics: a snapshot taken while other threads lock
+//! the mutex may be off by the operations in progress.
+//!
+class LockProfileSite
+{
+public:
+    //!
+    //! \brief Counters of a site copied out of the table.
+    //!
+    struct Snapshot
+    {
+        std::string m_lock;          //!< Profile name of the mutex.
+        std::string m_file;          //!< Source file of the call site.
+        int m_line = 0;              //!< Source line of the call site.
+        uint64_t m_count = 0;        //!< Number of acquisitions.
+        uint64_t m_contended = 0;    //!< Acquisitions that had to wait.
+        uint64_t m_wait_ns = 0;      //!< Total time spent waiting.
+        uint64_t m_max_wait_ns = 0;  //!< Longest wait.
+        uint64_t m_hold_ns = 0;      //!< Total time the mutex was held.
+        uint64_t m_max_hold_ns = 0;  //!< Longest hold.
+    };
+
+    //!
+    //! \brief Find or create the site for a source location.
+    //!
+    //! \param lock_name Profile name of the mutex. Must outlive the process.
+    //! \param file      Source file. Must outlive the process.
+    //! \param line      Source line.
+    //!
+    //! \return The shared overflow site when the table is full.
+    //!
+    static LockProfileSite* Get(const char* lock_name, const char* file, int line);
+
+    //!
+    //! \brief Copy the counters of every site that recorded an acquisition.
+    //!
+    static std::vector<Snapshot> GetSnapshots();
+
+    //!
+    //! \brief Clear the counters of every site.
+    //!
+    static void ResetAll();
+
+    void RecordAcquire(bool contended, int64_t wait_ns);
+    void RecordHold(int64_t hold_ns);
+
+    //!
+    //! \brief Number of sites that the table holds.
+    //!
+    static constexpr size_t MAX_SITES = 4096;
+
+private:
+    enum State : int
+    {
+        EMPTY,
+        CLAIMED, //!< A thread is filling in the location.
+        READY,
+    };
+
+    std::atomic<int> m_state{EMPTY};
+    const char* m_lock_name = nullptr;
+    const char* m_file = nullptr;
+    int m_line = 0;
+
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_contended{0};
+    std::atomic<uint64_t> m_wait_ns{0};
+    std::atomic<uint64_t> m_max_wait_ns{0};
+    std::atomic<uint64_t> m_hold_ns{0};
+    std::atomic<uint64_t> m_max_hold_ns{0};
+};
+
+//!
+//! \brief Distribution of the run times of an operation.
+//!
+//! Buckets grow in powers of two from one microsecond. Instances register
+//! themselves for \c getperfstats and must have static storage duration.
+//!
+class LatencyHistogram
+{
+public:
+    //!
+    //! \brief Number of buckets. The last bucket also counts every longer
+    //! sample.
+    //!
+    static constexpr size_t BUCKETS = 32;
+
+    //!
+    //! \brief Counters of a histogram copied out for reporting.
+    //!
+    struct Snapshot
+    {
+        std::string m_name;
+        uint64_t m_count = 0;
+        uint64_t m_total_ns = 0;
+        uint64_t m_max_ns = 0;
+        std::array<uint64_t, BUCKETS> m_buckets {}; //!< Bucket i: below 2^i microseconds.
+
+        //!
+        //! \brief Estimate a percentile from the buckets.
+        //!
+        //! \param percentile Between 0 and 100.
+        //!
+        //! \return Upper bound in nanoseconds of the bucket that contains the
+        //! percentile, capped at the longest sample.
+        //!
+        uint64_t Percentile(double percentile) const;
+    };
+
+    explicit LatencyHistogram(const char* name);
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void Record(int64_t elapsed_ns);
+
+    Snapshot GetSnapshot() const;
+
+    void Reset();
+
+    //!
+    //! \brief Copy the counters of every registered histogram.
+    //!
+    static std::vector<Snapshot> GetSnapshots();
+
+    //!
+    //! \brief Clear the counters of every registered histogram.
+    //!
+    static void ResetAll();
+
+private:
+    const char* m_name;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_total_ns{0};
+    std::atomic<uint64_t> m_max_ns{0};
+    std::array<std::atomic<uint64_t>, BUCKETS> m_buckets {};
+};
+
+//!
+//! \brief Records the lifetime of the scope into a latency histogram.
+//!
+class ScopedLatency
+{
+public:
+    explicit ScopedLatency(LatencyHistogram& histogram)
+        : m_histogram(histogram)
+        , m_start(PerfNowNanos())
+    {
+    }
+
+    ~ScopedLatency()
+    {
+        m_histogram.Record(PerfNowNanos() - m_start);
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyHistogram& m_histogram;
+    const int64_t m_start;
+};
+
+#endif // BITCOIN_UTIL_PERFSTATS_H
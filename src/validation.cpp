@@ -22,11 +22,13 @@
 #include "gridcoin/staking/kernel.h"
 #include "gridcoin/staking/spam.h"
 #include "gridcoin/tally.h"
+#include "index/addressindex.h"
 #include "node/blockstorage.h"
 #include "node/orphan_blocks.h"
 #include "policy/fees.h"
 #include "serialize.h"
 #include "util.h"
+#include "util/perfstats.h"
 #include "util/time.h"
 #include "validation.h"
 #include "wallet/wallet.h"
@@ -38,6 +40,7 @@ extern GRC::SeenStakes g_seen_stakes;
 extern GRC::ChainTrustCache g_chain_trust;
 
 static constexpr CAmount nGenesisSupply = 340569880;
+static LatencyHistogram g_latency_connect_block("ConnectBlock"); //!< Reported by getperfstats.
 bool fColdBoot = true;
 
 bool ReadTxFromDisk(CTransaction& tx, CDiskTxPos pos, FILE** pfileRet)
@@ -569,6 +572,11 @@ bool CheckProofOfWork(uint256 hash, unsigned int nBits, const Consensus::Params&
 
 bool DisconnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex)
 {
+    // The address index reads the spent outputs through the transaction index,
+    // so remove its rows before the transactions leave the index:
+    if (!AddressIndex::DisconnectBlock(block, pindex, txdb))
+        return error("%s: failed to remove address index rows", __func__);
+
     // Disconnect in reverse order
     bool bDiscTxFailed = false;
     for (int i = block.vtx.size() - 1; i >= 0; i--)
@@ -902,6 +910,8 @@ unsigned int GetBlockScriptFlags(const CBlockIndex& block_index)
 
 bool ConnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex, bool fJustCheck)
 {
+    ScopedLatency latency(g_latency_connect_block);
+
     // Check it again in case a previous version let a bad block in, but skip BlockSig checking
     if (!CheckBlock(block, pindex->nHeight, !fJustCheck, !fJustCheck, false, false))
     {
@@ -929,6 +939,14 @@ bool ConnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex, bool fJustChe
 
     bool bIsDPOR = false;
 
+    // Outputs spent by each transaction for the optional address index:
+    const bool index_addresses = !fJustCheck && (AddressIndex::Components() & AddressIndex::ADDRESSES);
+    std::vector<std::vector<CTxOut>> spent_outputs;
+
+    if (index_addresses) {
+        spent_outputs.reserve(block.vtx.size());
+    }
+
     if (block.nVersion >= 8 && pindex->nStakeModifier == 0)
     {
         uint256 tmp_hashProof;
@@ -968,6 +986,9 @@ bool ConnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex, bool fJustChe
             nTxPos += ::GetSerializeSize(tx, SER_DISK, CLIENT_VERSION);
 
         MapPrevTx mapInputs;
+        if (index_addresses)
+            spent_outputs.emplace_back();
+
         if (tx.IsCoinBase())
         {
             nValueOut += tx.GetValueOut();
@@ -978,6 +999,14 @@ bool ConnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex, bool fJustChe
             if (!FetchInputs(tx, txdb, mapQueuedChanges, true, false, mapInputs, fInvalid))
                 return false;
 
+            if (index_addresses) {
+                spent_outputs.back().reserve(tx.vin.size());
+
+                for (const auto& txin : tx.vin) {
+                    spent_outputs.back().push_back(GetOutputFor(txin, mapInputs));
+                }
+            }
+
             // Add in sigops done by pay-to-script-hash inputs;
             // this is to prevent a "rogue miner" from creating
             // an incredibly-expensive-to-validate block.
@@ -1087,6 +1116,9 @@ bool ConnectBlock(CBlock& block, CTxDB& txdb, CBlockIndex* pindex, bool fJustChe
             return error("%s: UpdateTxIndex failed", __func__);
     }
 
+    if (!AddressIndex::ConnectBlock(block, pindex, txdb, spent_outputs))
+        return error("%s: failed to write address index rows", __func__);
+
     // Update block index on disk without changing it in memory.
     // The memory index structure will be changed after the db commits.
     if (pindex->pprev)
@@ -1684,9 +1716,11 @@ bool ValidateMRC(const GRC::Contract& contract, const CTransaction& tx, int& DoS
 //! \brief Used in ConnectBlock and CreateRestOfTheBlock for the binding to the claim
 //! \param mrc_last_pindex The pindex of the head of the chain when the mrc was created
 //! \param mrc The MRC contract
+//! \param signature_verified Whether the caller already verified the MRC signature against the key of the beacon
+//! active at the mrc_last_pindex time
 //! \return true if successfully validated
 //!
-bool ValidateMRC(const CBlockIndex* mrc_last_pindex, const GRC::MRC &mrc)
+bool ValidateMRC(const CBlockIndex* mrc_last_pindex, const GRC::MRC &mrc, const bool signature_verified)
 {
     int64_t research_owed = 0;
     const int64_t& mrc_time = mrc_last_pindex->nTime;
@@ -1704,7 +1738,7 @@ bool ValidateMRC(const CBlockIndex* mrc_last_pindex, const GRC::MRC &mrc)
     // miner and the block validations.
     // If this fails, no point in going further.
     if (const GRC::BeaconOption beacon = GRC::GetBeaconRegistry().TryActive(*cpid, mrc_time)) {
-        if (!mrc.VerifySignature(
+        if (!signature_verified && !mrc.VerifySignature(
             beacon->m_public_key,
             mrc_last_pindex->GetBlockHash())) {
             return error("%s: Validation failed: MRC signature validation failed for MRC for CPID %s.",
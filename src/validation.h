@@ -116,6 +116,6 @@ Fraction FoundationSideStakeAllocation();
 CTxDestination FoundationSideStakeAddress();
 unsigned int GetMRCOutputLimit(const int& block_version, bool include_foundation_sidestake);
 bool ValidateMRC(const GRC::Contract &contract, const CTransaction& tx, int& DoS);
-bool ValidateMRC(const CBlockIndex* mrc_last_pindex, const GRC::MRC& mrc);
+bool ValidateMRC(const CBlockIndex* mrc_last_pindex, const GRC::MRC& mrc, const bool signature_verified = false);
 
 #endif // BITCOIN_VALIDATION_H
@@ -9,6 +9,7 @@
 #include "clientversion.h"
 #include "fs.h"
 #include "streams.h"
+#include "support/allocators/zeroafterfree.h"
 #include "sync.h"
 
 #include <map>
@@ -271,6 +272,68 @@ protected:
         return 0;
     }
 
+    //!
+    //! \brief Read the remaining records after the cursor position in bulk.
+    //!
+    //! Berkeley DB copies many key/value pairs into one buffer per call with
+    //! DB_MULTIPLE_KEY. This avoids the per-record allocation and copy that
+    //! ReadAtCursor() incurs when a caller loads a whole database sequentially.
+    //!
+    //! \param pcursor  Cursor to advance through the database.
+    //! \param callback Invoked with the key and value streams of each record.
+    //!
+    //! \return DB_NOTFOUND after visiting every record, or another Berkeley DB
+    //! error code if a read fails.
+    //!
+    template <typename Callback>
+    int ReadBulkAtCursor(Dbc* pcursor, Callback&& callback)
+    {
+        // Must be a multiple of the database page size. The buffer holds key
+        // material, so its allocator wipes it whenever it is released:
+        SerializeData buffer(1 << 20);
+        int ret;
+
+        while (true) {
+            Dbt datKey;
+            Dbt datValue;
+            datValue.set_data(buffer.data());
+            datValue.set_ulen(buffer.size());
+            datValue.set_flags(DB_DBT_USERMEM);
+
+            ret = pcursor->get(&datKey, &datValue, DB_NEXT | DB_MULTIPLE_KEY);
+
+            if (ret == DB_BUFFER_SMALL) {
+                // A single record does not fit. Replace the buffer with the
+                // next multiple of the chunk size that holds it and retry. No
+                // need to copy the old contents as resize() would:
+                const size_t chunk = 1 << 20;
+                buffer = SerializeData((datValue.get_size() / chunk + 1) * chunk);
+                continue;
+            } else if (ret != 0) {
+                break;
+            }
+
+            DbMultipleKeyDataIterator records(datValue);
+            Dbt recordKey;
+            Dbt recordValue;
+
+            while (records.next(recordKey, recordValue)) {
+                CDataStream ssKey(
+                    Span{(std::byte*)recordKey.get_data(), recordKey.get_size()},
+                    SER_DISK,
+                    CLIENT_VERSION);
+                CDataStream ssValue(
+                    Span{(std::byte*)recordValue.get_data(), recordValue.get_size()},
+                    SER_DISK,
+                    CLIENT_VERSION);
+
+                callback(ssKey, ssValue);
+            }
+        }
+
+        return ret;
+    }
+
 public:
     bool TxnBegin()
     {
@@ -27,7 +27,13 @@
 #include "policy/fees.h"
 #include "node/blockstorage.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 
 using namespace std;
 
@@ -146,6 +152,11 @@ bool CWallet::AddKey(const CKey& key) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet)
 
     if (!CCryptoKeyStore::AddKey(key))
         return false;
+
+    // Outputs to the new key now belong to the wallet:
+    InvalidateUnspentIndex();
+    ++m_keystore_generation;
+
     if (!fFileBacked)
         return true;
     if (!IsCrypted())
@@ -157,6 +168,11 @@ bool CWallet::AddCryptedKey(const CPubKey &vchPubKey, const vector<unsigned char
 {
     if (!CCryptoKeyStore::AddCryptedKey(vchPubKey, vchCryptedSecret))
         return false;
+    {
+        LOCK(cs_wallet);
+        InvalidateUnspentIndex();
+        ++m_keystore_generation;
+    }
     if (!fFileBacked)
         return true;
     {
@@ -188,6 +204,11 @@ bool CWallet::AddCScript(const CScript& redeemScript)
 {
     if (!CCryptoKeyStore::AddCScript(redeemScript))
         return false;
+    {
+        LOCK(cs_wallet);
+        InvalidateUnspentIndex();
+        ++m_keystore_generation;
+    }
     if (!fFileBacked)
         return true;
     return CWalletDB(strWalletFile).WriteCScript(Hash160(redeemScript), redeemScript);
@@ -455,6 +476,7 @@ void CWallet::WalletUpdateSpent(const CTransaction &tx, bool fBlock, CWalletDB*
                     LogPrint(BCLog::LogFlags::VERBOSE, "WalletUpdateSpent found spent coin %s gC %s", FormatMoney(wtx.GetCredit()), wtx.GetHash().ToString());
                     wtx.MarkSpent(txin.prevout.n);
                     wtx.WriteToDisk(pwalletdb);
+                    UpdateUnspentIndex(txin.prevout.hash);
                     NotifyTransactionChanged(this, txin.prevout.hash, CT_UPDATED);
                 }
             }
@@ -472,6 +494,7 @@ void CWallet::WalletUpdateSpent(const CTransaction &tx, bool fBlock, CWalletDB*
                 {
                     wtx.MarkUnspent(&txout - &tx.vout[0]);
                     wtx.WriteToDisk(pwalletdb);
+                    UpdateUnspentIndex(hash);
                     NotifyTransactionChanged(this, hash, CT_UPDATED);
                 }
             }
@@ -489,6 +512,71 @@ void CWallet::MarkDirty()
     }
 }
 
+namespace {
+//!
+//! \brief Determine whether a wallet transaction contains an output that belongs
+//! to the wallet and is not marked spent.
+//!
+bool HasUnspentOutputs(const CWallet& wallet, const CWalletTx& wtx)
+{
+    for (unsigned int i = 0; i < wtx.vout.size(); ++i) {
+        if (!wtx.IsSpent(i) && wallet.IsMine(wtx.vout[i]) != ISMINE_NO) {
+            return true;
+        }
+    }
+
+    return false;
+}
+} // anonymous namespace
+
+const std::map<uint256, const CWalletTx*>& CWallet::UnspentIndex() const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet)
+{
+    AssertLockHeld(cs_wallet);
+
+    if (m_unspent_index_stale) {
+        m_unspent_index.clear();
+
+        for (const auto& item : mapWallet) {
+            if (HasUnspentOutputs(*this, item.second)) {
+                m_unspent_index.emplace_hint(m_unspent_index.end(), item.first, &item.second);
+            }
+        }
+
+        m_unspent_index_stale = false;
+
+        LogPrint(BCLog::LogFlags::VERBOSE, "INFO: %s: rebuilt unspent index: %u of %u transactions.",
+                 __func__,
+                 m_unspent_index.size(),
+                 mapWallet.size());
+    }
+
+    return m_unspent_index;
+}
+
+void CWallet::UpdateUnspentIndex(const uint256& hash) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet)
+{
+    AssertLockHeld(cs_wallet);
+
+    // A full rebuild will pick up the change:
+    if (m_unspent_index_stale) return;
+
+    const auto iter = mapWallet.find(hash);
+
+    if (iter != mapWallet.end() && HasUnspentOutputs(*this, iter->second)) {
+        m_unspent_index[hash] = &iter->second;
+    } else {
+        m_unspent_index.erase(hash);
+    }
+}
+
+void CWallet::InvalidateUnspentIndex() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet)
+{
+    AssertLockHeld(cs_wallet);
+
+    m_unspent_index.clear();
+    m_unspent_index_stale = true;
+}
+
 bool CWallet::AddToWallet(const CWalletTx& wtxIn, CWalletDB* pwalletdb)
 {
     uint256 hash = wtxIn.GetHash();
@@ -527,6 +615,14 @@ bool CWallet::AddToWallet(const CWalletTx& wtxIn, CWalletDB* pwalletdb)
             {
                 wtx.hashBlock = wtxIn.hashBlock;
                 fUpdated = true;
+
+                // Once the transaction is in a block, the copies of its
+                // unconfirmed inputs only bloat the wallet record:
+                if (!wtx.vtxPrev.empty())
+                {
+                    wtx.vtxPrev.clear();
+                    wtx.vtxPrev.shrink_to_fit();
+                }
             }
             if (wtxIn.nIndex != -1 && wtxIn.nIndex != wtx.nIndex)
             {
@@ -568,6 +664,8 @@ bool CWallet::AddToWallet(const CWalletTx& wtxIn, CWalletDB* pwalletdb)
         // since AddToWallet is called directly for self-originating transactions, check for consumption of own coins
         WalletUpdateSpent(wtx, (!wtxIn.hashBlock.IsNull()), pwalletdb);
 
+        UpdateUnspentIndex(hash);
+
         // Notify UI of new or updated transaction
         NotifyTransactionChanged(this, hash, fInsertedNew ? CT_NEW : CT_UPDATED);
 
@@ -619,7 +717,13 @@ bool CWallet::EraseFromWallet(uint256 hash)
 {
     LOCK(cs_wallet);
 
-    return fFileBacked && mapWallet.erase(hash) && CWalletDB(strWalletFile).EraseTx(hash);
+    if (!fFileBacked || !mapWallet.erase(hash)) {
+        return false;
+    }
+
+    UpdateUnspentIndex(hash);
+
+    return CWalletDB(strWalletFile).EraseTx(hash);
 }
 
 
@@ -1079,35 +1183,373 @@ bool CWalletTx::WriteToDisk(CWalletDB *pwalletdb)
     return pwalletdb->WriteTx(GetHash(), *this);
 }
 
+namespace {
+//!
+//! \brief Maximum number of threads that read and match blocks during a rescan.
+//!
+constexpr unsigned int MAX_RESCAN_THREADS = 8;
+
+//!
+//! \brief Number of blocks that each rescan thread reads per batch.
+//!
+constexpr size_t RESCAN_BLOCKS_PER_THREAD = 64;
+
+//!
+//! \brief Snapshot of the key and script identifiers in a wallet's keystore.
+//!
+//! Rescan threads use this filter to discard transactions that cannot involve
+//! the wallet without taking the keystore lock. It matches a superset of the
+//! outputs that IsMine() accepts: a multisig output matches if the wallet owns
+//! any of its keys, and a P2SH output matches if the wallet knows its script.
+//! AddToWalletIfInvolvingMe() applies the exact rules to the matches later.
+//!
+class RescanFilter
+{
+public:
+    RescanFilter(std::set<CKeyID> keys, ScriptMap scripts)
+        : m_keys(std::move(keys))
+        , m_scripts(std::move(scripts))
+    {
+    }
+
+    bool Matches(const CScript& script) const
+    {
+        std::vector<valtype> solutions;
+        txnouttype type;
+
+        if (!Solver(script, type, solutions)) {
+            return false;
+        }
+
+        switch (type) {
+            case TX_PUBKEY:
+                return m_keys.count(CPubKey(solutions[0]).GetID()) > 0;
+            case TX_PUBKEYHASH:
+                return m_keys.count(CKeyID(uint160(solutions[0]))) > 0;
+            case TX_SCRIPTHASH:
+                return m_scripts.count(CScriptID(uint160(solutions[0]))) > 0;
+            case TX_MULTISIG:
+                for (size_t i = 1; i + 1 < solutions.size(); ++i) {
+                    if (m_keys.count(CPubKey(solutions[i]).GetID()) > 0) {
+                        return true;
+                    }
+                }
+                return false;
+            case TX_NONSTANDARD:
+            case TX_NULL_DATA:
+                return false;
+        }
+
+        return false;
+    }
+
+    bool Matches(const CTransaction& tx) const
+    {
+        for (const auto& txout : tx.vout) {
+            if (Matches(txout.scriptPubKey)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    std::set<CKeyID> m_keys; //!< IDs of the keys in the keystore.
+    ScriptMap m_scripts;     //!< Redeem scripts in the keystore by ID.
+};
+
+//!
+//! \brief A block read by a rescan thread with the results of matching its
+//! transactions against a RescanFilter.
+//!
+struct RescanBlock
+{
+    CBlockIndex* m_pindex;            //!< Index entry of the block to scan.
+    CBlock m_block;                   //!< Block read from disk.
+    std::vector<uint256> m_tx_hashes; //!< Hash of each transaction in the block.
+    std::vector<bool> m_matches;      //!< Whether each transaction matched the filter.
+    bool m_read = false;              //!< Whether the block was read successfully.
+
+    explicit RescanBlock(CBlockIndex* pindex) : m_pindex(pindex)
+    {
+    }
+
+    void Load(const RescanFilter& filter)
+    {
+        try {
+            m_read = ReadBlockFromDisk(m_block, m_pindex, Params().GetConsensus());
+        } catch (const std::exception& e) {
+            error("%s: failed to read block %s: %s", __func__, m_pindex->GetBlockHash().ToString(), e.what());
+            m_read = false;
+        }
+
+        m_tx_hashes.clear();
+        m_tx_hashes.reserve(m_block.vtx.size());
+
+        for (const auto& tx : m_block.vtx) {
+            m_tx_hashes.push_back(tx.GetHash());
+        }
+
+        Match(filter);
+    }
+
+    void Match(const RescanFilter& filter)
+    {
+        m_matches.assign(m_block.vtx.size(), false);
+
+        for (size_t i = 0; i < m_block.vtx.size(); ++i) {
+            m_matches[i] = filter.Matches(m_block.vtx[i]);
+        }
+    }
+};
+
+//!
+//! \brief Threads that read and match the blocks of every batch in a rescan.
+//!
+//! A rescan starts the threads once and hands each batch to all of them
+//! instead of starting new threads for every batch.
+//!
+class RescanThreadPool
+{
+public:
+    //!
+    //! \param thread_count Number of threads that run each task, including the
+    //! calling thread.
+    //!
+    explicit RescanThreadPool(const unsigned int thread_count)
+    {
+        for (unsigned int i = 1; i < thread_count; ++i) {
+            m_threads.emplace_back([this]() { ThreadMain(); });
+        }
+    }
+
+    ~RescanThreadPool()
+    {
+        {
+            LOCK(m_mutex);
+            m_stopping = true;
+        }
+
+        m_task_cond.notify_all();
+
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    //!
+    //! \brief Call a function on the calling thread and on every pool thread,
+    //! and return when all of the calls finish.
+    //!
+    void RunOnAll(const std::function<void()>& task)
+    {
+        {
+            LOCK(m_mutex);
+            m_task = &task;
+            m_pending = m_threads.size();
+            ++m_task_id;
+        }
+
+        m_task_cond.notify_all();
+
+        task();
+
+        WAIT_LOCK(m_mutex, lock);
+        m_done_cond.wait(lock, [this]() { return m_pending == 0; });
+        m_task = nullptr;
+    }
+
+private:
+    std::vector<std::thread> m_threads;
+    Mutex m_mutex;
+    std::condition_variable m_task_cond; //!< Signals a new task or a stop.
+    std::condition_variable m_done_cond; //!< Signals that the threads finished.
+    const std::function<void()>* m_task GUARDED_BY(m_mutex) = nullptr;
+    uint64_t m_task_id GUARDED_BY(m_mutex) = 0;
+    size_t m_pending GUARDED_BY(m_mutex) = 0;
+    bool m_stopping GUARDED_BY(m_mutex) = false;
+
+    void ThreadMain()
+    {
+        RenameThread("grc-rescan");
+
+        uint64_t last_task_id = 0;
+
+        while (true) {
+            const std::function<void()>* task;
+
+            {
+                WAIT_LOCK(m_mutex, lock);
+                m_task_cond.wait(lock, [&]() { return m_stopping || m_task_id != last_task_id; });
+
+                if (m_stopping) {
+                    return;
+                }
+
+                last_task_id = m_task_id;
+                task = m_task;
+            }
+
+            (*task)();
+
+            LOCK(m_mutex);
+
+            if (--m_pending == 0) {
+                m_done_cond.notify_one();
+            }
+        }
+    }
+};
+} // anonymous namespace
+
 // Scan the block chain (starting in pindexStart) for transactions
 // from or to us. If fUpdate is true, found transactions that already
 // exist in the wallet will be updated.
-int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate)
+int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate, unsigned int thread_count)
 {
+    // Rescan threads read batches of blocks from disk and match the outputs of
+    // their transactions against a snapshot of the keystore without holding any
+    // locks. Then, this thread passes the transactions that may involve the
+    // wallet to AddToWalletIfInvolvingMe() in chain order under cs_main and
+    // cs_wallet. A transaction involves the wallet if an output matches or if
+    // it spends an output of a transaction in mapWallet. The ordered stage can
+    // check the inputs cheaply because it sees transactions added by earlier
+    // blocks in the rescan.
+    //
+    if (thread_count == 0) {
+        thread_count = std::clamp(std::thread::hardware_concurrency(), 1u, MAX_RESCAN_THREADS);
+    }
+
+    const size_t batch_size = thread_count * RESCAN_BLOCKS_PER_THREAD;
+    const int64_t start_time = GetTimeMillis();
+
     int ret = 0;
+    int64_t blocks_scanned = 0;
+
+    std::optional<RescanFilter> filter;
+    uint64_t filter_generation = 0;
+
+    const auto refresh_filter = [&]() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet) {
+        std::set<CKeyID> keys;
+        ScriptMap scripts;
+
+        GetKeys(keys);
+        {
+            LOCK(cs_KeyStore);
+            scripts = mapScripts;
+        }
 
+        filter.emplace(std::move(keys), std::move(scripts));
+        filter_generation = m_keystore_generation;
+    };
+
+    std::vector<RescanBlock> batch;
+    std::atomic<size_t> next_block { 0 };
     CBlockIndex* pindex = pindexStart;
-    {
-        LOCK2(cs_main, cs_wallet);
-        while (pindex)
+
+    const std::function<void()> load_blocks = [&]() {
+        for (size_t i = next_block++; i < batch.size(); i = next_block++) {
+            batch[i].Load(*filter);
+        }
+    };
+
+    RescanThreadPool pool(thread_count);
+
+    while (pindex) {
+        batch.clear();
+
         {
-            // no need to read and scan block, if block was created before
-            // our wallet birthday (as adjusted for block time variability)
-            if (nTimeFirstKey && (pindex->nTime < (nTimeFirstKey - 7200))) {
-                pindex = pindex->pnext;
-                continue;
+            LOCK2(cs_main, cs_wallet);
+
+            if (!filter || filter_generation != m_keystore_generation) {
+                refresh_filter();
             }
 
-            CBlock block;
-            ReadBlockFromDisk(block, pindex, Params().GetConsensus());
-            for (auto const& tx : block.vtx)
-            {
-                if (AddToWalletIfInvolvingMe(tx, &block, fUpdate))
+            for (; pindex && batch.size() < batch_size; pindex = pindex->pnext) {
+                // no need to read and scan block, if block was created before
+                // our wallet birthday (as adjusted for block time variability)
+                if (nTimeFirstKey && (pindex->nTime < (nTimeFirstKey - 7200))) {
+                    continue;
+                }
+
+                batch.emplace_back(pindex);
+            }
+        }
+
+        if (batch.empty()) {
+            break;
+        }
+
+        next_block = 0;
+        pool.RunOnAll(load_blocks);
+
+        LOCK2(cs_main, cs_wallet);
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            RescanBlock& entry = batch[i];
+
+            // The chain may have reorganized while the threads read the batch.
+            // Resume from the fork:
+            //
+            if (!entry.m_pindex->IsInMainChain()) {
+                CBlockIndex* pindex_fork = entry.m_pindex;
+
+                while (pindex_fork && !pindex_fork->IsInMainChain()) {
+                    pindex_fork = pindex_fork->pprev;
+                }
+
+                pindex = pindex_fork ? pindex_fork->pnext : pindexGenesisBlock;
+
+                LogPrintf("WARNING: %s: chain reorganized during rescan. Resuming from height %d.",
+                          __func__,
+                          pindex ? pindex->nHeight : -1);
+
+                break;
+            }
+
+            if (!entry.m_read) {
+                error("%s: failed to read block at height %d", __func__, entry.m_pindex->nHeight);
+            }
+
+            for (size_t j = 0; j < entry.m_block.vtx.size(); ++j) {
+                const CTransaction& tx = entry.m_block.vtx[j];
+
+                if (!entry.m_matches[j]
+                    && !mapWallet.count(entry.m_tx_hashes[j])
+                    && std::none_of(tx.vin.begin(), tx.vin.end(), [&](const CTxIn& txin) {
+                           return mapWallet.count(txin.prevout.hash) > 0;
+                       }))
+                {
+                    continue;
+                }
+
+                if (AddToWalletIfInvolvingMe(tx, &entry.m_block, fUpdate))
                     ret++;
             }
-            pindex = pindex->pnext;
+
+            ++blocks_scanned;
+
+            // Adding a transaction can draw new keys from the keypool. Match the
+            // rest of the batch again with a filter that includes them:
+            //
+            if (filter_generation != m_keystore_generation) {
+                refresh_filter();
+
+                for (size_t k = i + 1; k < batch.size(); ++k) {
+                    batch[k].Match(*filter);
+                }
+            }
         }
     }
+
+    LogPrintf("%s: scanned %" PRId64 " blocks with %u threads in %" PRId64 " ms, %d transactions added or updated.",
+              __func__,
+              blocks_scanned,
+              thread_count,
+              GetTimeMillis() - start_time,
+              ret);
+
     return ret;
 }
 
@@ -1197,6 +1639,7 @@ void CWallet::ReacceptWalletTransactions()
                     CWalletDB walletdb(strWalletFile);
 
                     wtx.WriteToDisk(&walletdb);
+                    UpdateUnspentIndex(item.first);
                 }
             }
             else
@@ -1420,9 +1863,9 @@ int64_t CWallet::GetBalance() const
     int64_t nTotal = 0;
     {
         LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        for (const auto& it : UnspentIndex())
         {
-            const CWalletTx* pcoin = &it->second;
+            const CWalletTx* pcoin = it.second;
             if (pcoin->IsTrusted() && (pcoin->IsConfirmed() || pcoin->fFromMe))
                 nTotal += pcoin->GetAvailableCredit();
         }
@@ -1436,9 +1879,9 @@ int64_t CWallet::GetUnconfirmedBalance() const
     int64_t nTotal = 0;
     {
         LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        for (const auto& it : UnspentIndex())
         {
-            const CWalletTx* pcoin = &it->second;
+            const CWalletTx* pcoin = it.second;
             if (!IsFinalTx(*pcoin) || (!pcoin->IsConfirmed() && !pcoin->fFromMe && pcoin->IsInMainChain())) {
                 nTotal += pcoin->GetAvailableCredit();
             }
@@ -1452,9 +1895,11 @@ int64_t CWallet::GetImmatureBalance() const
     int64_t nTotal = 0;
     {
         LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        // Immature outputs cannot be spent yet, so the unspent index contains
+        // every transaction that contributes to the immature balance:
+        for (const auto& it : UnspentIndex())
         {
-            const CWalletTx& pcoin = it->second;
+            const CWalletTx& pcoin = *it.second;
             if (pcoin.IsCoinBase() && pcoin.GetBlocksToMaturity() > 0 && pcoin.IsInMainChain()) {
                 nTotal += GetCredit(pcoin);
             }
@@ -1470,9 +1915,9 @@ void CWallet::AvailableCoins(vector<COutput>& vCoins, bool fOnlyConfirmed, const
 
     {
         LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        for (const auto& it : UnspentIndex())
         {
-            const CWalletTx* pcoin = &it->second;
+            const CWalletTx* pcoin = it.second;
             int nDepth = pcoin->GetDepthInMainChain();
 
             if (!fIncludeStakedCoins) {
@@ -1502,7 +1947,7 @@ void CWallet::AvailableCoins(vector<COutput>& vCoins, bool fOnlyConfirmed, const
             for (unsigned int i = 0; i < pcoin->vout.size(); i++)
 			{
                 if ((!(pcoin->IsSpent(i)) && (IsMine(pcoin->vout[i]) != ISMINE_NO) && pcoin->vout[i].nValue >= nMinimumInputValue &&
-                     (!coinControl || !coinControl->HasSelected() || coinControl->IsSelected(it->first, i))) ||
+                     (!coinControl || !coinControl->HasSelected() || coinControl->IsSelected(it.first, i))) ||
                     (fIncludeStakedCoins && pcoin->IsCoinStake() && pcoin->GetBlocksToMaturity() > 0 && pcoin->GetDepthInMainChain() > 0)) {
                     vCoins.push_back(COutput(pcoin, i, nDepth));
                 }
@@ -1526,9 +1971,9 @@ void CWallet::AvailableCoinsForStaking(vector<COutput>& vCoins, unsigned int nSp
         unsigned int transactions = 0;
         unsigned int txns_w_avail_outputs = 0;
 
-        for (const auto& it : mapWallet)
+        for (const auto& it : UnspentIndex())
         {
-            const CWalletTx* pcoin = &it.second;
+            const CWalletTx* pcoin = it.second;
 
             // Track number of transactions processed for instrumentation purposes.
             ++transactions;
@@ -1661,9 +2106,9 @@ int64_t CWallet::GetStake() const
 {
     int64_t nTotal = 0;
     LOCK2(cs_main, cs_wallet);
-    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+    for (const auto& it : UnspentIndex())
     {
-        const CWalletTx* pcoin = &it->second;
+        const CWalletTx* pcoin = it.second;
         if (pcoin->IsCoinStake() && pcoin->GetBlocksToMaturity() > 0 && pcoin->GetDepthInMainChain() > 0) {
             nTotal += CWallet::GetCredit(*pcoin);
         }
@@ -1675,9 +2120,9 @@ int64_t CWallet::GetNewMint() const
 {
     int64_t nTotal = 0;
     LOCK2(cs_main, cs_wallet);
-    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+    for (const auto& it : UnspentIndex())
     {
-        const CWalletTx* pcoin = &it->second;
+        const CWalletTx* pcoin = it.second;
         if (pcoin->IsCoinStake() && pcoin->GetBlocksToMaturity() > 0 && pcoin->GetDepthInMainChain() > 0) {
             nTotal += CWallet::GetCredit(*pcoin);
         }
@@ -2313,6 +2758,7 @@ bool CWallet::CommitTransaction(CWalletTx& wtxNew, CReserveKey& reservekey)
                 coin.BindWallet(this);
                 coin.MarkSpent(txin.prevout.n);
                 coin.WriteToDisk(pwalletdb);
+                UpdateUnspentIndex(txin.prevout.hash);
                 NotifyTransactionChanged(this, coin.GetHash(), CT_UPDATED);
             }
 
@@ -2417,8 +2863,13 @@ DBErrors CWallet::LoadWallet(bool& fFirstRunRet)
         LOCK(cs_wallet);
 
         fFirstRunRet = !vchDefaultKey.IsValid();
+
+        // The wallet database populated mapWallet directly:
+        InvalidateUnspentIndex();
     }
 
+    PruneSupportingTransactions();
+
     NewThread(ThreadFlushWalletDB, &strWalletFile);
 
     LogPrintf("LoadWallet: started wallet flush thread.");
@@ -2428,6 +2879,50 @@ DBErrors CWallet::LoadWallet(bool& fFirstRunRet)
 
 
 
+void CWallet::PruneSupportingTransactions()
+{
+    // Once a wallet is pruned, only unconfirmed transactions keep supporting
+    // transactions. Skip the pass and cs_main when no record carries any:
+    {
+        LOCK(cs_wallet);
+
+        const bool has_supporting_txs = std::any_of(mapWallet.begin(), mapWallet.end(), [](const auto& entry) {
+            return !entry.second.vtxPrev.empty();
+        });
+
+        if (!has_supporting_txs)
+            return;
+    }
+
+    LOCK2(cs_main, cs_wallet);
+
+    CWalletDB walletdb(strWalletFile);
+    size_t pruned_count = 0;
+    size_t pruned_tx_count = 0;
+
+    for (auto& [hash, wtx] : mapWallet)
+    {
+        // A transaction in the main chain never relays its inputs again. The
+        // next reorganization re-accepts any disconnected wallet inputs from
+        // the wallet itself:
+        if (wtx.vtxPrev.empty() || !wtx.IsInMainChain())
+            continue;
+
+        pruned_tx_count += wtx.vtxPrev.size();
+        ++pruned_count;
+
+        wtx.vtxPrev.clear();
+        wtx.vtxPrev.shrink_to_fit();
+        walletdb.WriteTx(hash, wtx);
+    }
+
+    if (pruned_count > 0)
+    {
+        LogPrintf("%s: dropped %u supporting transactions from %u confirmed wallet transactions",
+                  __func__, pruned_tx_count, pruned_count);
+    }
+}
+
 DBErrors CWallet::ZapWalletTx(std::vector<CWalletTx>& vWtx)
 {
     if (!fFileBacked)
@@ -2863,6 +3358,7 @@ void CWallet::FixSpentCoins(int& nMismatchFound, int64_t& nBalanceInQuestion, bo
                 {
                     pcoin->MarkUnspent(n);
                     pcoin->WriteToDisk(&walletdb);
+                    UpdateUnspentIndex(pcoin->GetHash());
                 }
             }
             else if ((IsMine(pcoin->vout[n]) != ISMINE_NO) && !pcoin->IsSpent(n) && (txindex.vSpent.size() > n && !txindex.vSpent[n].IsNull()))
@@ -2875,6 +3371,7 @@ void CWallet::FixSpentCoins(int& nMismatchFound, int64_t& nBalanceInQuestion, bo
                 {
                     pcoin->MarkSpent(n);
                     pcoin->WriteToDisk(&walletdb);
+                    UpdateUnspentIndex(pcoin->GetHash());
                 }
             }
         }
@@ -2901,6 +3398,7 @@ void CWallet::DisableTransaction(const CTransaction &tx)
             {
                 prev.MarkUnspent(txin.prevout.n);
                 prev.WriteToDisk(&walletdb);
+                UpdateUnspentIndex(txin.prevout.hash);
             }
         }
     }
@@ -91,6 +91,31 @@ private:
     /* the HD chain data model (external chain counters) */
     CHDChain hdChain;
 
+    //!
+    //! \brief Wallet transactions that contain at least one output that belongs
+    //! to the wallet and is not marked spent, keyed by transaction hash.
+    //!
+    //! Old staking and pool wallets hold hundreds of thousands of transactions
+    //! but usually only a few hundred of them carry unspent outputs. Balance,
+    //! coin selection and staking routines iterate this index instead of all
+    //! of mapWallet. It preserves mapWallet's iteration order. The pointers
+    //! refer to mapWallet entries.
+    //!
+    mutable std::map<uint256, const CWalletTx*> m_unspent_index GUARDED_BY(cs_wallet);
+
+    //!
+    //! \brief Set when the unspent index needs a full rebuild from mapWallet.
+    //!
+    mutable bool m_unspent_index_stale GUARDED_BY(cs_wallet) = true;
+
+    //!
+    //! \brief Incremented when keys or scripts are added to the keystore.
+    //!
+    //! Wallet routines that cache information derived from the keystore, like
+    //! the rescan output filter, compare this value to detect changes.
+    //!
+    uint64_t m_keystore_generation GUARDED_BY(cs_wallet) = 0;
+
 public:
     /// Main wallet lock.
     /// This lock protects all the fields added by CWallet
@@ -243,11 +268,47 @@ public:
     TxItems OrderedTxItems(std::list<CAccountingEntry>& acentries, std::string strAccount = "");
 
     void MarkDirty();
+
+    //!
+    //! \brief Get the unspent index, rebuilding it first if it is stale.
+    //!
+    const std::map<uint256, const CWalletTx*>& UnspentIndex() const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+
+    //!
+    //! \brief Add or remove a wallet transaction from the unspent index after
+    //! a change to its spent flags.
+    //!
+    //! \param hash Hash of the transaction in mapWallet. The index drops the
+    //! entry if mapWallet no longer contains the transaction.
+    //!
+    void UpdateUnspentIndex(const uint256& hash) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+
+    //!
+    //! \brief Schedule a rebuild of the unspent index on its next use.
+    //!
+    //! Call this after changes that may affect many transactions at once, like
+    //! adding keys that change which outputs belong to the wallet or erasing
+    //! entries from mapWallet.
+    //!
+    void InvalidateUnspentIndex() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+
     bool AddToWallet(const CWalletTx& wtxIn, CWalletDB *pwalletdb);
     bool AddToWalletIfInvolvingMe(const CTransaction& tx, const CBlock* pblock, bool fUpdate = false, bool fFindBlock = false);
     bool EraseFromWallet(uint256 hash);
     void WalletUpdateSpent(const CTransaction &tx, bool fBlock, CWalletDB* pwalletdb);
-    int ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate = false);
+
+    //!
+    //! \brief Scan the main chain from \p pindexStart for transactions that
+    //! involve the wallet and add them.
+    //!
+    //! \param fUpdate      Update transactions that already exist in the wallet.
+    //! \param thread_count Threads that read blocks, including the calling
+    //! thread. Zero selects one per core up to a fixed limit.
+    //!
+    //! \return Number of transactions added or updated.
+    //!
+    int ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate = false, unsigned int thread_count = 0);
+
     int ScanForMRCRequests(CBlockIndex* pindexStart, CBlockIndex* pindexEnd, bool fUpdate = false);
     void ReacceptWalletTransactions();
 
@@ -359,6 +420,17 @@ public:
     void SetBestChain(const CBlockLocator& loc);
 
     DBErrors LoadWallet(bool& fFirstRunRet);
+
+    //!
+    //! \brief Drop the supporting transactions stored with wallet transactions
+    //! that are already in the main chain and rewrite the affected records.
+    //!
+    //! The wallet only needs the copies of unconfirmed inputs in \c vtxPrev to
+    //! relay an unconfirmed transaction. Older wallets kept them forever, which
+    //! inflates the wallet file and the time spent loading it.
+    //!
+    void PruneSupportingTransactions();
+
     DBErrors ZapWalletTx(std::vector<CWalletTx>& vWtx);
 
     bool SetAddressBookName(const CTxDestination& address, const std::string& strName);
@@ -451,20 +451,10 @@ DBErrors CWalletDB::LoadWallet(CWallet* pwallet)
             return DB_CORRUPT;
         }
 
-        while (true)
-        {
-            // Read next record
-            CDataStream ssKey(SER_DISK, CLIENT_VERSION);
-            CDataStream ssValue(SER_DISK, CLIENT_VERSION);
-            int ret = ReadAtCursor(pcursor, ssKey, ssValue);
-            if (ret == DB_NOTFOUND)
-                break;
-            else if (ret != 0)
-            {
-                LogPrintf("Error reading next record from wallet database");
-                return DB_CORRUPT;
-            }
-
+        // Read every record in bulk. Each call fills a buffer with many
+        // records, which loads large wallets much faster than one read per
+        // record:
+        int ret = ReadBulkAtCursor(pcursor, [&](CDataStream& ssKey, CDataStream& ssValue) {
             // Try to be tolerant of single corrupt records:
             string strType, strErr;
             if (!ReadKeyValue(pwallet, ssKey, ssValue, wss, strType, strErr))
@@ -484,7 +474,15 @@ DBErrors CWalletDB::LoadWallet(CWallet* pwallet)
             }
             if (!strErr.empty())
                 LogPrintf("%s", strErr);
+        });
+
+        if (ret != DB_NOTFOUND)
+        {
+            LogPrintf("Error reading next record from wallet database");
+            pcursor->close();
+            return DB_CORRUPT;
         }
+
         pcursor->close();
     }
     catch (...)